@@ -60,6 +60,13 @@ public:
     void LogDeterminantInputGradImpl(StridedMatrix<const double, MemorySpace> const& pts,
                                      StridedMatrix<double, MemorySpace>              output) override;
 
+    /** The log determinant is constant and the map has no coefficients, so only the evaluation requires a pass over the points. */
+    void ForwardPassImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                         StridedMatrix<const double, MemorySpace> const& sens,
+                         StridedMatrix<double, MemorySpace>              evals,
+                         StridedVector<double, MemorySpace>              logDets,
+                         StridedMatrix<double, MemorySpace>              coeffGrad) override;
+
     /** Computes an LU factorization of the matrix A_ */
     void Factorize();
 
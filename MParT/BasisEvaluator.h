@@ -4,6 +4,10 @@
 #include <Kokkos_Core.hpp>
 #include "MParT/PositiveBijectors.h"
 
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace mpart {
 /**
  * @brief Flags for controlling how "homogeneous/heterogeneous" a real-valued
@@ -148,6 +152,20 @@ class BasisEvaluator {
 template<typename T>
 struct GetRectifier{};
 
+/** Detects univariate bases that can integrate products of their derivatives in closed form (see OrthogonalPolynomial::DerivativeProductIntegrals). */
+template<typename T, typename=void>
+struct HasDerivativeProductIntegrals : std::false_type {};
+
+template<typename T>
+struct HasDerivativeProductIntegrals<T, std::void_t<decltype(std::declval<T const&>().DerivativeProductIntegrals(0u))>> : std::true_type {};
+
+/** Detects univariate bases that can be compared for equality, which allows their evaluations to be shared between expansions (see SharedBasisTable). */
+template<typename T, typename=void>
+struct IsBasisComparable : std::false_type {};
+
+template<typename T>
+struct IsBasisComparable<T, std::void_t<decltype(std::declval<T const&>()==std::declval<T const&>())>> : std::true_type {};
+
 template<BasisHomogeneity HowHomogeneous, typename BasisEvaluatorType, typename RectifierType>
 struct GetRectifier<BasisEvaluator<HowHomogeneous, BasisEvaluatorType, RectifierType>>{
     using type = RectifierType;
@@ -8,7 +8,9 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <cstddef>
 #include <deque>
+#include <mutex>
 
 namespace mpart{
 
@@ -23,7 +25,9 @@ where each map \f$T_i:\mathbb{R}^{N}\rightarrow \mathbb{R}^{N}\f$ is a square tr
 
 Checkpointing can be used for deep maps to reduce the amount of memory that is required for gradient computations.
 The checkpointing logic was adapted from the `revolve` algorithm of <a href="https://dl.acm.org/doi/10.1145/347837.347846">[Griewank and Walther, 2000]</a>,
-which is an optimal binomial checkpointing scheme.
+which is an optimal binomial checkpointing scheme.  The number of checkpoints can either be fixed with the `maxChecks` argument
+of the constructor or computed from a memory budget (see SetCheckpointBudget), in which case it adapts to the number of points
+in each gradient computation.
 
  */
 template<typename MemorySpace>
@@ -41,6 +45,37 @@ public:
 
     virtual ~ComposedMap() = default;
 
+    /** @brief Summary of the checkpointing used in the most recent gradient computation. */
+    struct CheckpointReport {
+        unsigned int maxCheckpoints = 0;    ///< Number of checkpoints allowed, including the stored input points.
+        unsigned int peakCheckpoints = 0;   ///< Largest number of checkpoints stored at the same time.
+        unsigned int numLayerEvals = 0;     ///< Number of layer evaluations used to recompute layer inputs.
+        std::size_t bytesPerCheckpoint = 0; ///< Memory used by a single checkpoint, i.e., \f$N\times\f$ the number of points \f$\times\f$ `sizeof(double)`.
+        std::size_t peakBytes = 0;          ///< Peak memory used by the checkpoints and the two work arrays that hold intermediate layer inputs.
+    };
+
+    /** @brief Sets a memory budget for the states stored during gradient computations.
+        @details When the budget is nonzero, the number of checkpoints used by each gradient computation is chosen so that the
+        checkpoints and the two work arrays holding intermediate layer inputs fit in `maxBytes` bytes.  Each of these arrays
+        uses \f$N\times\f$ the number of points \f$\times\f$ `sizeof(double)` bytes, so larger batches use fewer checkpoints and
+        recompute more layers.  At least one checkpoint (the input points) is always stored, even if that exceeds the budget.
+        @param maxBytes The memory budget in bytes.  A value of 0 disables the budget and uses the `maxChecks` argument passed to the constructor.
+        @see NumCheckpoints, LastCheckpointReport
+    */
+    void SetCheckpointBudget(std::size_t maxBytes){maxCheckBytes_ = maxBytes;};
+
+    /** @brief Returns the memory budget set with SetCheckpointBudget, or 0 if there is none. */
+    std::size_t CheckpointBudget() const{return maxCheckBytes_;};
+
+    /** @brief Returns the number of checkpoints that will be used for a gradient computation with `numPts` points. */
+    unsigned int NumCheckpoints(unsigned int numPts) const;
+
+    /** @brief Returns the checkpointing statistics of the most recent gradient computation (e.g., CoeffGrad or Gradient).
+        @details The report is updated under a lock, so it is safe to call this function while other threads evaluate the map.
+        When several gradient computations run concurrently, the report describes whichever one finished last.
+    */
+    CheckpointReport LastCheckpointReport() const;
+
     /** @brief Sets the coefficients for all components of the map.
 
         @details This function will copy the provided coeffs vectors into the savedCoeffs object in the ComposedMap class.   To avoid
@@ -103,9 +138,24 @@ public:
     void GradientImpl(StridedMatrix<const double, MemorySpace> const& pts,
                       StridedMatrix<const double, MemorySpace> const& sens,
                       StridedMatrix<double, MemorySpace>              output) override;
+
+    /** @brief Computes the output and log determinant of every layer in one forward sweep and, when requested, the coefficient
+               gradients of both terms in one backward sweep.  See ConditionalMapBase::ForwardPassImpl.
+    */
+    void ForwardPassImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                         StridedMatrix<const double, MemorySpace> const& sens,
+                         StridedMatrix<double, MemorySpace>              evals,
+                         StridedVector<double, MemorySpace>              logDets,
+                         StridedMatrix<double, MemorySpace>              coeffGrad) override;
 private:
 
+    /** Stores the report of a finished gradient computation as the value returned by LastCheckpointReport. */
+    void StoreReport(CheckpointReport const& report);
+
     unsigned int maxChecks_;
+    std::size_t maxCheckBytes_ = 0;
+    CheckpointReport lastReport_;
+    mutable std::mutex reportMutex_;
     std::vector<std::shared_ptr<ConditionalMapBase<MemorySpace>>> maps_;
 
     /* Class for coordinating checkpoints during gradient evaluations. */
@@ -124,6 +174,9 @@ private:
         */
         Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> GetLayerInput(unsigned int layerInd);
 
+        /** Returns the number of checkpoints and layer evaluations used so far. */
+        CheckpointReport Report() const;
+
     protected:
 
         /** Given the current state of the checkpoints and a need to evaluate the input to layer layerInd, this
@@ -140,6 +193,9 @@ private:
         std::deque<Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace>> checkpoints_;
         std::deque<unsigned int> checkpointLayers_;
 
+        unsigned int peakCheckpoints_ = 1;
+        unsigned int numLayerEvals_ = 0;
+
         std::vector<std::shared_ptr<ConditionalMapBase<MemorySpace>>>& maps_;
     };
 
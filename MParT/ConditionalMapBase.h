@@ -12,6 +12,8 @@
 #include "MParT/Utilities/ArrayConversions.h"
 
 #include "MParT/ParameterizedFunctionBase.h"
+#include "MParT/MultiIndices/FixedMultiIndexSet.h"
+#include "MParT/SharedBasisTable.h"
 
 #include <Eigen/Core>
 
@@ -51,6 +53,68 @@ namespace mpart {
         */
         virtual std::shared_ptr<ParameterizedFunctionBase<MemorySpace>> GetBaseFunction(){return nullptr;};
 
+        /** For maps defined by a single multivariate expansion, e.g., a MonotoneComponent, returns the multiindex set of the expansion.
+            Other maps throw a std::runtime_error.
+        */
+        virtual FixedMultiIndexSet<MemorySpace> GetMultiIndexSet() const {
+            throw std::runtime_error("ConditionalMapBase::GetMultiIndexSet: This map is not defined by a single multiindex set.");
+        };
+
+        /** @brief Allows the map to precompute and store quantities that only depend on a fixed set of input points.
+            @details This is an opt-in tradeoff of memory for time that is useful when the same points are evaluated many times,
+            e.g., the training data during optimization of the map coefficients.  Maps that do not support this ignore the call.
+            The stored values are used whenever a later call is made with `pts` or a subset of its columns, so the values in
+            `pts` must not be changed while the data is frozen.  Calls are matched to the frozen points by their memory address
+            and strides only.  If the frozen buffer is modified in place, or if `pts` is an unmanaged view whose memory is freed
+            and reused for other points, later calls silently return the stale frozen values.  Call UnfreezeData before
+            reusing the memory.
+            @param pts The points, stored column-wise, that will be reused in later calls.
+            @see UnfreezeData
+        */
+        virtual void FreezeData(StridedMatrix<const double, MemorySpace> const& pts){};
+
+        /** @brief Releases any values stored by FreezeData. */
+        virtual void UnfreezeData(){};
+
+        /** @brief Returns true if this map can read 1d basis evaluations from a SharedBasisTable filled by `other`.
+            @details Used by TriangularMap to evaluate the 1d basis in each input once per point for all of its components.
+            Maps that do not support shared basis evaluations return false.
+            @see SharedBasisTable
+        */
+        virtual bool CanShareBasis(ConditionalMapBase<MemorySpace> const& other) const {return false;};
+
+        /** @brief Returns the largest degree of the 1d basis that this map reads from a SharedBasisTable in each of its first
+                   \f$N-1\f$ inputs.  Only meaningful when CanShareBasis is true.
+        */
+        virtual std::vector<unsigned int> SharedBasisDegrees() const {return std::vector<unsigned int>();};
+
+        /** @brief Evaluates the 1d basis of this map in each input dimension tabulated by `rowStarts`.
+            @param pts The points where the basis is evaluated.  Must have at least `rowStarts.extent(0)-1` rows.
+            @param rowStarts The layout of the table.  See SharedBasisTable::rowStarts.
+            @param vals A preallocated matrix with `rowStarts(rowStarts.extent(0)-1)` rows and one column for each point.
+            @throws std::runtime_error if the map does not support shared basis evaluations.
+        */
+        virtual void FillSharedBasis(StridedMatrix<const double, MemorySpace> const& pts,
+                                     Kokkos::View<const unsigned int*, MemorySpace> const& rowStarts,
+                                     Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> vals) const;
+
+        /** @brief Versions of EvaluateImpl, LogDeterminantImpl and CoeffGradImpl that may copy 1d basis evaluations from `basis`,
+            which was filled at the same points by a map for which CanShareBasis returned true.  The default implementations ignore
+            `basis` and call the regular `*Impl` function.
+        */
+        virtual void EvaluateSharedImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                                        SharedBasisTable<MemorySpace>            const& basis,
+                                        StridedMatrix<double, MemorySpace>              output);
+
+        virtual void LogDeterminantSharedImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                                              SharedBasisTable<MemorySpace>            const& basis,
+                                              StridedVector<double, MemorySpace>              output);
+
+        virtual void CoeffGradSharedImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                                         StridedMatrix<const double, MemorySpace> const& sens,
+                                         SharedBasisTable<MemorySpace>            const& basis,
+                                         StridedMatrix<double, MemorySpace>              output);
+
         /** @brief Computes the log determinant of the map Jacobian.
         For a map \f$T:\mathbb{R}^N\rightarrow \mathbb{R}^M\f$ with \f$M\leq N\f$ and components \f$T_i(x_{1:N-M+i})\f$, this
         function computes the determinant of the Jacobian of \f$T\f$ with respect to \f$x_{N-M:N}\f$.  While the map is rectangular,
@@ -110,10 +174,41 @@ namespace mpart {
                                    Eigen::Ref<const Eigen::RowMatrixXd> const& r);
 
 
+        /** @brief Computes the inverse of the map starting from a per-point initial guess.
+            @details This function is useful when the inverse is needed for a sequence of nearby targets, e.g., MCMC
+            proposals or conditional sampling on a grid, where the previous solution is a good initial guess.  Maps whose
+            inverse uses a bracketing search (e.g., MonotoneComponent and TriangularMap) also use `bracketWidths` as the
+            initial step of the search around each guess and, on exit, overwrite it with twice the distance between the
+            guess and the computed root, which is a good initial step for a subsequent solve with nearby targets.  To keep
+            later solves cheap after a very accurate guess, the width never shrinks by more than half per solve.
+            Other maps leave `bracketWidths` unchanged.
+
+            @param x1 A \f$d_{in}-d_{out}\times N\f$ or \f$d_{in}\times N\f$ matrix containing \f$N\f$ values of the first input block.
+            @param r A \f$d_{out}\times N\f$ matrix containing \f$N\f$ values of the map output.
+            @param x2Guess A \f$d_{out}\times N\f$ matrix containing an initial guess for each value of \f$x_2\f$.
+            @param bracketWidths Either an empty view or a \f$d_{out}\times N\f$ matrix containing the initial step used to bracket each root.
+                                 Non-positive values are replaced with the default step of 1.
+            @return A \f$d_{out} \times N\f$ matrix containing the computed values of \f$\{x_2^{(1)},\ldots,x_2^{(N)}\}\f$.
+        */
+        StridedMatrix<double, MemorySpace> Inverse(StridedMatrix<const double, MemorySpace> const& x1,
+                                                   StridedMatrix<const double, MemorySpace> const& r,
+                                                   StridedMatrix<const double, MemorySpace> const& x2Guess,
+                                                   StridedMatrix<double, MemorySpace>              bracketWidths);
+
         /** Pure abstract function overridden by child classes. */
         virtual void InverseImpl(StridedMatrix<const double, MemorySpace> const& x1,
                                  StridedMatrix<const double, MemorySpace> const& r,
                                  StridedMatrix<double, MemorySpace>              output) = 0;
+
+        /** @brief Computes the inverse starting from the initial guess `x2Guess`.  See the four argument Inverse function.
+            @details The default implementation places `x2Guess` in the last \f$d_{out}\f$ rows of the input, which solvers
+            use as their initial guess, calls InverseImpl, and leaves `bracketWidths` unchanged.
+        */
+        virtual void InverseWithGuessImpl(StridedMatrix<const double, MemorySpace> const& x1,
+                                          StridedMatrix<const double, MemorySpace> const& r,
+                                          StridedMatrix<const double, MemorySpace> const& x2Guess,
+                                          StridedMatrix<double, MemorySpace>              bracketWidths,
+                                          StridedMatrix<double, MemorySpace>              output);
         /**
            @brief Computes the gradient of the log determinant with respect to the map coefficients.
            @details For a map \f$T(x; w) : \mathbb{R}^N \rightarrow \mathbb{R}^M\f$ parameterized by coefficients \f$w\in\mathbb{R}^K\f$,
@@ -158,6 +253,54 @@ namespace mpart {
         virtual void LogDeterminantInputGradImpl(StridedMatrix<const double, MemorySpace> const& pts,
                                                  StridedMatrix<double, MemorySpace>              output) = 0;
 
+        /** @brief Computes the map output, the log determinant and, optionally, their gradients with respect to the coefficients in
+                   a single pass over the points.
+            @details Each output is only computed when it has a nonzero size, so any subset of \f$T(x)\f$, \f$\log\det\nabla_x T(x)\f$ and
+            \f$\nabla_{\mathbf{w}}\left[s^T T(x) + \log\det\nabla_x T(x)\right]\f$ can be requested.  Computing them together allows maps to
+            reuse basis evaluations and quadrature integrands that separate calls to EvaluateImpl, LogDeterminantImpl, CoeffGradImpl
+            and LogDeterminantCoeffGradImpl would each recompute.  The default implementation simply calls those functions.
+            @param pts The points where the map is evaluated.  Each column contains a single point.
+            @param sens A matrix with \f$M\f$ rows containing the sensitivity \f$s\f$ for each point.  Only used when `coeffGrad` is not empty.
+            @param evals Either an empty view or an \f$M\times N\f$ matrix to store \f$T(x)\f$.
+            @param logDets Either an empty view or a vector of length \f$N\f$ to store the log determinant.
+            @param coeffGrad Either an empty view or a matrix with `numCoeffs` rows and \f$N\f$ columns to store the coefficient gradient.
+        */
+        virtual void ForwardPassImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                                     StridedMatrix<const double, MemorySpace> const& sens,
+                                     StridedMatrix<double, MemorySpace>              evals,
+                                     StridedVector<double, MemorySpace>              logDets,
+                                     StridedMatrix<double, MemorySpace>              coeffGrad);
+
+        /** @brief Version of ForwardPassImpl that may copy 1d basis evaluations from `basis`.  See EvaluateSharedImpl. */
+        virtual void ForwardPassSharedImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                                           SharedBasisTable<MemorySpace>            const& basis,
+                                           StridedMatrix<const double, MemorySpace> const& sens,
+                                           StridedMatrix<double, MemorySpace>              evals,
+                                           StridedVector<double, MemorySpace>              logDets,
+                                           StridedMatrix<double, MemorySpace>              coeffGrad);
+
+        /** @brief Versions of the `*Impl` functions that process the points in tiles of at most ChunkSize() columns and write
+            directly into the matching columns of a preallocated output.  See ParameterizedFunctionBase::SetChunkSize.
+        */
+        void LogDeterminantChunked(StridedMatrix<const double, MemorySpace> const& pts,
+                                   StridedVector<double, MemorySpace>              output);
+
+        void InverseChunked(StridedMatrix<const double, MemorySpace> const& x1,
+                            StridedMatrix<const double, MemorySpace> const& r,
+                            StridedMatrix<double, MemorySpace>              output);
+
+        void InverseWithGuessChunked(StridedMatrix<const double, MemorySpace> const& x1,
+                                     StridedMatrix<const double, MemorySpace> const& r,
+                                     StridedMatrix<const double, MemorySpace> const& x2Guess,
+                                     StridedMatrix<double, MemorySpace>              bracketWidths,
+                                     StridedMatrix<double, MemorySpace>              output);
+
+        void LogDeterminantCoeffGradChunked(StridedMatrix<const double, MemorySpace> const& pts,
+                                            StridedMatrix<double, MemorySpace>              output);
+
+        void LogDeterminantInputGradChunked(StridedMatrix<const double, MemorySpace> const& pts,
+                                            StridedMatrix<double, MemorySpace>              output);
+
 
 #if defined(MPART_HAS_CEREAL)
     // Define a serialize or save/load pair as you normally would
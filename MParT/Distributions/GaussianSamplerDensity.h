@@ -4,6 +4,7 @@
 #include <Kokkos_Core.hpp>
 #include "MParT/Distributions/Distribution.h"
 #include "MParT/Utilities/LinearAlgebra.h"
+#include "MParT/Utilities/CounterRNG.h"
 
 namespace mpart {
 
@@ -17,6 +18,17 @@ template<typename MemorySpace>
 class GaussianSamplerDensity: public SampleGenerator<MemorySpace>, public DensityBase<MemorySpace> {
     public:
 
+    /** @brief The random number generators that can be used to draw samples.
+        @details `Pool` draws from the Kokkos random pool in SampleGenerator.  `Counter` uses the stateless Philox4x32
+        generator, where the normal random variables in dimension \f$i\f$ of sample \f$j\f$ only depend on the seed and
+        on \f$(i,j)\f$.  Counter based sampling does not need to lock the random pool and gives the same samples for any
+        number of threads.
+    */
+    enum class RNGTypes {
+        Pool,
+        Counter
+    };
+
     GaussianSamplerDensity() = delete;
 
     /**
@@ -49,18 +61,53 @@ class GaussianSamplerDensity: public SampleGenerator<MemorySpace>, public Densit
     GaussianSamplerDensity(unsigned int dim);
 
     void SampleImpl(StridedMatrix<double, MemorySpace> output) override;
+
+    /**
+     * @brief Set the seed of the random pool and restart the counter based generator from the first sample
+     *
+     * @param seed new seed to set
+     */
+    void SetSeed(unsigned int seed) override;
+
+    /**
+     * @brief Choose the random number generator used by SampleImpl
+     *
+     * @param type The generator to use.  Defaults to RNGTypes::Pool.
+     */
+    void SetRNGType(RNGTypes type) { rngType_ = type; }
+
+    /** Returns the random number generator used by SampleImpl. */
+    RNGTypes GetRNGType() const { return rngType_; }
     void LogDensityInputGradImpl(StridedMatrix<const double, MemorySpace> const &pts, StridedMatrix<double, MemorySpace> output) override;
     void LogDensityImpl(StridedMatrix<const double, MemorySpace> const &pts, StridedVector<double, MemorySpace> output) override;
 
     unsigned int Dim() const override { return dim_; };
 
+    /**
+     * @brief Whether this distribution has an identity covariance, in which case its density factorizes over dimensions
+     *
+     * @return true if the covariance is the identity matrix
+     */
+    bool HasIdentityCovariance() const { return idCov_; }
+
+    /**
+     * @brief Get the mean of the distribution
+     *
+     * @return StridedVector<double, MemorySpace> The mean, or an empty view if the distribution has zero mean
+     */
+    StridedVector<double, MemorySpace> Mean() const { return mean_; }
+
     protected:
     using GeneratorType = typename SampleGenerator<MemorySpace>::PoolType::generator_type;
     using SampleGenerator<MemorySpace>::rand_pool;
     using SampleGenerator<MemorySpace>::dim_;
+    using SampleGenerator<MemorySpace>::seed_;
 
     private:
 
+    /** Fills `output` with independent standard normal samples using the current RNGTypes. */
+    void SampleStandardNormal(StridedMatrix<double, MemorySpace> output);
+
 #if (KOKKOS_VERSION / 10000 < 4)
 
 #if (KOKKOS_VERSION / 10000 == 3) && (KOKKOS_VERSION / 100 % 100 > 5)
@@ -83,6 +130,11 @@ class GaussianSamplerDensity: public SampleGenerator<MemorySpace>, public Densit
     mpart::Cholesky<MemorySpace> covChol_;
     bool idCov_ = false;
     double logDetCov_ = 0.;
+
+    RNGTypes rngType_ = RNGTypes::Pool;
+
+    /// The index of the next sample drawn by the counter based generator, so that consecutive calls to SampleImpl return different samples
+    uint64_t sampleCounter_ = 0;
 };
 
 template<typename MemorySpace, typename... T>
@@ -0,0 +1,83 @@
+#ifndef MPART_HaltonSampleGenerator_H
+#define MPART_HaltonSampleGenerator_H
+
+#include <Kokkos_Core.hpp>
+#include "MParT/Distributions/SampleGenerator.h"
+
+#include <cstdint>
+
+namespace mpart {
+
+/**
+ * @brief Generates quasi-Monte Carlo samples from the Halton low discrepancy sequence.
+ * @details Coordinate \f$i\f$ of point \f$j\f$ is the radical inverse of \f$j\f$ in the base given by the \f$i^{th}\f$ prime
+ *          number.  Every point is computed directly from its index, so the samples are generated in parallel and successive
+ *          calls to SampleImpl continue the sequence.  Any number of points can be skipped with Skip.  Unlike
+ *          SobolSampleGenerator, there is no limit on the dimension.
+ *
+ *          By default, the digits are randomized with a nested (Owen) scramble: the permutation applied to each digit is a
+ *          random affine map modulo the base that depends on the seed, the dimension, and all of the more significant digits.
+ *          This removes the correlations between the coordinates with large bases that make the plain Halton sequence poor
+ *          in high dimensions.  The points are then mapped to a standard normal distribution with the inverse normal CDF,
+ *          or kept uniform on \f$[0,1]^d\f$ with `gaussian=false`.  Enough digits are used that each coordinate is the center of
+ *          an interval of width at most \f$2^{-32}\f$, so the inverse CDF is always finite.
+ *
+ * @tparam MemorySpace Where the samples will be stored
+ */
+template<typename MemorySpace>
+class HaltonSampleGenerator: public SampleGenerator<MemorySpace> {
+    public:
+
+    HaltonSampleGenerator() = delete;
+
+    /**
+     * @brief Construct a new Halton sample generator
+     *
+     * @param dim dimension of the samples
+     * @param gaussian whether to map the points to a standard normal distribution (true) or keep them uniform on \f$[0,1]^d\f$ (false)
+     * @param scramble whether to apply an Owen scramble to the digits of the points
+     * @param seed seed for the scramble
+     */
+    HaltonSampleGenerator(unsigned int dim, bool gaussian = true, bool scramble = true, unsigned int seed = time(NULL));
+
+    void SampleImpl(StridedMatrix<double, MemorySpace> output) override;
+
+    /**
+     * @brief Set the seed of the scramble and restart the sequence from the first point
+     *
+     * @param seed new seed to set
+     */
+    void SetSeed(unsigned int seed) override;
+
+    /**
+     * @brief Skip ahead in the sequence without generating any points
+     *
+     * @param numSamples number of points to skip
+     */
+    void Skip(uint64_t numSamples) { sampleCounter_ += numSamples; }
+
+    /** Returns the index in the sequence of the next point returned by SampleImpl. */
+    uint64_t NextIndex() const { return sampleCounter_; }
+
+    protected:
+    using SampleGenerator<MemorySpace>::dim_;
+    using SampleGenerator<MemorySpace>::seed_;
+
+    private:
+
+    /// The prime base of each dimension
+    Kokkos::View<uint32_t*, MemorySpace> bases_;
+
+    /// The number of digits computed in each dimension
+    Kokkos::View<unsigned int*, MemorySpace> numDigits_;
+
+    const bool gaussian_;
+    const bool scramble_;
+
+    /// The index of the next point in the sequence
+    uint64_t sampleCounter_ = 0;
+};
+
+} // namespace mpart
+
+#endif //MPART_HaltonSampleGenerator_H
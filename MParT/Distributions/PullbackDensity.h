@@ -52,6 +52,18 @@ class PullbackDensity: public DensityBase<MemorySpace> {
      */
     void LogDensityCoeffGradImpl(StridedMatrix<const double, MemorySpace> const &pts, StridedMatrix<double, MemorySpace> output);
 
+    /**
+     * @brief Computes the log density and its derivative with respect to the coefficients of the map together.
+     * @details Equivalent to calling LogDensityImpl and LogDensityCoeffGradImpl, but the map is only traversed twice
+     * using ConditionalMapBase::ForwardPassImpl: once for the map output and log determinant, and once for their coefficient
+     * gradients, which depend on the gradient of the density at the map output.
+     *
+     * @param pts data matrix where each column is identically distributed according to \f$\mu\f$
+     * @param logDensity N-length vector to store the log density evaluation
+     * @param coeffGrad memory to place the derivative of the pullback action on pts w.r.t. the parameters of the map
+     */
+    void LogDensityAndCoeffGradImpl(StridedMatrix<const double, MemorySpace> const &pts, StridedVector<double, MemorySpace> logDensity, StridedMatrix<double, MemorySpace> coeffGrad);
+
     /**
      * @brief The derivative of the pullback distribution density with respect to the parameters (i.e. coefficients) of the map
      *
@@ -69,6 +81,9 @@ class PullbackDensity: public DensityBase<MemorySpace> {
     Eigen::RowMatrixXd LogDensityCoeffGrad(Eigen::Ref<const Eigen::RowMatrixXd> const &pts);
 
     private:
+    /** @brief Number of points processed at once, which follows the chunk size of the map (see ParameterizedFunctionBase::SetChunkSize). */
+    unsigned int TileSize(unsigned int numPts) const;
+
     /**
      * @brief The map T that pushes \f$\mu\f$ to \f$\nu\f$.
      *
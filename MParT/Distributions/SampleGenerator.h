@@ -25,7 +25,7 @@ class SampleGenerator {
      * @param dim  dimension of the distribution
      * @param seed what seed to initialize the random pool with
      */
-    SampleGenerator(unsigned int dim, unsigned int seed = time(NULL)) : dim_(dim), rand_pool(seed) {};
+    SampleGenerator(unsigned int dim, unsigned int seed = time(NULL)) : dim_(dim), seed_(seed), rand_pool(seed) {};
 
     virtual ~SampleGenerator() = default;
 
@@ -53,6 +53,7 @@ class SampleGenerator {
      * @param seed new seed to set for the pool
      */
     virtual void SetSeed(unsigned int seed) {
+        seed_ = seed;
         rand_pool = PoolType(seed);
     }
 
@@ -74,6 +75,12 @@ class SampleGenerator {
      */
     const unsigned int dim_;
 
+    /**
+     * @brief The seed most recently used to initialize the random pool
+     *
+     */
+    unsigned int seed_;
+
     /**
      * @brief Pool containing RNGs for internal random sampling
      *
@@ -0,0 +1,80 @@
+#ifndef MPART_SobolSampleGenerator_H
+#define MPART_SobolSampleGenerator_H
+
+#include <Kokkos_Core.hpp>
+#include "MParT/Distributions/SampleGenerator.h"
+
+#include <cstdint>
+
+namespace mpart {
+
+/**
+ * @brief Generates quasi-Monte Carlo samples from the Sobol' low discrepancy sequence.
+ * @details Point \f$j\f$ of the sequence is computed directly from its index with the Gray code construction of Antonov
+ *          and Saleev, so the samples are generated in parallel and successive calls to SampleImpl continue the sequence.
+ *          Any number of points can be skipped with Skip.  The direction numbers are those of S. Joe and F. Y. Kuo (2008).
+ *
+ *          By default, the points are randomized with a hash based nested uniform (Owen) scramble that depends on the seed
+ *          and are mapped to a standard normal distribution with the inverse normal CDF.  With `gaussian=false`, the
+ *          samples are uniform on \f$[0,1]^d\f$.  Each coordinate is the center of one of the \f$2^{32}\f$ dyadic intervals
+ *          of the unit interval, so the inverse CDF is always finite.
+ *
+ * @tparam MemorySpace Where the samples will be stored
+ */
+template<typename MemorySpace>
+class SobolSampleGenerator: public SampleGenerator<MemorySpace> {
+    public:
+
+    /// The largest dimension supported by the tabulated direction numbers
+    static constexpr unsigned int MaxDim = 21;
+
+    SobolSampleGenerator() = delete;
+
+    /**
+     * @brief Construct a new Sobol' sample generator
+     *
+     * @param dim dimension of the samples, at most MaxDim
+     * @param gaussian whether to map the points to a standard normal distribution (true) or keep them uniform on \f$[0,1]^d\f$ (false)
+     * @param scramble whether to apply an Owen scramble to the points
+     * @param seed seed for the scramble
+     */
+    SobolSampleGenerator(unsigned int dim, bool gaussian = true, bool scramble = true, unsigned int seed = time(NULL));
+
+    void SampleImpl(StridedMatrix<double, MemorySpace> output) override;
+
+    /**
+     * @brief Set the seed of the scramble and restart the sequence from the first point
+     *
+     * @param seed new seed to set
+     */
+    void SetSeed(unsigned int seed) override;
+
+    /**
+     * @brief Skip ahead in the sequence without generating any points
+     *
+     * @param numSamples number of points to skip
+     */
+    void Skip(uint64_t numSamples) { sampleCounter_ += numSamples; }
+
+    /** Returns the index in the sequence of the next point returned by SampleImpl. */
+    uint64_t NextIndex() const { return sampleCounter_; }
+
+    protected:
+    using SampleGenerator<MemorySpace>::dim_;
+    using SampleGenerator<MemorySpace>::seed_;
+
+    private:
+
+    /// Direction numbers \f$v_{k,d}\f$ in a \f$32\times d\f$ matrix
+    Kokkos::View<uint32_t**, Kokkos::LayoutLeft, MemorySpace> directions_;
+
+    const bool gaussian_;
+    const bool scramble_;
+
+    /// The index of the next point in the sequence
+    uint64_t sampleCounter_ = 0;
+};
+
+} // namespace mpart
+
+#endif //MPART_SobolSampleGenerator_H
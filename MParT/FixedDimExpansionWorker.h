@@ -0,0 +1,335 @@
+#ifndef MPART_FIXEDDIMEXPANSIONWORKER_H
+#define MPART_FIXEDDIMEXPANSIONWORKER_H
+
+#include <Kokkos_Core.hpp>
+
+#include "MParT/MultivariateExpansionWorker.h"
+
+#include <algorithm>
+#include <cassert>
+#include <sstream>
+#include <stdexcept>
+
+namespace mpart{
+
+/** Largest input dimension for which MapFactory::CreateComponent will construct a FixedDimExpansionWorker. */
+constexpr unsigned int FixedDimMaxInputDim = 8;
+
+/** Maximum polynomial degree supported by the FixedDimExpansionWorker instances created in MapFactory::CreateComponent. */
+constexpr unsigned int FixedDimMaxOrder = 4;
+
+/**
+ @brief A MultivariateExpansionWorker whose input dimension and maximum degree are known at compile time.
+
+ @details This class provides the same interface as MultivariateExpansionWorker and can be used as the expansion type of a
+ MonotoneComponent.  Every dimension reserves `MaxOrder+1` entries in the cache, so the cache layout and all loop bounds are
+ compile-time constants.  The multi-index set is stored densely, i.e., each term stores the degree in every dimension,
+ so evaluating a term is a product with a fixed number of factors that the compiler can fully unroll.  The first entry of
+ each block in the cache is overwritten with \f$1\f$ (or \f$0\f$ for derivatives) so that zero degrees do not contribute to
+ a term, matching the sparse traversal in MultivariateExpansionWorker.
+
+ @tparam Dim The input dimension of the expansion.
+ @tparam MaxOrder An upper bound on the degree in any one dimension.
+ @tparam BasisEvaluatorType The family of 1d basis functions to employ.  Rectified bases are not supported.
+ */
+template<unsigned int Dim, unsigned int MaxOrder, class BasisEvaluatorType, typename MemorySpace=Kokkos::HostSpace>
+class FixedDimExpansionWorker
+{
+public:
+    using BasisType = BasisEvaluatorType;
+    using KokkosSpace = MemorySpace;
+    using Rectifier = typename GetRectifier<BasisEvaluatorType>::type;
+
+    static_assert(Dim>0, "FixedDimExpansionWorker requires a positive input dimension.");
+    static_assert(std::is_same_v<Rectifier,Identity>, "FixedDimExpansionWorker does not support rectified bases.");
+
+    /// Number of cache entries reserved for each dimension
+    static constexpr unsigned int NumOrders = MaxOrder+1;
+
+    FixedDimExpansionWorker() : multiSet_(FixedMultiIndexSet<MemorySpace>(1,0)), numTerms_(0){};
+
+    FixedDimExpansionWorker(MultiIndexSet const& multiSet,
+                            BasisEvaluatorType const& basis1d = BasisEvaluatorType()) : FixedDimExpansionWorker(multiSet.Fix(), basis1d){};
+
+    FixedDimExpansionWorker(FixedMultiIndexSet<MemorySpace> const& multiSet,
+                            BasisEvaluatorType const& basis1d = BasisEvaluatorType()) : multiSet_(multiSet),
+                                                                                        basis1d_(basis1d)
+    {
+        SetupOrders();
+    };
+
+    /** Returns true if the multiindex set has dimension `Dim` and no degree larger than `MaxOrder`. */
+    static bool Supports(FixedMultiIndexSet<MemorySpace> const& multiSet)
+    {
+        if(multiSet.Length()!=Dim)
+            return false;
+        return MaxDegree(multiSet) <= MaxOrder;
+    }
+
+    /** Returns the largest degree in any dimension of a multiindex set. */
+    static unsigned int MaxDegree(FixedMultiIndexSet<MemorySpace> const& multiSet)
+    {
+        FixedMultiIndexSet<MemorySpace> setCopy = multiSet;
+        FixedMultiIndexSet<Kokkos::HostSpace> hostSet = setCopy.template ToDevice<Kokkos::HostSpace>();
+        auto maxDegrees = hostSet.MaxDegrees();
+        return *std::max_element(maxDegrees.data(), maxDegrees.data()+maxDegrees.extent(0));
+    }
+
+    /** Converts this worker to a general MultivariateExpansionWorker with the same terms and basis. */
+    operator MultivariateExpansionWorker<BasisEvaluatorType, MemorySpace>() const
+    {
+        return MultivariateExpansionWorker<BasisEvaluatorType, MemorySpace>(multiSet_, basis1d_);
+    }
+
+    KOKKOS_INLINE_FUNCTION unsigned int CacheSize() const {return (2*Dim+1)*NumOrders;};
+
+    KOKKOS_INLINE_FUNCTION unsigned int Cache1Size() const {return (Dim-1)*NumOrders;};
+
+    KOKKOS_INLINE_FUNCTION unsigned int DiagonalTableSize() const {return 3*NumOrders;};
+
+    KOKKOS_INLINE_FUNCTION unsigned int NumCoeffs() const {return numTerms_;};
+
+    KOKKOS_INLINE_FUNCTION unsigned int InputSize() const {return Dim;};
+
+    /** @brief Precomputes the parts of the cache that only depend on \f$x_1,\ldots,x_{d-1}\f$.  See MultivariateExpansionWorker::FillCache1. */
+    template<typename PointType>
+    KOKKOS_FUNCTION void FillCache1(double*          polyCache,
+                                    PointType const& pt,
+                                    DerivativeFlags::DerivativeType derivType) const
+    {
+        if((derivType == DerivativeFlags::Input)||(derivType==DerivativeFlags::MixedInput)){
+            for(unsigned int d=0; d<Dim-1; ++d){
+                basis1d_.EvaluateDerivatives(d, &polyCache[d*NumOrders], &polyCache[(Dim+d)*NumOrders], MaxOrder, pt(d));
+                polyCache[d*NumOrders] = 1.0;
+                polyCache[(Dim+d)*NumOrders] = 0.0;
+            }
+        }else{
+            for(unsigned int d=0; d<Dim-1; ++d){
+                basis1d_.EvaluateAll(d, &polyCache[d*NumOrders], MaxOrder, pt(d));
+                polyCache[d*NumOrders] = 1.0;
+            }
+        }
+    }
+
+    /** @brief Precomputes the parts of the cache that depend on \f$x_d\f$.  See MultivariateExpansionWorker::FillCache2. */
+    template<typename PointType>
+    KOKKOS_FUNCTION void FillCache2(double*          polyCache,
+                                    PointType const&,
+                                    double           xd,
+                                    DerivativeFlags::DerivativeType derivType) const
+    {
+        if((derivType==DerivativeFlags::None)||(derivType==DerivativeFlags::Parameters)){
+            basis1d_.EvaluateAll(Dim-1, &polyCache[(Dim-1)*NumOrders], MaxOrder, xd);
+
+        }else if((derivType==DerivativeFlags::Diagonal) || (derivType==DerivativeFlags::Input) || (derivType==DerivativeFlags::MixedCoeff)){
+            basis1d_.EvaluateDerivatives(Dim-1, &polyCache[(Dim-1)*NumOrders], &polyCache[(2*Dim-1)*NumOrders], MaxOrder, xd);
+            polyCache[(2*Dim-1)*NumOrders] = 0.0;
+
+        }else if((derivType==DerivativeFlags::Diagonal2) || (derivType==DerivativeFlags::MixedInput)){
+            basis1d_.EvaluateSecondDerivatives(Dim-1, &polyCache[(Dim-1)*NumOrders], &polyCache[(2*Dim-1)*NumOrders], &polyCache[2*Dim*NumOrders], MaxOrder, xd);
+            polyCache[(2*Dim-1)*NumOrders] = 0.0;
+            polyCache[2*Dim*NumOrders] = 0.0;
+        }
+        polyCache[(Dim-1)*NumOrders] = 1.0;
+    }
+
+    /** @brief Evaluates the last-dimension basis and its first two derivatives at \f$x_d\f$.  See MultivariateExpansionWorker::FillDiagonalTable. */
+    KOKKOS_FUNCTION void FillDiagonalTable(double* table, double xd) const
+    {
+        basis1d_.EvaluateSecondDerivatives(Dim-1, table, &table[NumOrders], &table[2*NumOrders], MaxOrder, xd);
+        table[0] = 1.0;
+        table[NumOrders] = 0.0;
+        table[2*NumOrders] = 0.0;
+    }
+
+    /** @brief Fills the \f$x_d\f$-dependent parts of the cache from a table.  See MultivariateExpansionWorker::CopyDiagonalTable. */
+    KOKKOS_FUNCTION void CopyDiagonalTable(double*                         polyCache,
+                                           const double*                   table,
+                                           DerivativeFlags::DerivativeType derivType) const
+    {
+        for(unsigned int i=0; i<NumOrders; ++i)
+            polyCache[(Dim-1)*NumOrders+i] = table[i];
+
+        if((derivType==DerivativeFlags::None)||(derivType==DerivativeFlags::Parameters))
+            return;
+
+        for(unsigned int i=0; i<NumOrders; ++i)
+            polyCache[(2*Dim-1)*NumOrders+i] = table[NumOrders+i];
+
+        if((derivType==DerivativeFlags::Diagonal2) || (derivType==DerivativeFlags::MixedInput)){
+            for(unsigned int i=0; i<NumOrders; ++i)
+                polyCache[2*Dim*NumOrders+i] = table[2*NumOrders+i];
+        }
+    }
+
+    template<typename CoeffVecType>
+    KOKKOS_FUNCTION double Evaluate(const double* polyCache, CoeffVecType const& coeffs) const
+    {
+        double output = 0.0;
+        for(unsigned int termInd=0; termInd<numTerms_; ++termInd)
+            output += OffdiagProduct(termInd, polyCache) * polyCache[(Dim-1)*NumOrders + orders_(termInd*Dim+Dim-1)] * coeffs(termInd);
+
+        return output;
+    }
+
+    template<typename CoeffVecType>
+    KOKKOS_FUNCTION double DiagonalDerivative(const double* polyCache, CoeffVecType const& coeffs, unsigned int derivOrder) const
+    {
+        if((derivOrder==0)||(derivOrder>2)){
+            assert((derivOrder==1)||(derivOrder==2));
+        }
+
+        const unsigned int posIndex = 2*Dim+derivOrder-2;
+
+        double output = 0.0;
+        for(unsigned int termInd=0; termInd<numTerms_; ++termInd)
+            output += OffdiagProduct(termInd, polyCache) * polyCache[posIndex*NumOrders + orders_(termInd*Dim+Dim-1)] * coeffs(termInd);
+
+        return output;
+    }
+
+    template<typename CoeffVecType, typename GradVecType>
+    KOKKOS_FUNCTION double CoeffDerivative(const double* polyCache, CoeffVecType const& coeffs, GradVecType& grad) const
+    {
+        double f = 0.0;
+        for(unsigned int termInd=0; termInd<numTerms_; ++termInd){
+            const double termVal = OffdiagProduct(termInd, polyCache) * polyCache[(Dim-1)*NumOrders + orders_(termInd*Dim+Dim-1)];
+            f += termVal*coeffs(termInd);
+            grad(termInd) = termVal;
+        }
+        return f;
+    }
+
+    template<typename CoeffVecType, typename GradVecType>
+    KOKKOS_FUNCTION double InputDerivative(const double* polyCache, CoeffVecType const& coeffs, GradVecType& grad) const
+    {
+        double f = 0.0;
+        for(unsigned int wrt=0; wrt<Dim; ++wrt)
+            grad(wrt) = 0.0;
+
+        for(unsigned int termInd=0; termInd<numTerms_; ++termInd){
+            const unsigned int* orders = &orders_(termInd*Dim);
+
+            f += ProductExcept(Dim, orders, polyCache) * coeffs(termInd);
+
+            for(unsigned int wrt=0; wrt<Dim; ++wrt)
+                grad(wrt) += ProductExcept(wrt, orders, polyCache) * polyCache[(Dim+wrt)*NumOrders + orders[wrt]] * coeffs(termInd);
+        }
+        return f;
+    }
+
+    template<typename CoeffVecType, typename GradVecType>
+    KOKKOS_FUNCTION double MixedInputDerivative(const double* polyCache, CoeffVecType const& coeffs, GradVecType& grad) const
+    {
+        double df = 0.0;
+        for(unsigned int wrt=0; wrt<Dim; ++wrt)
+            grad(wrt) = 0.0;
+
+        for(unsigned int termInd=0; termInd<numTerms_; ++termInd){
+            const unsigned int* orders = &orders_(termInd*Dim);
+            const double diagDeriv = polyCache[(2*Dim-1)*NumOrders + orders[Dim-1]];
+
+            df += ProductExcept(Dim-1, orders, polyCache) * diagDeriv * coeffs(termInd);
+
+            for(unsigned int wrt=0; wrt<Dim-1; ++wrt)
+                grad(wrt) += ProductExcept(wrt, orders, polyCache, Dim-1) * polyCache[(Dim+wrt)*NumOrders + orders[wrt]] * diagDeriv * coeffs(termInd);
+
+            grad(Dim-1) += ProductExcept(Dim-1, orders, polyCache) * polyCache[2*Dim*NumOrders + orders[Dim-1]] * coeffs(termInd);
+        }
+        return df;
+    }
+
+    template<typename CoeffVecType, typename GradVecType>
+    KOKKOS_FUNCTION double MixedCoeffDerivative(const double* cache, CoeffVecType const& coeffs, unsigned int derivOrder, GradVecType& grad) const
+    {
+        if((derivOrder==0)||(derivOrder>2)){
+            assert((derivOrder==1) || (derivOrder==2));
+        }
+
+        const unsigned int posIndex = 2*Dim+derivOrder-2;
+
+        double df = 0.0;
+        for(unsigned int termInd=0; termInd<numTerms_; ++termInd){
+            const double termVal = OffdiagProduct(termInd, cache) * cache[posIndex*NumOrders + orders_(termInd*Dim+Dim-1)];
+            df += termVal*coeffs(termInd);
+            grad(termInd) = termVal;
+        }
+        return df;
+    }
+
+    FixedMultiIndexSet<MemorySpace> GetMultiIndexSet() const { return multiSet_; }
+
+    std::vector<unsigned int> NonzeroDiagonalEntries() const { return multiSet_.NonzeroDiagonalEntries(); }
+
+#if defined(MPART_HAS_CEREAL)
+    template<typename Archive>
+    void save(Archive& ar) const{
+        ar(multiSet_, basis1d_);
+    }
+
+    template<typename Archive>
+    void load(Archive& ar) {
+        ar(multiSet_, basis1d_);
+        SetupOrders();
+    }
+#endif // MPART_HAS_CEREAL
+
+private:
+
+    /** Stores the degree of every term in every dimension in the dense `orders_` array. */
+    void SetupOrders()
+    {
+        if(!Supports(multiSet_)){
+            std::stringstream msg;
+            msg << "FixedDimExpansionWorker<" << Dim << "," << MaxOrder << "> cannot represent a multiindex set with dimension "
+                << multiSet_.Length() << " and maximum degree " << MaxDegree(multiSet_) << ".";
+            throw std::invalid_argument(msg.str());
+        }
+
+        FixedMultiIndexSet<MemorySpace> setCopy = multiSet_;
+        FixedMultiIndexSet<Kokkos::HostSpace> hostSet = setCopy.template ToDevice<Kokkos::HostSpace>();
+
+        numTerms_ = hostSet.Size();
+        Kokkos::View<unsigned int*, Kokkos::HostSpace> hostOrders("Dense Orders", numTerms_*Dim);
+        for(unsigned int termInd=0; termInd<numTerms_; ++termInd){
+            std::vector<unsigned int> multi = hostSet.IndexToMulti(termInd);
+            for(unsigned int d=0; d<Dim; ++d)
+                hostOrders(termInd*Dim + d) = multi.at(d);
+        }
+
+        orders_ = Kokkos::View<unsigned int*, MemorySpace>("Dense Orders", numTerms_*Dim);
+        Kokkos::deep_copy(orders_, hostOrders);
+    }
+
+    /** Product of the basis values in the first \f$d-1\f$ dimensions for one term. */
+    KOKKOS_INLINE_FUNCTION double OffdiagProduct(unsigned int termInd, const double* polyCache) const
+    {
+        double termVal = 1.0;
+        for(unsigned int d=0; d<Dim-1; ++d)
+            termVal *= polyCache[d*NumOrders + orders_(termInd*Dim+d)];
+        return termVal;
+    }
+
+    /** Product of the basis values in the first `numDims` dimensions, skipping dimension `skip`. */
+    KOKKOS_INLINE_FUNCTION static double ProductExcept(unsigned int skip, const unsigned int* orders, const double* polyCache, unsigned int numDims=Dim)
+    {
+        double termVal = 1.0;
+        for(unsigned int d=0; d<numDims; ++d){
+            if(d!=skip)
+                termVal *= polyCache[d*NumOrders + orders[d]];
+        }
+        return termVal;
+    }
+
+    FixedMultiIndexSet<MemorySpace> multiSet_;
+    BasisEvaluatorType basis1d_;
+
+    /// Degree of term i in dimension d, stored at index i*Dim+d
+    Kokkos::View<unsigned int*, MemorySpace> orders_;
+    unsigned int numTerms_;
+
+}; // class FixedDimExpansionWorker
+
+} // namespace mpart
+
+#endif // #ifndef MPART_FIXEDDIMEXPANSIONWORKER_H
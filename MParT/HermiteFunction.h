@@ -141,6 +141,9 @@ public:
         }
     }
 
+    /** Returns true if both objects evaluate the same functions. */
+    bool operator==(HermiteFunction const& other) const {return polyBase==other.polyBase;}
+
 #if defined(MPART_HAS_CEREAL)
 
     template <class Archive>
@@ -145,6 +145,9 @@ public:
         }
     }
 
+    /** Returns true if both objects evaluate the same functions. */
+    bool operator==(LinearizedBasis const& other) const {return (polyBasis_==other.polyBasis_) && (lb_==other.lb_) && (ub_==other.ub_);}
+
 #if defined(MPART_HAS_CEREAL)
 
     template <class Archive>
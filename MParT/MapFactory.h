@@ -29,6 +29,7 @@ namespace mpart{
     options.quadMaxSub = 10;                            // Optional. Default = 30
     options.contDeriv = true;                           // Optional. Default = true
     options.nugget = 1e-4;                              // Optional. Default = 0.0
+    options.fixedDimWorker = true;                      // Optional. Default = false
 
     // Create a triangular map with these options
     unsigned int inDim = 4;
@@ -49,6 +50,17 @@ namespace mpart{
         std::shared_ptr<ConditionalMapBase<MemorySpace>> CreateComponent(FixedMultiIndexSet<MemorySpace> const& mset,
                                                                          MapOptions options = MapOptions());
 
+        /**
+        @brief Creates the same component as CreateComponent, but without allocating its coefficients.
+        @details The coefficients of the returned component must be set with SetCoeffs or WrapCoeffs before it is evaluated.
+                 This avoids allocating and zeroing a coefficient vector that would be replaced immediately, e.g., when the
+                 component wraps coefficients stored elsewhere.
+        @param mset The multiindex set specifying which terms should be used in the multivariate expansion.
+        */
+        template<typename MemorySpace>
+        std::shared_ptr<ConditionalMapBase<MemorySpace>> CreateComponentWithoutCoeffs(FixedMultiIndexSet<MemorySpace> const& mset,
+                                                                                      MapOptions options = MapOptions());
+
         /**
             @brief Creates a square triangular map that is an identity in all but one output dimension
 
@@ -219,6 +231,37 @@ namespace mpart{
                     map = std::make_shared<FactoryMapType>();
                 return map;
             }
+
+            /** Key for components built with a FixedDimExpansionWorker.  The last two entries are the input dimension and
+                the maximum degree supported by the worker.
+            */
+            typedef std::tuple<BasisTypes, bool, PosFuncTypes, QuadTypes, unsigned int, unsigned int> FixedDimKeyType;
+            typedef std::map<FixedDimKeyType, FactoryFunctionType> FixedDimFactoryMapType;
+
+            /** Returns the factory function for a FixedDimExpansionWorker-based component matching the options, dimension,
+                and maximum degree, or an empty function if no such component has been registered.
+            */
+            static FactoryFunctionType GetFixedDimFactoryFunction(MapOptions opts, unsigned int dim, unsigned int maxOrder)
+            {
+                bool isLinearized = (!isinf(opts.basisLB)) ||(!isinf(opts.basisUB));
+                FixedDimKeyType optionsKey(opts.basisType, isLinearized, opts.posFuncType, opts.quadType, dim, maxOrder);
+
+                auto factoryMap = GetFixedDimFactoryMap();
+
+                auto iter = factoryMap->find(optionsKey);
+                if(iter == factoryMap->end())
+                    return FactoryFunctionType();
+
+                return iter->second;
+            }
+
+            static std::shared_ptr<FixedDimFactoryMapType> GetFixedDimFactoryMap()
+            {
+                static std::shared_ptr<FixedDimFactoryMapType> map;
+                if( !map )
+                    map = std::make_shared<FixedDimFactoryMapType>();
+                return map;
+            }
         };
 
     }
@@ -5,6 +5,7 @@
 #include "Distributions/PullbackDensity.h"
 #include "Utilities/ArrayConversions.h"
 #include "Utilities/LinearAlgebra.h"
+#include "Utilities/MappedDataset.h"
 #include "Distributions/GaussianSamplerDensity.h"
 
 namespace mpart {
@@ -15,6 +16,11 @@ namespace mpart {
  * It provides facilities to use a training dataset as well as an optional testing dataset, and provides the functionality \f$F(T(\cdot;\theta);\mathcal{S})\f$ and
  * \f$\nabla_\theta F(T(\cdot;\theta);\mathcal{S})\f$, the gradient of the objective with respect to the map coefficients/parameters.
  *
+ * The datasets can either be held in memory or be stored in a MappedDataset file.  In the latter case, the training and testing
+ * objectives are evaluated by streaming blocks of samples from the file through `ObjectivePlusCoeffGradImpl` (or `ObjectiveImpl` and
+ * `CoeffGradImpl`) and averaging the block results, weighted by the number of samples in each block.  This is exact for objectives
+ * that are sample averages, such as KLObjective, and only requires one block of samples to be resident at a time.
+ *
  * @tparam MemorySpace Space where all data is stored
  */
 template<typename MemorySpace>
@@ -32,6 +38,30 @@ class MapObjective {
      */
     StridedMatrix<const double, MemorySpace> test_;
 
+    /**
+     * @brief File holding the training dataset, if the objective streams its training data
+     *
+     */
+    std::shared_ptr<MappedDataset> trainFile_;
+
+    /**
+     * @brief File holding the testing dataset, if the objective streams its testing data
+     *
+     */
+    std::shared_ptr<MappedDataset> testFile_;
+
+    /**
+     * @brief Number of leading rows of the dataset files that are used by this objective
+     *
+     */
+    unsigned int fileRows_ = 0;
+
+    /**
+     * @brief Maximum number of bytes of samples streamed from a dataset file at once (default 64 MiB)
+     *
+     */
+    std::size_t streamBlockBytes_ = std::size_t(64)*1024*1024;
+
     public:
     MapObjective() = delete;
 
@@ -50,6 +80,17 @@ class MapObjective {
      */
     MapObjective(StridedMatrix<const double, MemorySpace> train, StridedMatrix<const double, MemorySpace> test): train_(train), test_(test) {}
 
+    /**
+     * @brief Construct a new Map Objective object whose datasets are streamed from memory-mapped files
+     * @details In the host space, GetTrain and GetTest return views into the mapped files, so no samples are read until they are used.
+     *          In other memory spaces these views are empty and blocks of samples are copied to the device as they are streamed.
+     *
+     * @param train File containing the training dataset
+     * @param test Optional file containing the testing dataset
+     * @throws std::invalid_argument if `train` is null or the dimensions of the two files differ
+     */
+    MapObjective(std::shared_ptr<MappedDataset> train, std::shared_ptr<MappedDataset> test = nullptr);
+
     virtual ~MapObjective() = default;
 
     /**
@@ -63,9 +104,32 @@ class MapObjective {
      */
     double operator()(unsigned int n, const double* x, double* grad, std::shared_ptr<ConditionalMapBase<MemorySpace>> map);
 
-    unsigned int InputDim() const {return train_.extent(0);}
-    virtual unsigned int MapOutputDim() const {return train_.extent(0);}
-    unsigned int NumSamples() const {return train_.extent(1);}
+    unsigned int InputDim() const {return trainFile_ ? fileRows_ : train_.extent(0);}
+    virtual unsigned int MapOutputDim() const {return InputDim();}
+    unsigned int NumSamples() const {return trainFile_ ? trainFile_->NumSamples() : train_.extent(1);}
+
+    /**
+     * @brief Whether the training data of this objective is streamed from a MappedDataset
+     *
+     * @return true if the objective was constructed from dataset files
+     */
+    bool IsStreamed() const {return trainFile_ != nullptr;}
+
+    /**
+     * @brief Set the memory budget used when streaming samples from dataset files.
+     * @details Blocks of at most `bytes / (sizeof(double)*InputDim())` samples (and at least one sample) are passed to the objective at once.
+     *          This has no effect when the datasets are held in memory.
+     *
+     * @param bytes Maximum number of bytes of samples in each block
+     */
+    void SetStreamBlockBytes(std::size_t bytes) {streamBlockBytes_ = bytes;}
+
+    /**
+     * @brief Get the memory budget used when streaming samples from dataset files.
+     *
+     * @return std::size_t Maximum number of bytes of samples in each block
+     */
+    std::size_t GetStreamBlockBytes() const {return streamBlockBytes_;}
 
     /**
      * @brief Shortcut to calculate the error of the map on the training dataset
@@ -104,14 +168,28 @@ class MapObjective {
      *
      * @return StridedMatrix<const double, MemorySpace> Training data for optimization
      */
-    StridedMatrix<const double, MemorySpace> GetTrain() {return train_;}
+    StridedMatrix<const double, MemorySpace> GetTrain() const {return train_;}
 
     /**
      * @brief Get the Testing data for this objective
      *
      * @return StridedMatrix<const double, MemorySpace> Testing data for optimization
      */
-    StridedMatrix<const double, MemorySpace> GetTest() {return test_;}
+    StridedMatrix<const double, MemorySpace> GetTest() const {return test_;}
+
+    /**
+     * @brief Get the file the training data is streamed from
+     *
+     * @return std::shared_ptr<MappedDataset> Training data file, or null if the training data is held in memory
+     */
+    std::shared_ptr<MappedDataset> GetTrainFile() const {return trainFile_;}
+
+    /**
+     * @brief Get the file the testing data is streamed from
+     *
+     * @return std::shared_ptr<MappedDataset> Testing data file, or null if there is no testing data file
+     */
+    std::shared_ptr<MappedDataset> GetTestFile() const {return testFile_;}
 
     /**
      * @brief Objective value of map at data
@@ -144,6 +222,26 @@ class MapObjective {
         CoeffGradImpl(data, grad, map);
         return ObjectiveImpl(data, map);
     }
+
+    protected:
+    /**
+     * @brief Restrict the objective to the first `rows` rows of its datasets, without copying them
+     *
+     * @param rows Number of leading rows to keep
+     */
+    void RestrictRows(unsigned int rows);
+
+    private:
+    /**
+     * @brief Evaluates the objective and/or its coefficient gradient by streaming blocks of samples from a dataset file
+     *
+     * @param file File containing the dataset
+     * @param grad Storage for the gradient; skipped when the view has no data
+     * @param map Map to evaluate on
+     * @param computeObjective Whether the objective value should be computed
+     * @return double Objective value (zero if `computeObjective` is false)
+     */
+    double StreamObjective(std::shared_ptr<MappedDataset> const& file, StridedVector<double, MemorySpace> grad, std::shared_ptr<ConditionalMapBase<MemorySpace>> map, bool computeObjective) const;
 };
 
 /**
@@ -174,16 +272,97 @@ class KLObjective: public MapObjective<MemorySpace> {
      */
     KLObjective(StridedMatrix<const double, MemorySpace> train, StridedMatrix<const double, MemorySpace> test, std::shared_ptr<DensityBase<MemorySpace>> density): MapObjective<MemorySpace>(train, test), density_(density) {}
 
+    /**
+     * @brief Construct a new KLObjective object whose training (and optionally testing) data is streamed from memory-mapped files
+     *
+     * @param train File containing the dataset for training the map
+     * @param test Optional file containing the dataset for testing the map
+     * @param density Density \f$\mu\f$ to calculate the KL with respect to (i.e. \f$D(\cdot||\mu)\f$ )
+     */
+    KLObjective(std::shared_ptr<MappedDataset> train, std::shared_ptr<MappedDataset> test, std::shared_ptr<DensityBase<MemorySpace>> density): MapObjective<MemorySpace>(train, test), density_(density) {}
+
     double ObjectivePlusCoeffGradImpl(StridedMatrix<const double, MemorySpace> data, StridedVector<double, MemorySpace> grad, std::shared_ptr<ConditionalMapBase<MemorySpace>> map) const override;
     double ObjectiveImpl(StridedMatrix<const double, MemorySpace> data, std::shared_ptr<ConditionalMapBase<MemorySpace>> map) const override;
     void CoeffGradImpl(StridedMatrix<const double, MemorySpace> data, StridedVector<double, MemorySpace> grad, std::shared_ptr<ConditionalMapBase<MemorySpace>> map) const override;
     unsigned int MapOutputDim() const override {return density_->Dim();}
+
+    /**
+     * @brief Get the density \f$\mu\f$ the KL divergence is calculated with respect to
+     *
+     * @return std::shared_ptr<DensityBase<MemorySpace>> Reference density of this objective
+     */
+    std::shared_ptr<DensityBase<MemorySpace>> GetDensity() const {return density_;}
+
+    /**
+     * @brief Whether this objective splits into independent terms over the blocks of a triangular map.
+     * @details This holds when \f$\mu\f$ is a GaussianSamplerDensity with identity covariance, in which case the KL divergence of a
+     *          triangular map is the sum of the KL divergences of its components w.r.t. the marginals of \f$\mu\f$.
+     *
+     * @return true if MarginalObjective can be used to split this objective
+     */
+    bool IsSeparable() const;
+
+    /**
+     * @brief Construct the term of this objective belonging to one block of a triangular map.
+     * @details The block sees the first `inputDim` rows of the training (and testing) data and the marginal of \f$\mu\f$ over
+     *          outputs `[outputStart, outputStart+outputDim)`. The data is not copied.
+     *
+     * @param inputDim Input dimension of the block
+     * @param outputStart Index of the first output of the block in the full map
+     * @param outputDim Output dimension of the block
+     * @return std::shared_ptr<KLObjective<MemorySpace>> Objective of the block
+     * @throws std::runtime_error if the objective is not separable
+     */
+    std::shared_ptr<KLObjective<MemorySpace>> MarginalObjective(unsigned int inputDim, unsigned int outputStart, unsigned int outputDim) const;
+
+    /**
+     * @brief Set the memory budget used when accumulating the coefficient gradient.
+     * @details The gradient is accumulated over blocks of samples so that at most `bytes` bytes of per-sample
+     *          coefficient gradients (a `numCoeffs x blockSize` matrix) are allocated at once.
+     *
+     * @param bytes Maximum number of bytes to use for the per-block gradient matrix
+     */
+    void SetGradientBlockBytes(std::size_t bytes) {gradBlockBytes_ = bytes;}
+
+    /**
+     * @brief Get the memory budget used when accumulating the coefficient gradient.
+     *
+     * @return std::size_t Maximum number of bytes used for the per-block gradient matrix
+     */
+    std::size_t GetGradientBlockBytes() const {return gradBlockBytes_;}
+
     private:
+    /**
+     * @brief Number of samples processed per block given the number of map coefficients and the memory budget
+     *
+     * @param numPts Total number of samples
+     * @param numCoeffs Number of coefficients in the map
+     * @return unsigned int Number of samples in each block (at least one)
+     */
+    unsigned int GradBlockSize(unsigned int numPts, unsigned int numCoeffs) const;
+
+    /**
+     * @brief Accumulates the objective and (if `grad` is allocated) its coefficient gradient block-by-block over the samples
+     *
+     * @param data Dataset to take the objective and gradient over
+     * @param grad Storage for the gradient; skipped when the view has no data
+     * @param map Map to evaluate on
+     * @param computeObjective Whether the objective value should also be computed
+     * @return double Objective value (zero if `computeObjective` is false)
+     */
+    double StreamObjectiveAndGrad(StridedMatrix<const double, MemorySpace> data, StridedVector<double, MemorySpace> grad, std::shared_ptr<ConditionalMapBase<MemorySpace>> map, bool computeObjective) const;
+
     /**
      * @brief Density \f$\mu\f$ to calculate the KL with respect to (i.e. \f$D(\cdot||\mu)\f$ )
      *
      */
     std::shared_ptr<DensityBase<MemorySpace>> density_;
+
+    /**
+     * @brief Maximum number of bytes used to hold per-sample coefficient gradients at once (default 64 MiB)
+     *
+     */
+    std::size_t gradBlockBytes_ = std::size_t(64)*1024*1024;
 };
 
 namespace ObjectiveFactory {
@@ -192,6 +371,9 @@ std::shared_ptr<MapObjective<MemorySpace>> CreateGaussianKLObjective(StridedMatr
 
 template<typename MemorySpace>
 std::shared_ptr<MapObjective<MemorySpace>> CreateGaussianKLObjective(StridedMatrix<const double, MemorySpace> train, StridedMatrix<const double, MemorySpace> test, unsigned int dim=0);
+
+template<typename MemorySpace>
+std::shared_ptr<MapObjective<MemorySpace>> CreateGaussianKLObjective(std::shared_ptr<MappedDataset> train, std::shared_ptr<MappedDataset> test=nullptr, unsigned int dim=0);
 } // namespace ObjectiveFactory
 
 } // namespace mpart
@@ -1,10 +1,15 @@
 #ifndef MPART_MAPOPTIONS_H
 #define MPART_MAPOPTIONS_H
 
+#include <cstdint>
 #include <string>
 #include <sstream>
 #include <limits>
 
+#if defined(MPART_HAS_CEREAL)
+#include <cereal/cereal.hpp>
+#endif
+
 namespace mpart{
 
     enum class BasisTypes
@@ -17,14 +22,17 @@ namespace mpart{
     enum class PosFuncTypes
     {
         Exp,
-        SoftPlus
+        SoftPlus,
+        Square
     };
 
     enum class QuadTypes
     {
         ClenshawCurtis,
         AdaptiveSimpson,
-        AdaptiveClenshawCurtis
+        AdaptiveClenshawCurtis,
+        GaussLegendre,
+        AdaptiveGaussKronrod
     };
 
     enum class SigmoidTypes
@@ -74,7 +82,9 @@ namespace mpart{
 
 
         /** The type of positive bijector used inside the monotonicity-guaranteeing integral
-            formulation.
+            formulation.  With PosFuncTypes::Square and a polynomial basis that is not linearized,
+            the integral is computed exactly and the quadrature options are ignored.  A positive
+            nugget should be used with PosFuncTypes::Square to keep the component strictly monotone.
         */
         PosFuncTypes posFuncType = PosFuncTypes::SoftPlus;
 
@@ -82,13 +92,13 @@ namespace mpart{
         QuadTypes quadType = QuadTypes::AdaptiveSimpson;
 
 
-        /** The absolute tolerance used by adaptive quadrature rules like AdaptiveSimpson and
-            AdaptiveClenshawCurtis.
+        /** The absolute tolerance used by adaptive quadrature rules like AdaptiveSimpson,
+            AdaptiveClenshawCurtis, and AdaptiveGaussKronrod.
         */
         double quadAbsTol = 1e-6;
 
-        /** The relative tolerance used by adaptive quadrature rules like AdaptiveSimpson
-            and AdaptiveClenshawCurtis.
+        /** The relative tolerance used by adaptive quadrature rules like AdaptiveSimpson,
+            AdaptiveClenshawCurtis, and AdaptiveGaussKronrod.
         */
         double quadRelTol = 1e-6;
 
@@ -99,8 +109,8 @@ namespace mpart{
         unsigned int quadMinSub = 0;
 
 
-        /** The number of quadrature points used in fixed rules like the Clenshaw Curtis rule.
-            Also defines the base level used in the adaptive Clenshaw-Curtis rule.
+        /** The number of quadrature points used in fixed rules like the Clenshaw Curtis and Gauss-Legendre
+            rules.  Also defines the base level used in the adaptive Clenshaw-Curtis rule.
         */
         unsigned int quadPts = 5;
 
@@ -118,11 +128,23 @@ namespace mpart{
         /** The minimum slope of the monotone component.  This nugget is added to the g(df) integrand. Must be non-negative. */
         double nugget = 0.0;
 
+        /** If true, MapFactory::CreateComponent will use a FixedDimExpansionWorker, which is specialized at compile time
+            for the input dimension and maximum degree, when the multiindex set is small enough.  Otherwise the general
+            MultivariateExpansionWorker is used.
+        */
+        bool fixedDimWorker = false;
+
         #if defined(MPART_HAS_CEREAL)
+        /** Version 1 added fixedDimWorker, which is set to false when loading a version 0 archive. */
         template<class Archive>
-        void serialize(Archive &archive)
+        void serialize(Archive &archive, const std::uint32_t version)
         {
             archive( basisType, basisLB, basisUB, posFuncType, quadType, quadAbsTol, quadRelTol, quadMaxSub, quadMinSub, quadPts, contDeriv, basisNorm, nugget);
+            if(version >= 1){
+                archive(fixedDimWorker);
+            }else{
+                fixedDimWorker = false;
+            }
         }
         #endif // MPART_HAS_CEREAL
 
@@ -143,6 +165,7 @@ namespace mpart{
             ret &= (contDeriv   == opts2.contDeriv);
             ret &= (basisNorm   == opts2.basisNorm);
             ret &= (nugget      == opts2.nugget);
+            ret &= (fixedDimWorker == opts2.fixedDimWorker);
             return ret;
         }
 
@@ -163,16 +186,20 @@ namespace mpart{
             ss << "quadPts = " << quadPts << "\n";
             ss << "contDeriv = " << (contDeriv ? "true" : "false") << "\n";
             ss << "nugget = " << nugget << "\n";
+            ss << "fixedDimWorker = " << (fixedDimWorker ? "true" : "false") << "\n";
             return ss.str();
         }
 
         inline static const std::string btypes[3] = {"ProbabilistHermite", "PhysicistHermite", "HermiteFunctions"};
-        inline static const std::string pftypes[2] = {"Exp", "SoftPlus"};
-        inline static const std::string qtypes[3] = {"ClenshawCurtis", "AdaptiveSimpson", "AdaptiveClenshawCurtis"};
+        inline static const std::string pftypes[3] = {"Exp", "SoftPlus", "Square"};
+        inline static const std::string qtypes[5] = {"ClenshawCurtis", "AdaptiveSimpson", "AdaptiveClenshawCurtis", "GaussLegendre", "AdaptiveGaussKronrod"};
         inline static const std::string etypes[1] = {"SoftPlus"};
         inline static const std::string stypes[1] = {"Logistic"};
     };
 };
 
+#if defined(MPART_HAS_CEREAL)
+CEREAL_CLASS_VERSION(mpart::MapOptions, 1)
+#endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef MPART_MAPPEDMAP_H
+#define MPART_MAPPEDMAP_H
+
+#include "MParT/ConditionalMapBase.h"
+#include "MParT/MapOptions.h"
+
+#include <Kokkos_Core.hpp>
+#include <memory>
+#include <string>
+
+namespace mpart{
+
+    /**
+     @brief Saves a map in a flat binary format that can be loaded without copying using LoadMappedMap.
+     @details Unlike ParameterizedFunctionBase::Save, which writes a cereal archive that must be parsed and copied into
+     newly allocated views when it is read, this format stores every array in its own 64 byte aligned section so that
+     LoadMappedMap can memory-map the file and point the views of the map directly into it.  Loading is then
+     independent of the size of the map, and processes that load the same file share its pages.
+
+     The file holds a 64 byte header, the MapOptions, a table with one 64 byte entry per component, and then the
+     `nzStarts`, `nzDims`, `nzOrders` and `maxDegrees` arrays of each component's multiindex set in compressed form,
+     followed by the coefficients of all components stored contiguously.  All values use the native byte order.
+
+     Only maps built with MapFactory::CreateComponent, or TriangularMap objects whose components were all built with
+     MapFactory::CreateComponent using the same options, can be saved in this format.
+
+     @code{.cpp}
+     auto map = MapFactory::CreateTriangular<Kokkos::HostSpace>(dim, dim, order, options);
+     // ... train the map ...
+     SaveMappedMap("map.bin", map, options);
+
+     // Later, possibly in many processes
+     auto loaded = LoadMappedMap("map.bin");
+     @endcode
+
+     @param filename Path of the file to write.  Existing files are overwritten.
+     @param map The map to save.  Its coefficients must be set.
+     @param options The options that were used to construct the map (or each of its components).  They are checked by
+                    building each component from them and comparing its type and a few evaluations with the saved component.
+     @throws std::invalid_argument if the map is not supported by the format, its coefficients are not set, or the options do not match it
+     @throws std::runtime_error if the file cannot be written
+     @see LoadMappedMap
+     */
+    void SaveMappedMap(std::string const& filename,
+                       std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> const& map,
+                       MapOptions const& options);
+
+    /**
+     @brief Loads a map saved with SaveMappedMap by memory-mapping the file.
+     @details The multiindex sets and coefficients of the returned map are unmanaged views into a private, copy-on-write
+     mapping of the file, so nothing is copied and pages are only read when they are first used.  Changing the
+     coefficients of the map, e.g., with SetCoeffs, only affects the calling process and never modifies the file.
+
+     The mapping stays alive as long as the returned map, or any component obtained from it with TriangularMap::GetComponent,
+     is alive.  The file structure and the multiindex sets are checked when loading, which reads the sets but not the
+     coefficients.  The coefficients are not checked, and the file must not be modified while it is mapped.
+
+     @param filename Path of a file written by SaveMappedMap
+     @return std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> A MonotoneComponent, or a TriangularMap of MonotoneComponent objects
+     @throws std::runtime_error if the file cannot be mapped or is not a valid map file
+     @see SaveMappedMap
+     */
+    std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> LoadMappedMap(std::string const& filename);
+
+} // namespace mpart
+
+#endif // MPART_MAPPEDMAP_H
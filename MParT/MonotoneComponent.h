@@ -15,7 +15,9 @@
 #include "MParT/ConditionalMapBase.h"
 #include "MParT/DerivativeFlags.h"
 #include "MParT/MonotoneIntegrand.h"
+#include "MParT/PositiveBijectors.h"
 #include "MParT/MultivariateExpansion.h"
+#include "MParT/Quadrature.h"
 
 #include "MParT/Utilities/Miscellaneous.h"
 #include "MParT/Utilities/KokkosSpaceMappings.h"
@@ -27,6 +29,9 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <iomanip>
+#include <map>
+
 namespace mpart{
 
 /**
@@ -43,6 +48,13 @@ T(x_1, x_2, ..., x_D) = f(x_1,x_2,..., x_{D-1}, 0) + \int_0^{x_D}  g\left( \part
 @tparam ExpansionType A class defining the function \f$f\f$.  It must satisfy the cached parameterization concept.
 @tparam PosFuncType A class defining the function \f$g\f$.  This class must have `Evaluate` and `Derivative` functions accepting a double and returning a double.  The MParT::SoftPlus and MParT::Exp classes in PositiveBijectors.h are examples of classes defining this interface.
 @tparam QuadratureType A class defining the integration scheme used to approximate \f$\int_0^{x_N}  g\left( \frac{\partial f}{\partial x_d}(x_1,x_2,..., x_{N-1}, t) \right) dt\f$.  The type must have a function `Integrate(f,lb,ub)` that accepts a functor `f`, a double lower bound `lb`, a double upper bound `ub`, and returns a double with an estimate of the integral.   The MParT::AdaptiveSimpson and MParT::RecursiveQuadrature classes provide this interface.
+
+When \f$g(x)=x^2\f$ (MParT::Square) and the expansion is a homogeneous orthogonal polynomial expansion without a rectifier, the
+integral is a polynomial in \f$x_D\f$ and is computed exactly.  Writing \f$f = v_0 + \sum_{a>0} v_a \phi_a(x_D)\f$, where the
+\f$v_a\f$ depend on \f$x_1,\ldots,x_{D-1}\f$, the integral is \f$\sum_{a,b} v_a v_b \int_0^{x_D}\phi_a^\prime\phi_b^\prime dt\f$ and
+the integrals of the basis products are precomputed once by the constructor.  Evaluation, the discrete derivative and the coefficient
+gradient then do not use the quadrature rule.  The input gradient and the inverse still use the quadrature rule, which should be exact
+for polynomials of degree \f$2P_D-2\f$ (e.g., a \f$P_D\f$ point GaussLegendreQuadrature).
 */
 template<class ExpansionType, class PosFuncType, class QuadratureType, typename MemorySpace>
 class MonotoneComponent : public ConditionalMapBase<MemorySpace>
@@ -68,7 +80,11 @@ public:
                                                     quad_(quad),
                                                     dim_(expansion.InputSize()),
                                                     useContDeriv_(useContDeriv),
-                                                    nugget_(nugget){};
+                                                    nugget_(nugget)
+    {
+        if constexpr(exactSquare_)
+            diagIntegrals_ = expansion_.DiagonalProductIntegrals();
+    };
 
     
 
@@ -81,16 +97,129 @@ public:
                                                     quad_(quad),
                                                     dim_(expansion.InputSize()),
                                                     useContDeriv_(useContDeriv),
-                                                    nugget_(nugget){};
+                                                    nugget_(nugget)
+    {
+        if constexpr(exactSquare_)
+            diagIntegrals_ = expansion_.DiagonalProductIntegrals();
+    };
 
     virtual std::shared_ptr<ParameterizedFunctionBase<MemorySpace>> GetBaseFunction() override{return std::make_shared<MultivariateExpansion<typename ExpansionType::BasisType, typename ExpansionType::KokkosSpace>>(1,expansion_);};
 
+    /** @brief Precomputes the part of the expansion cache that does not depend on \f$x_D\f$ at each column of `pts`.
+        @details The 1d basis evaluations in \f$x_1,\ldots,x_{D-1}\f$ are stored in a \f$C\times N\f$ array, where \f$C\f$ is
+        given by `ExpansionType::Cache1Size()`.  Later calls with `pts`, or with a view of a contiguous range of its columns,
+        copy these values instead of re-evaluating the basis.  Any other points are evaluated as usual.
+
+        When the quadrature rule has fixed nodes (ClenshawCurtisQuadrature or GaussLegendreQuadrature), the nodes \f$t_i x_D\f$ are fixed for each point as well, so the basis
+        in \f$x_D\f$ and its first two derivatives are also tabulated at every node.  The integrands used in evaluation, the
+        discrete derivative and the coefficient Jacobians then copy these tables instead of calling `FillCache2`.  This adds
+        \f$3(P_D+1)\f$ doubles per node and point, where \f$P_D\f$ is the maximum degree in \f$x_D\f$.  The tables are not
+        built when the integral is computed in closed form.
+        @param pts A \f$D\times N\f$ matrix of points that will be reused, e.g., the training data.  Its values must not change while frozen.
+        @see UnfreezeData
+    */
+    void FreezeData(StridedMatrix<const double, MemorySpace> const& pts) override
+    {
+        UnfreezeData();
+
+        const unsigned int numPts = pts.extent(1);
+        const unsigned int cache1Size = expansion_.Cache1Size();
+        if(numPts==0)
+            return;
+
+        Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> frozenCache("Frozen expansion cache", cache1Size, numPts);
+        ExpansionType expansion = expansion_;
+
+        if(cache1Size>0){
+            Kokkos::parallel_for(Kokkos::RangePolicy<typename MemoryToExecution<MemorySpace>::Space>(0,numPts), KOKKOS_LAMBDA(const unsigned int ptInd){
+                auto pt = Kokkos::subview(pts, Kokkos::ALL(), ptInd);
+                expansion.FillCache1(&frozenCache(0,ptInd), pt, DerivativeFlags::None);
+            });
+        }
+
+        // With a fixed quadrature rule, the nodes t_i*x_d are also known, so the basis in x_d can be tabulated at every node
+        Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> frozenDiagTable;
+        if constexpr(hasFixedNodes_ && !exactSquare_){
+            const unsigned int tableSize = expansion_.DiagonalTableSize();
+            const unsigned int numNodes = quad_.NumPts();
+            QuadratureType quad = quad_;
+
+            frozenDiagTable = Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace>("Frozen quadrature node tables", numNodes*tableSize, numPts);
+            Kokkos::parallel_for(Kokkos::RangePolicy<typename MemoryToExecution<MemorySpace>::Space>(0,numPts), KOKKOS_LAMBDA(const unsigned int ptInd){
+                const double xd = pts(pts.extent(0)-1, ptInd);
+                for(unsigned int i=0; i<numNodes; ++i){
+                    // Same node location as QuadratureType::IntegrateIndexed on [0,1]
+                    double t = 0.5*(1.0 + quad.Point(i));
+                    expansion.FillDiagonalTable(&frozenDiagTable(i*tableSize,ptInd), t*xd);
+                }
+            });
+        }
+        Kokkos::fence();
+
+        frozenPts_ = pts;
+        frozenCache_ = frozenCache;
+        frozenDiagTable_ = frozenDiagTable;
+    }
+
+    /** @brief Releases the cache computed by FreezeData. */
+    void UnfreezeData() override
+    {
+        frozenPts_ = StridedMatrix<const double, MemorySpace>();
+        frozenCache_ = Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace>();
+        frozenDiagTable_ = Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace>();
+    }
+
     /** Override the ConditionalMapBase Evaluate function. */
     void EvaluateImpl(StridedMatrix<const double, MemorySpace> const& pts,
                       StridedMatrix<double, MemorySpace>              output) override
+    {
+        EvaluateSharedImpl(pts, SharedBasisTable<MemorySpace>(), output);
+    }
+
+    /** @brief Components with the same homogeneous basis can share basis evaluations.  See ConditionalMapBase::CanShareBasis. */
+    bool CanShareBasis(ConditionalMapBase<MemorySpace> const& other) const override
+    {
+        if constexpr(canShareBasis_){
+            auto otherComp = dynamic_cast<MonotoneComponent const*>(&other);
+            return (otherComp!=nullptr) && expansion_.SharesBasisWith(otherComp->expansion_);
+        }else{
+            return false;
+        }
+    }
+
+    std::vector<unsigned int> SharedBasisDegrees() const override
+    {
+        if constexpr(canShareBasis_){
+            return expansion_.Cache1Degrees();
+        }else{
+            return std::vector<unsigned int>();
+        }
+    }
+
+    void FillSharedBasis(StridedMatrix<const double, MemorySpace> const& pts,
+                         Kokkos::View<const unsigned int*, MemorySpace> const& rowStarts,
+                         Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> vals) const override
+    {
+        if constexpr(canShareBasis_){
+            const unsigned int numDims = rowStarts.extent(0)-1;
+            ExpansionType expansion = expansion_;
+
+            Kokkos::parallel_for(Kokkos::RangePolicy<typename MemoryToExecution<MemorySpace>::Space>(0,pts.extent(1)), KOKKOS_LAMBDA(const unsigned int ptInd){
+                for(unsigned int d=0; d<numDims; ++d)
+                    expansion.EvaluateBasis(d, &vals(rowStarts(d),ptInd), rowStarts(d+1)-rowStarts(d)-1, pts(d,ptInd));
+            });
+            Kokkos::fence();
+        }else{
+            ConditionalMapBase<MemorySpace>::FillSharedBasis(pts, rowStarts, vals);
+        }
+    }
+
+    void EvaluateSharedImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                            SharedBasisTable<MemorySpace>            const& basis,
+                            StridedMatrix<double, MemorySpace>              output) override
     {
         StridedVector<double,MemorySpace> outputSlice = Kokkos::subview(output, 0, Kokkos::ALL());
-        EvaluateImpl(pts, this->savedCoeffs, outputSlice);
+        EvaluateImpl(pts, this->savedCoeffs, outputSlice, basis);
     }
 
     void InverseImpl(StridedMatrix<const double, MemorySpace> const& x1,
@@ -99,29 +228,133 @@ public:
     {
         auto rSlice = Kokkos::subview(r,0,Kokkos::ALL());
         auto outputSlice = Kokkos::subview(output, 0, Kokkos::ALL());
-        InverseImpl(x1, rSlice, this->savedCoeffs, outputSlice);
+        InverseImpl(x1, rSlice, this->savedCoeffs, outputSlice, GetInverseOptions());
+    }
+
+    void InverseWithGuessImpl(StridedMatrix<const double, MemorySpace> const& x1,
+                              StridedMatrix<const double, MemorySpace> const& r,
+                              StridedMatrix<const double, MemorySpace> const& x2Guess,
+                              StridedMatrix<double, MemorySpace>              bracketWidths,
+                              StridedMatrix<double, MemorySpace>              output) override
+    {
+        auto rSlice = Kokkos::subview(r,0,Kokkos::ALL());
+        auto outputSlice = Kokkos::subview(output, 0, Kokkos::ALL());
+        auto guessSlice = Kokkos::subview(x2Guess, 0, Kokkos::ALL());
+
+        StridedVector<double, MemorySpace> widthSlice;
+        if(bracketWidths.size()>0)
+            widthSlice = Kokkos::subview(bracketWidths, 0, Kokkos::ALL());
+
+        InverseImpl(x1, rSlice, this->savedCoeffs, outputSlice, guessSlice, widthSlice, GetInverseOptions());
+    }
+
+    /** @brief Sets the options used when the inverse is computed through the ConditionalMapBase interface (e.g., by
+               TriangularMap::InverseInplace).  See the `options` argument of the templated InverseImpl function for the
+               available options.
+    */
+    void SetInverseOptions(std::map<std::string, std::string> const& options)
+    {
+        bool useNewton, surrogatePolish;
+        double xtol, ytol;
+        unsigned int surrogateNodes;
+        ParseInverseOptions(options, useNewton, xtol, ytol, surrogateNodes, surrogatePolish);
+
+        inverseUseNewton_ = useNewton;
+        inverseXTol_ = xtol;
+        inverseYTol_ = ytol;
+        inverseSurrogateNodes_ = surrogateNodes;
+        inverseSurrogatePolish_ = surrogatePolish;
+    }
+
+    /** Returns the options used when computing the inverse through the ConditionalMapBase interface. */
+    std::map<std::string, std::string> GetInverseOptions() const
+    {
+        std::map<std::string, std::string> options;
+        options["Method"] = inverseUseNewton_ ? "Newton" : "Bracket";
+
+        std::stringstream xtolStr, ytolStr;
+        xtolStr << std::setprecision(17) << inverseXTol_;
+        ytolStr << std::setprecision(17) << inverseYTol_;
+        options["xtol"] = xtolStr.str();
+        options["ytol"] = ytolStr.str();
+        options["SurrogateNodes"] = std::to_string(inverseSurrogateNodes_);
+        options["SurrogatePolish"] = inverseSurrogatePolish_ ? "true" : "false";
+        return options;
     }
 
     void LogDeterminantImpl(StridedMatrix<const double, MemorySpace> const& pts,
                             StridedVector<double,MemorySpace>               output) override
+    {
+        LogDeterminantSharedImpl(pts, SharedBasisTable<MemorySpace>(), output);
+    }
+
+    void LogDeterminantSharedImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                                  SharedBasisTable<MemorySpace>            const& basis,
+                                  StridedVector<double,MemorySpace>               output) override
     {
         // First, get the diagonal derivative
         if(useContDeriv_){
-            ContinuousDerivative(pts, this->savedCoeffs, output);
+            ContinuousDerivative(pts, this->savedCoeffs, output, basis);
         }else{
             Kokkos::View<double*,MemorySpace> evals("Evaluations", pts.extent(1));
-            DiscreteDerivative(pts, this->savedCoeffs, evals, output);
+            DiscreteDerivative(pts, this->savedCoeffs, evals, output, basis);
         }
 
         // Now take the log
-        auto policy = Kokkos::RangePolicy<typename MemoryToExecution<MemorySpace>::Space>(0,output.extent(0));
-        Kokkos::parallel_for(policy, KOKKOS_CLASS_LAMBDA (unsigned int i) {
-            if(output(i)<=0){
-                output(i) = -std::numeric_limits<double>::infinity();
+        TakeLog(output);
+    }
+
+    void ForwardPassImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                         StridedMatrix<const double, MemorySpace> const& sens,
+                         StridedMatrix<double, MemorySpace>              evals,
+                         StridedVector<double, MemorySpace>              logDets,
+                         StridedMatrix<double, MemorySpace>              coeffGrad) override
+    {
+        ForwardPassSharedImpl(pts, SharedBasisTable<MemorySpace>(), sens, evals, logDets, coeffGrad);
+    }
+
+    /** @brief Computes the requested outputs with EvaluateWithDerivative or CoeffGradWithDerivative.  See ConditionalMapBase::ForwardPassImpl. */
+    void ForwardPassSharedImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                               SharedBasisTable<MemorySpace>            const& basis,
+                               StridedMatrix<const double, MemorySpace> const& sens,
+                               StridedMatrix<double, MemorySpace>              evals,
+                               StridedVector<double, MemorySpace>              logDets,
+                               StridedMatrix<double, MemorySpace>              coeffGrad) override
+    {
+        StridedVector<double, MemorySpace> evalSlice;
+        if(evals.size()>0)
+            evalSlice = Kokkos::subview(evals, 0, Kokkos::ALL());
+
+        // The diagonal derivative is computed in place and then replaced by its log
+        StridedVector<double, MemorySpace> derivs = logDets;
+
+        if(coeffGrad.size()>0){
+            checkGradFunctionInput("ForwardPassImpl", sens.extent(0), sens.extent(1), pts.extent(0), pts.extent(1), coeffGrad.extent(0), coeffGrad.extent(1), this->numCoeffs);
+
+            if(useContDeriv_ || exactSquare_){
+                StridedVector<const double, MemorySpace> sensSlice = Kokkos::subview(sens, 0, Kokkos::ALL());
+                CoeffGradWithDerivative(pts, this->savedCoeffs, sensSlice, evalSlice, derivs, coeffGrad, basis);
             }else{
-                output(i) = std::log(output(i));
+                // The gradient of the discrete derivative does not share a kernel with the coefficient gradient
+                if((evalSlice.size()>0) || (derivs.size()>0))
+                    EvaluateWithDerivative(pts, this->savedCoeffs, evalSlice, derivs, basis);
+
+                CoeffGradSharedImpl(pts, sens, basis, coeffGrad);
+
+                Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> detGrad("Log Determinant Coefficient Gradient", coeffGrad.extent(0), coeffGrad.extent(1));
+                LogDeterminantCoeffGradImpl(pts, detGrad);
+
+                Kokkos::MDRangePolicy<Kokkos::Rank<2>, typename MemoryToExecution<MemorySpace>::Space> policy({{0, 0}}, {{coeffGrad.extent(0), coeffGrad.extent(1)}});
+                Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int& i, const int& j) {
+                    coeffGrad(i,j) += detGrad(i,j);
+                });
             }
-        });
+        }else if((evalSlice.size()>0) || (derivs.size()>0)){
+            EvaluateWithDerivative(pts, this->savedCoeffs, evalSlice, derivs, basis);
+        }
+
+        if(derivs.size()>0)
+            TakeLog(derivs);
     }
 
     bool isGradFunctionInputValid(int sensRows, int sensCols, int ptsRows, int ptsCols, int outputRows, int outputCols, int expectedOutputRows) {
@@ -166,12 +399,20 @@ public:
     void CoeffGradImpl(StridedMatrix<const double, MemorySpace> const& pts,
                        StridedMatrix<const double, MemorySpace> const& sens,
                        StridedMatrix<double, MemorySpace>              output) override
+    {
+        CoeffGradSharedImpl(pts, sens, SharedBasisTable<MemorySpace>(), output);
+    }
+
+    void CoeffGradSharedImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                             StridedMatrix<const double, MemorySpace> const& sens,
+                             SharedBasisTable<MemorySpace>            const& basis,
+                             StridedMatrix<double, MemorySpace>              output) override
     {
         checkGradFunctionInput("CoeffGradImpl", sens.extent(0), sens.extent(1), pts.extent(0), pts.extent(1), output.extent(0), output.extent(1), this->numCoeffs);
 
         Kokkos::View<double*,MemorySpace> evals("Map output", pts.extent(1));
 
-        CoeffJacobian(pts, this->savedCoeffs, evals, output);
+        CoeffJacobian(pts, this->savedCoeffs, evals, output, basis);
 
         // Scale each column by the sensitivity
         auto policy = Kokkos::RangePolicy<typename MemoryToExecution<MemorySpace>::Space>(0,pts.extent(1));
@@ -251,11 +492,13 @@ public:
      * @param[in] pts A \f$D\times N\f$ array containing the \f$N\f$ points in \f$\mathbb{R}^D\f$ where we want to evaluate the monotone component.  Each column is a point.
      * @param[in] coeffs The coefficients in the expansion defining \f$f\f$.  The length of this array must be the same as the number of terms in the multiindex set passed to the constructor.
      * @param[out] output Kokkos::View<double*> An array containing the evaluattions \f$T(x^{(i)}_1,\ldots,x^{(i)}_D)\f$ for each \f$i\in\{0,\ldots,N\}\f$.
+     * @param[in] sharedBasis Optional basis evaluations at `pts` that are copied instead of evaluating the basis in \f$x_1,\ldots,x_{D-1}\f$.  See SharedBasisTable.
      */
     template<typename ExecutionSpace=typename MemoryToExecution<MemorySpace>::Space, class... OtherTraits>
     void EvaluateImpl(Kokkos::View<const double**, OtherTraits...>   const& pts,
                       StridedVector<const double,MemorySpace>        const& coeffs,
-                      StridedVector<double,MemorySpace>                     output)
+                      StridedVector<double,MemorySpace>                     output,
+                      SharedBasisTable<MemorySpace>                  const& sharedBasis = SharedBasisTable<MemorySpace>())
     {
         const unsigned int numPts = pts.extent(1);
         if(output.extent(0)!=numPts) {
@@ -268,7 +511,9 @@ public:
         // Ask the expansion how much memory it would like for its one-point cache
         const unsigned int cacheSize = expansion_.CacheSize();
         quad_.SetDim(1);
-        const unsigned int workspaceSize = quad_.WorkspaceSize();
+        const unsigned int workspaceSize = exactSquare_ ? ExactWorkspaceSize() : quad_.WorkspaceSize();
+
+        const int frozenOffset = FrozenOffset(pts);
 
         auto functor = KOKKOS_CLASS_LAMBDA (typename Kokkos::TeamPolicy<ExecutionSpace>::member_type team_member) {
 
@@ -283,8 +528,13 @@ public:
                 Kokkos::View<double*,MemorySpace> workspace(team_member.thread_scratch(1), workspaceSize);
 
                 // Fill in entries in the cache that are independent of x_d.  By passing DerivativeFlags::None, we are telling the expansion that no derivatives with wrt x_1,...x_{d-1} will be needed.
-                expansion_.FillCache1(cache.data(), pt, DerivativeFlags::None);
-                output(ptInd) = EvaluateSingle(cache.data(), workspace.data(), pt, pt(dim_-1), coeffs, quad_, expansion_);
+                const int frozenInd = (frozenOffset<0) ? -1 : int(frozenOffset+ptInd);
+                FillCache1(cache.data(), pt, frozenInd, sharedBasis, ptInd);
+                if constexpr(exactSquare_){
+                    output(ptInd) = EvaluateExact(cache.data(), workspace.data(), pt(dim_-1), coeffs, 0.0);
+                }else{
+                    output(ptInd) = EvaluateSingle(cache.data(), workspace.data(), pt, pt(dim_-1), coeffs, quad_, expansion_, 0.0, FrozenDiagonalTable(frozenInd));
+                }
             }
         };
 
@@ -325,7 +575,16 @@ public:
      @param ys A length \f$N\f$ array containing \f$N\f$ values of \f$y_D\f$ for use in the solve.
      @param coeffs The coefficients in the expansion defining \f$f\f$.  The length of this array must be the same as the number of terms in the multiindex set passed to the constructor.
      @param output An array for storing the computed values of \f$y_D^{(i)}\f$.  Memory for this array must be preallocated before calling this function.
-     @param options A map containing options for the method (e.g., converge criteria, step sizes).   Available options are "Method" (must be "Bracket"), "xtol" (any nonnegative float), and "ytol" (any nonnegative float).
+     @param options A map containing options for the method (e.g., converge criteria, step sizes).   Available options are "Method" ("Bracket" or "Newton"), "xtol" (any nonnegative float), and "ytol" (any nonnegative float).
+              The "Bracket" method finds a bracket around the root and then uses the ITP method.  The "Newton" method uses
+              safeguarded Halley/Newton steps based on the continuous derivative \f$g(\partial_D f)\f$, which usually requires
+              far fewer evaluations of the integral, and falls back to the bracketing method if it does not converge.
+              See RootFinding::InverseSingleNewton.
+              When a single \f$x_{1:D-1}\f$ point is given, the "SurrogateNodes" option (a nonnegative integer, default 0) can be
+              used to tabulate \f$T(x_{1:D-1},\cdot)\f$ and its derivative at that many Chebyshev nodes spanning the range of
+              the targets and to invert the resulting piecewise cubic Hermite interpolant instead of the component itself.
+              Unless the "SurrogatePolish" option is "false", each interpolant root is then polished with a few safeguarded Newton
+              steps on the component.  See InverseSurrogate.
      */
     template<typename ExecutionSpace=typename MemoryToExecution<MemorySpace>::Space>
     void InverseImpl(StridedMatrix<const double, MemorySpace> const& xs,
@@ -334,51 +593,37 @@ public:
                      StridedVector<double, MemorySpace>              output,
                  std::map<std::string, std::string>                  options=std::map<std::string,std::string>())
     {
-        // Extract the method from the options map
-        std::string method;
-        if(options.count("Method")){
-            method = options["Method"];
-        }else{
-            method = "Bracket";
-        }
-
-        // Check to make sure the method is valid
-        if(method!="Bracket"){
-            std::stringstream msg;
-            msg << "Invalid method given to MonotoneComponent::Inverse.  Given \"" << method << "\", but valid options are [\"Bisect\"].";
-            throw std::invalid_argument(msg.str());
-        }
+        InverseImpl<ExecutionSpace>(xs, ys, coeffs, output, StridedVector<const double, MemorySpace>(), StridedVector<double, MemorySpace>(), options);
+    }
 
-        // Extract the xtol and ytol option if they exist
+    /**
+     @brief Evaluates the inverse of the diagonal of the monotone component starting from per-point initial guesses.
+     @details Identical to the InverseImpl function above, except that the initial guess for \f$x_D^{(i)}\f$ is given by
+              `guesses(i)` instead of the last row of `xs`, and the bracketing search (or the Newton trust region) starts
+              with a step of `bracketWidths(i)` instead of 1.  On exit, `bracketWidths(i)` is set to twice the distance
+              between the initial guess and the computed root, so that it can be reused when inverting nearby targets.  The
+              new width is at least half of the previous width and at least 0.01.
+     @param xs A \f$D\times N_1\f$ or \f$(D-1)\times N_1\f$ array containing \f$N_1\f$ \f$x_{1:D-1}\f$ points, with \f$N_1\f$ either 1 or N.
+     @param ys A length \f$N\f$ array containing \f$N\f$ values of \f$y_D\f$ for use in the solve.
+     @param coeffs The coefficients in the expansion defining \f$f\f$.
+     @param output An array for storing the computed values of \f$x_D^{(i)}\f$.  May be the same memory as `guesses`.
+     @param guesses A length \f$N\f$ array of initial guesses, or an empty view to use the last row of `xs`.
+     @param bracketWidths A length \f$N\f$ array of initial steps that is updated in place, or an empty view to use a step of 1.
+     @param options See the InverseImpl function above.
+     */
+    template<typename ExecutionSpace=typename MemoryToExecution<MemorySpace>::Space>
+    void InverseImpl(StridedMatrix<const double, MemorySpace> const& xs,
+                     StridedVector<const double, MemorySpace> const& ys,
+                     StridedVector<const double, MemorySpace> const& coeffs,
+                     StridedVector<double, MemorySpace>              output,
+                     StridedVector<const double, MemorySpace> const& guesses,
+                     StridedVector<double, MemorySpace>              bracketWidths,
+                 std::map<std::string, std::string>                  options=std::map<std::string,std::string>())
+    {
+        bool useNewton, surrogatePolish;
         double xtol, ytol;
-        if(options.count("xtol")){
-            xtol = std::stod(options["xtol"]);
-            if(xtol<0){
-                std::stringstream msg;
-                msg << "Invalid tolerance \"xtol\" given to MonotoneComponent::Inverse.  Value must be non-negative, but given " << xtol;
-                throw std::invalid_argument(msg.str());
-            }
-        }else{
-            xtol = 1e-6;
-        }
-        if(options.count("ytol")){
-            ytol = std::stod(options["ytol"]);
-            if(ytol<0){
-                std::stringstream msg;
-                msg << "Invalid tolerance \"ytol\" given to MonotoneComponent::Inverse.  Value must be non-negative, but given " << ytol;
-                throw std::invalid_argument(msg.str());
-            }
-        }else{
-            ytol = 1e-6;
-        }
-
-        if((ytol<=std::numeric_limits<double>::epsilon())&&(xtol<=std::numeric_limits<double>::epsilon())){
-            std::stringstream msg;
-            msg << "Invalid tolerances given to MonotoneComponent::Inverse.  Either \"xtol\" or \"ytol\" must be nonzero, but given values are " << xtol << " and " << ytol;
-            throw std::invalid_argument(msg.str());
-        }
-
-
+        unsigned int surrogateNodes;
+        ParseInverseOptions(options, useNewton, xtol, ytol, surrogateNodes, surrogatePolish);
 
         // Set up the cache for each point
         const unsigned int numPts = ys.extent(0);
@@ -395,6 +640,24 @@ public:
             msg << "Invalid argument sizes given to MonotoneComponent::Inverse.  The output array has size " << output.extent(0) << " but there are N=" << numPts << " to invert.";
             throw std::invalid_argument(msg.str());
         }
+        const bool hasGuesses = (guesses.extent(0)>0);
+        const bool hasWidths = (bracketWidths.extent(0)>0);
+        if((hasGuesses && (guesses.extent(0)!=numPts)) || (hasWidths && (bracketWidths.extent(0)!=numPts))){
+            std::stringstream msg;
+            msg << "Invalid argument sizes given to MonotoneComponent::Inverse.  The initial guesses and bracket widths must have either size 0 or N=" << numPts << ", but have sizes " << guesses.extent(0) << " and " << bracketWidths.extent(0) << ".";
+            throw std::invalid_argument(msg.str());
+        }
+        if((!hasGuesses) && (xs.extent(0)<dim_)){
+            std::stringstream msg;
+            msg << "Invalid argument sizes given to MonotoneComponent::Inverse.  Without initial guesses, xs must have at least " << dim_ << " rows, but it has " << xs.extent(0) << ".";
+            throw std::invalid_argument(msg.str());
+        }
+
+        // All targets share the same x_{1:D-1}, so invert a tabulated surrogate of the diagonal instead
+        if((surrogateNodes>0) && (numXs==1) && (!hasGuesses) && (!hasWidths)){
+            InverseSurrogate<ExecutionSpace>(xs, ys, coeffs, output, useNewton, xtol, ytol, surrogateNodes, surrogatePolish);
+            return;
+        }
 
         // Ask the expansion how much memory it would like for it's one-point cache
         const unsigned int cacheSize = expansion_.CacheSize();
@@ -404,6 +667,8 @@ public:
         // Create a policy with enough scratch memory to cache the polynomial evaluations
         unsigned int cacheBytes = Kokkos::View<double*,MemorySpace>::shmem_size(cacheSize+workspaceSize);
 
+        const int frozenOffset = FrozenOffset(xs);
+
         auto functor = KOKKOS_CLASS_LAMBDA (typename Kokkos::TeamPolicy<ExecutionSpace>::member_type team_member) {
 
             unsigned int ptInd = team_member.league_rank () * team_member.team_size () + team_member.team_rank ();
@@ -427,12 +692,24 @@ public:
 
                 // Fill in the cache with everything that doesn't depend on x_d
                 Kokkos::View<double*,MemorySpace> cache(team_member.thread_scratch(1), cacheSize);
-                expansion_.FillCache1(cache.data(), pt, DerivativeFlags::None);
+                FillCache1(cache.data(), pt, (frozenOffset<0) ? -1 : int(frozenOffset+xInd));
 
                 // Compute the inverse
                 Kokkos::View<double*,MemorySpace> workspace(team_member.thread_scratch(1), workspaceSize);
                 auto eval = SingleEvaluator<decltype(pt),decltype(coeffs)>(workspace.data(), cache.data(), pt, coeffs, quad_, expansion_, nugget_);
-                output(ptInd) = RootFinding::InverseSingleBracket<MemorySpace>(ys(ptInd), eval, pt(pt.extent(0)-1), xtol, ytol, info);
+                const double x0 = hasGuesses ? guesses(ptInd) : pt(pt.extent(0)-1);
+                const double stepSize = hasWidths ? bracketWidths(ptInd) : 1.0;
+
+                if(useNewton){
+                    output(ptInd) = RootFinding::InverseSingleNewton<MemorySpace>(ys(ptInd), eval, x0, xtol, ytol, info, stepSize);
+                }else{
+                    output(ptInd) = RootFinding::InverseSingleBracket<MemorySpace>(ys(ptInd), eval, x0, xtol, ytol, info, stepSize);
+                }
+
+                // Twice the distance to the root is a good initial step for nearby targets.  The width shrinks by at most half
+                // per solve and never drops below 1e-2, so an exact guess does not leave a tiny step for the next, farther root.
+                if(hasWidths)
+                    bracketWidths(ptInd) = std::isnan(output(ptInd)) ? 1.0 : fmax(2.0*fabs(output(ptInd)-x0), fmax(0.5*stepSize, fmax(1e-2, xtol)));
             }
         };
 
@@ -442,6 +719,189 @@ public:
         Kokkos::parallel_for(policy, functor);
     }
 
+    /**
+     @brief Inverts the diagonal of the component for many targets that share a single \f$x_{1:D-1}\f$ point.
+     @details The roots for the smallest and largest targets are first computed with the solver selected by `useNewton`.
+              The component and its continuous derivative are then tabulated at `numNodes` Chebyshev nodes between these two
+              roots, and each target is inverted on the piecewise cubic Hermite interpolant of the table using
+              RootFinding::InverseHermiteCubic.  This replaces \f$N\f$ root solves, each requiring many evaluations of the
+              integral, with `numNodes` evaluations and \f$N\f$ cheap inversions of a cubic.  When `polish` is true, the root of
+              the interpolant is used to start RootFinding::InverseSingleNewton with a trust radius equal to the width of the
+              table interval, which typically converges after one or two evaluations of the component.  If either end of the
+              table cannot be computed, each target is inverted directly.
+     @param xs A \f$D\times 1\f$ array containing the \f$x_{1:D-1}\f$ point.  The last row is the initial guess for the range solves.
+     @param ys A length \f$N\f$ array containing \f$N\f$ values of \f$y_D\f$.
+     @param coeffs The coefficients in the expansion defining \f$f\f$.
+     @param output A preallocated array for storing the computed values of \f$x_D^{(i)}\f$.
+     @param useNewton Whether the range solves (and fallback solves) use RootFinding::InverseSingleNewton or RootFinding::InverseSingleBracket.
+     @param xtol Tolerance for the root.
+     @param ytol Tolerance for the function value.
+     @param numNodes The number of nodes in the table.  Must be at least 2.
+     @param polish Whether to refine the roots of the interpolant using the component itself.
+     */
+    template<typename ExecutionSpace=typename MemoryToExecution<MemorySpace>::Space>
+    void InverseSurrogate(StridedMatrix<const double, MemorySpace> const& xs,
+                          StridedVector<const double, MemorySpace> const& ys,
+                          StridedVector<const double, MemorySpace> const& coeffs,
+                          StridedVector<double, MemorySpace>              output,
+                          bool                                            useNewton,
+                          double                                          xtol,
+                          double                                          ytol,
+                          unsigned int                                    numNodes,
+                          bool                                            polish)
+    {
+        const unsigned int numPts = ys.extent(0);
+        if(numPts==0)
+            return;
+
+        // Find the range of the targets.  NaN targets fail both comparisons and are ignored.
+        double ymin, ymax;
+        Kokkos::RangePolicy<ExecutionSpace> rangePolicy(0,numPts);
+        Kokkos::parallel_reduce(rangePolicy, KOKKOS_LAMBDA (const unsigned int i, double& lmin) {
+            if(ys(i)<lmin) lmin = ys(i);
+        }, Kokkos::Min<double>(ymin));
+        Kokkos::parallel_reduce(rangePolicy, KOKKOS_LAMBDA (const unsigned int i, double& lmax) {
+            if(ys(i)>lmax) lmax = ys(i);
+        }, Kokkos::Max<double>(ymax));
+
+        if(!(ymin<=ymax)){
+            Kokkos::deep_copy(output, std::numeric_limits<double>::quiet_NaN());
+            return;
+        }
+
+        const unsigned int cacheSize = expansion_.CacheSize();
+        quad_.SetDim(1);
+        const unsigned int workspaceSize = quad_.WorkspaceSize();
+        unsigned int cacheBytes = Kokkos::View<double*,MemorySpace>::shmem_size(cacheSize+workspaceSize);
+
+        const int frozenOffset = FrozenOffset(xs);
+        auto pt = Kokkos::subview(xs, Kokkos::ALL(), 0);
+
+        Kokkos::View<double*, MemorySpace> nodeX("Surrogate Nodes", numNodes);
+        Kokkos::View<double*, MemorySpace> nodeY("Surrogate Values", numNodes);
+        Kokkos::View<double*, MemorySpace> nodeD("Surrogate Derivatives", numNodes);
+
+        // Compute the ends of the table by inverting the smallest and largest targets
+        auto endFunctor = KOKKOS_CLASS_LAMBDA (typename Kokkos::TeamPolicy<ExecutionSpace>::member_type team_member) {
+
+            unsigned int endInd = team_member.league_rank () * team_member.team_size () + team_member.team_rank ();
+            int info;
+
+            if(endInd<2){
+                Kokkos::View<double*,MemorySpace> cache(team_member.thread_scratch(1), cacheSize);
+                FillCache1(cache.data(), pt, frozenOffset);
+
+                Kokkos::View<double*,MemorySpace> workspace(team_member.thread_scratch(1), workspaceSize);
+                auto eval = SingleEvaluator<decltype(pt),decltype(coeffs)>(workspace.data(), cache.data(), pt, coeffs, quad_, expansion_, nugget_);
+
+                const double yd = (endInd==0) ? ymin : ymax;
+                const unsigned int nodeInd = (endInd==0) ? 0 : numNodes-1;
+                if(useNewton){
+                    nodeX(nodeInd) = RootFinding::InverseSingleNewton<MemorySpace>(yd, eval, pt(pt.extent(0)-1), xtol, ytol, info);
+                }else{
+                    nodeX(nodeInd) = RootFinding::InverseSingleBracket<MemorySpace>(yd, eval, pt(pt.extent(0)-1), xtol, ytol, info);
+                }
+            }
+        };
+        Kokkos::parallel_for(GetCachedRangePolicy<ExecutionSpace>(2, cacheBytes, endFunctor), endFunctor);
+
+        // Tabulate the component and its derivative at Chebyshev nodes between the ends
+        auto tableFunctor = KOKKOS_CLASS_LAMBDA (typename Kokkos::TeamPolicy<ExecutionSpace>::member_type team_member) {
+
+            unsigned int nodeInd = team_member.league_rank () * team_member.team_size () + team_member.team_rank ();
+
+            if(nodeInd<numNodes){
+                const double xa = nodeX(0);
+                const double xb = nodeX(numNodes-1);
+                if(std::isnan(xa) || std::isnan(xb))
+                    return;
+
+                double x = 0.5*(xa+xb) - 0.5*(xb-xa)*std::cos(M_PI*double(nodeInd)/double(numNodes-1));
+                if(nodeInd==0){
+                    x = xa;
+                }else if(nodeInd==numNodes-1){
+                    x = xb;
+                }else{
+                    nodeX(nodeInd) = x;
+                }
+
+                Kokkos::View<double*,MemorySpace> cache(team_member.thread_scratch(1), cacheSize);
+                FillCache1(cache.data(), pt, frozenOffset);
+
+                Kokkos::View<double*,MemorySpace> workspace(team_member.thread_scratch(1), workspaceSize);
+                auto eval = SingleEvaluator<decltype(pt),decltype(coeffs)>(workspace.data(), cache.data(), pt, coeffs, quad_, expansion_, nugget_);
+
+                double d2f;
+                eval.ValueAndDerivatives(x, nodeY(nodeInd), nodeD(nodeInd), d2f);
+            }
+        };
+        Kokkos::parallel_for(GetCachedRangePolicy<ExecutionSpace>(numNodes, cacheBytes, tableFunctor), tableFunctor);
+        Kokkos::fence();
+
+        // Invert the interpolant for each target
+        auto functor = KOKKOS_CLASS_LAMBDA (typename Kokkos::TeamPolicy<ExecutionSpace>::member_type team_member) {
+
+            unsigned int ptInd = team_member.league_rank () * team_member.team_size () + team_member.team_rank ();
+            int info;
+
+            if(ptInd<numPts){
+
+                // Check for NaNs.  If found, set output to nan and return
+                bool hasNan = std::isnan(ys(ptInd));
+                for(unsigned int ii=0; ii<pt.size(); ++ii)
+                    hasNan = hasNan || std::isnan(pt(ii));
+
+                if(hasNan){
+                    output(ptInd) = std::numeric_limits<double>::quiet_NaN();
+                    return;
+                }
+
+                const double yd = ys(ptInd);
+                const bool validTable = !(std::isnan(nodeX(0)) || std::isnan(nodeX(numNodes-1)));
+
+                double x0 = pt(pt.extent(0)-1);
+                double stepSize = 1.0;
+
+                if(validTable){
+                    // Binary search for the table interval containing the target
+                    unsigned int lo = 0, hi = numNodes-1;
+                    while(hi-lo>1){
+                        unsigned int mid = (lo+hi)/2;
+                        if(nodeY(mid)<=yd){
+                            lo = mid;
+                        }else{
+                            hi = mid;
+                        }
+                    }
+
+                    const double h = nodeX(hi) - nodeX(lo);
+                    x0 = nodeX(lo) + h*RootFinding::InverseHermiteCubic(yd, nodeY(lo), nodeY(hi), nodeD(lo), nodeD(hi), h);
+
+                    if(!polish){
+                        output(ptInd) = x0;
+                        return;
+                    }
+                    stepSize = fmax(h, xtol);
+                }
+
+                Kokkos::View<double*,MemorySpace> cache(team_member.thread_scratch(1), cacheSize);
+                FillCache1(cache.data(), pt, frozenOffset);
+
+                Kokkos::View<double*,MemorySpace> workspace(team_member.thread_scratch(1), workspaceSize);
+                auto eval = SingleEvaluator<decltype(pt),decltype(coeffs)>(workspace.data(), cache.data(), pt, coeffs, quad_, expansion_, nugget_);
+
+                if(validTable || useNewton){
+                    output(ptInd) = RootFinding::InverseSingleNewton<MemorySpace>(yd, eval, x0, xtol, ytol, info, stepSize);
+                }else{
+                    output(ptInd) = RootFinding::InverseSingleBracket<MemorySpace>(yd, eval, x0, xtol, ytol, info, stepSize);
+                }
+            }
+        };
+
+        auto policy = GetCachedRangePolicy<ExecutionSpace>(numPts, cacheBytes, functor);
+        Kokkos::parallel_for(policy, functor);
+    }
+
 
     /**
        @brief Approximates the "continuous derivative" \f$\frac{\partial T}{\partial x_D}\f$ derived from the exact integral form of the transport map.
@@ -481,13 +941,15 @@ public:
         @param[in] coeffs The ceofficients in an expansion for \f$f\f$.
         @param[in,out] evals  The values of map component itself \f$T\f$ at each point.
         @param[in,out] derivs The values of \f$ \frac{\partial T}{\partial x_D}\f$ at each point.
+        @param[in] sharedBasis Optional basis evaluations at `pts`.  See SharedBasisTable.
 
         @see DiscreteDerivative
      */
     template<typename ExecutionSpace=typename MemoryToExecution<MemorySpace>::Space>
     void ContinuousDerivative(StridedMatrix<const double, MemorySpace> const& pts,
                               StridedVector<const double, MemorySpace> const& coeffs,
-                              StridedVector<double, MemorySpace>              derivs)
+                              StridedVector<double, MemorySpace>              derivs,
+                              SharedBasisTable<MemorySpace>            const& sharedBasis = SharedBasisTable<MemorySpace>())
     {
         const unsigned int numPts = pts.extent(1);
         const unsigned int dim = pts.extent(0);
@@ -498,6 +960,8 @@ public:
         // Create a policy with enough scratch memory to cache the polynomial evaluations
         auto cacheBytes = Kokkos::View<double*,MemorySpace>::shmem_size(cacheSize);
 
+        const int frozenOffset = FrozenOffset(pts);
+
         auto functor = KOKKOS_CLASS_LAMBDA (typename Kokkos::TeamPolicy<ExecutionSpace>::member_type team_member) {
 
             // The index of the for loop
@@ -511,7 +975,7 @@ public:
                 Kokkos::View<double*,MemorySpace> cache(team_member.thread_scratch(1), cacheSize);
 
                 // Precompute anything that does not depend on x_d.  The DerivativeFlags::None arguments specifies that we won't want to derivative wrt to x_i for i<d
-                expansion_.FillCache1(cache.data(), pt, DerivativeFlags::None);
+                FillCache1(cache.data(), pt, (frozenOffset<0) ? -1 : int(frozenOffset+ptInd), sharedBasis, ptInd);
 
                 // Fill in parts of the cache that depend on x_d.  Tell the expansion we're going to want first derivatives wrt x_d
                 expansion_.FillCache2(cache.data(), pt, pt(dim-1), DerivativeFlags::Diagonal);
@@ -579,6 +1043,7 @@ public:
         @param[in] coeffs The ceofficients in an expansion for \f$f\f$.
         @param[out] evals  The values of the map component itself \f$\tilde{T}\f$ at each point.
         @param[out] derivs Kokkos::View<double*> The values of \f$ \frac{\partial \tilde{T}}{\partial x_D}\f$ at each point.
+        @param[in] sharedBasis Optional basis evaluations at `pts`.  See SharedBasisTable.
 
         @see ContinuousDerivative
      */
@@ -586,7 +1051,8 @@ public:
     void  DiscreteDerivative(StridedMatrix<const double, MemorySpace> const& pts,
                              StridedVector<const double, MemorySpace> const& coeffs,
                              StridedVector<double, MemorySpace>              evals,
-                             StridedVector<double, MemorySpace>              derivs)
+                             StridedVector<double, MemorySpace>              derivs,
+                             SharedBasisTable<MemorySpace>            const& sharedBasis = SharedBasisTable<MemorySpace>())
     {
         const unsigned int numPts = pts.extent(1);
         const unsigned int numTerms = coeffs.extent(0);
@@ -597,11 +1063,13 @@ public:
         const unsigned int cacheSize = expansion_.CacheSize();
 
         quad_.SetDim(2);
-        const unsigned int workspaceSize = quad_.WorkspaceSize();
+        const unsigned int workspaceSize = exactSquare_ ? ExactWorkspaceSize() : quad_.WorkspaceSize();
 
         // Create a policy with enough scratch memory to cache the polynomial evaluations
         auto cacheBytes = Kokkos::View<double*,MemorySpace>::shmem_size(cacheSize+workspaceSize+2);
 
+        const int frozenOffset = FrozenOffset(pts);
+
         auto functor = KOKKOS_CLASS_LAMBDA (typename Kokkos::TeamPolicy<ExecutionSpace>::member_type team_member) {
 
             unsigned int ptInd = team_member.league_rank () * team_member.team_size () + team_member.team_rank ();
@@ -616,13 +1084,23 @@ public:
                 Kokkos::View<double*,MemorySpace> both(team_member.thread_scratch(1), 2);
 
                 // Fill in the cache with anything that doesn't depend on x_d
-                expansion_.FillCache1(cache.data(), pt, DerivativeFlags::None);
+                const int frozenInd = (frozenOffset<0) ? -1 : int(frozenOffset+ptInd);
+                FillCache1(cache.data(), pt, frozenInd, sharedBasis, ptInd);
+
+                // The closed form integral is exact, so the discrete and continuous derivatives coincide
+                if constexpr(exactSquare_){
+                    evals(ptInd) = EvaluateExact(cache.data(), workspace.data(), pt(dim_-1), coeffs, nugget_);
+
+                    expansion_.FillCache2(cache.data(), pt, pt(dim_-1), DerivativeFlags::Diagonal);
+                    derivs(ptInd) = PosFuncType::Evaluate(expansion_.DiagonalDerivative(cache.data(), coeffs, 1)) + nugget_;
+                    return;
+                }
 
                 // Create the integrand g( \partial_D f(x_1,...,x_{D-1},t))
                 MonotoneIntegrand<ExpansionType, PosFuncType, decltype(pt), decltype(coeffs), MemorySpace> integrand(cache.data(), expansion_, pt, coeffs, DerivativeFlags::Diagonal, nugget_);
 
                 // Compute \int_0^x g( \partial_D f(x_1,...,x_{D-1},t)) dt
-                quad_.Integrate(workspace.data(), integrand, 0, 1, both.data());
+                IntegrateDiagonal(quad_, workspace.data(), integrand, FrozenDiagonalTable(frozenInd), both.data());
                 evals(ptInd) = both(0);
                 derivs(ptInd) = both(1);
 
@@ -678,6 +1156,7 @@ public:
         @param[in] coeffs A vector of coefficients defining the function \f$f(\mathbf{x}; \mathbf{w})\f$.
         @param[out] evaluations A vector containing the \f$N\f$ predictions \f$y_d^{(i)}\f$.  The vector must be preallocated and have \f$N\f$ components when passed to this function.  An error will occur if this vector is not the correct size.
         @param[out] jacobian A matrix containing the \f$M\times N\f$ Jacobian matrix, where \f$M\f$ is the length of the parameter vector \f$\mathbf{w}\f$.  This matrix must be sized correctly or an error will occur.
+        @param[in] sharedBasis Optional basis evaluations at `pts`.  See SharedBasisTable.
 
         @see CoeffGradient
     */
@@ -685,7 +1164,8 @@ public:
     void CoeffJacobian(StridedMatrix<const double, MemorySpace>  const& pts,
                        StridedVector<const double, MemorySpace>  const& coeffs,
                        StridedVector<double, MemorySpace>               evaluations,
-                       StridedMatrix<double, MemorySpace>               jacobian)
+                       StridedMatrix<double, MemorySpace>               jacobian,
+                       SharedBasisTable<MemorySpace>             const& sharedBasis = SharedBasisTable<MemorySpace>())
     {
         const unsigned int numPts = pts.extent(1);
         const unsigned int numTerms = coeffs.extent(0);
@@ -695,11 +1175,13 @@ public:
         // Ask the expansion how much memory it would like for it's one-point cache
         const unsigned int cacheSize = expansion_.CacheSize();
         quad_.SetDim(numTerms+1);
-        const unsigned int workspaceSize = quad_.WorkspaceSize();
+        const unsigned int workspaceSize = exactSquare_ ? ExactWorkspaceSize() : quad_.WorkspaceSize();
 
         // Create a policy with enough scratch memory to cache the polynomial evaluations
         auto cacheBytes = Kokkos::View<double*,MemorySpace>::shmem_size(cacheSize+workspaceSize+numTerms+1);
 
+        const int frozenOffset = FrozenOffset(pts);
+
         auto functor = KOKKOS_CLASS_LAMBDA (typename Kokkos::TeamPolicy<ExecutionSpace>::member_type team_member) {
 
             unsigned int ptInd = team_member.league_rank () * team_member.team_size () + team_member.team_rank ();
@@ -715,13 +1197,21 @@ public:
                 Kokkos::View<double*,MemorySpace> integral(team_member.thread_scratch(1), numTerms+1);
 
                 // Fill in the cache with anything that doesn't depend on x_d
-                expansion_.FillCache1(cache.data(), pt, DerivativeFlags::None);
+                const int frozenInd = (frozenOffset<0) ? -1 : int(frozenOffset+ptInd);
+                FillCache1(cache.data(), pt, frozenInd, sharedBasis, ptInd);
+
+                // The closed form leaves the derivatives of T wrt each grouped coefficient v_a in the start of the workspace
+                if constexpr(exactSquare_){
+                    evaluations(ptInd) = EvaluateExact(cache.data(), workspace.data(), pt(dim_-1), coeffs, nugget_);
+                    expansion_.DiagonalCoefficientsGradient(cache.data(), workspace.data(), jacView);
+                    return;
+                }
 
                 // Create the integrand g( \partial_D f(x_1,...,x_{D-1},t))
                 MonotoneIntegrand<ExpansionType, PosFuncType, decltype(pt),decltype(coeffs), MemorySpace> integrand(cache.data(), expansion_, pt, coeffs, DerivativeFlags::Parameters, nugget_);
 
                 // Compute \int_0^x g( \partial_D f(x_1,...,x_{D-1},t)) dt as well as the gradient of this term wrt the coefficients of f
-                quad_.Integrate(workspace.data(), integrand, 0, 1, integral.data());
+                IntegrateDiagonal(quad_, workspace.data(), integrand, FrozenDiagonalTable(frozenInd), integral.data());
 
                 evaluations(ptInd) = integral(0);
 
@@ -740,6 +1230,190 @@ public:
         Kokkos::parallel_for(policy, functor);
     }
 
+    /** @brief Evaluates the component and its diagonal derivative in a single pass over the points.
+        @details Computes the same values as EvaluateImpl and either ContinuousDerivative or DiscreteDerivative, depending on the
+        `useContDeriv` argument of the constructor, but fills the part of the cache that does not depend on \f$x_D\f$ only once
+        per point.  When the discrete derivative is used, the evaluation and derivative also share the quadrature.
+        @param[in] pts A \f$D\times N\f$ matrix containing the points.  Each column is a point.
+        @param[in] coeffs The coefficients in the expansion defining \f$f\f$.
+        @param[out] evals Either an empty view or a vector of length \f$N\f$ to store \f$T(x)\f$.
+        @param[out] derivs Either an empty view or a vector of length \f$N\f$ to store \f$\partial T/\partial x_D\f$.
+        @param[in] sharedBasis Optional basis evaluations at `pts`.  See SharedBasisTable.
+    */
+    template<typename ExecutionSpace=typename MemoryToExecution<MemorySpace>::Space>
+    void EvaluateWithDerivative(StridedMatrix<const double, MemorySpace> const& pts,
+                                StridedVector<const double, MemorySpace> const& coeffs,
+                                StridedVector<double, MemorySpace>              evals,
+                                StridedVector<double, MemorySpace>              derivs,
+                                SharedBasisTable<MemorySpace>            const& sharedBasis = SharedBasisTable<MemorySpace>())
+    {
+        const unsigned int numPts = pts.extent(1);
+        const bool computeEvals = (evals.extent(0)>0);
+        const bool computeDerivs = (derivs.extent(0)>0);
+
+        // The discrete derivative is integrated together with the evaluation
+        const bool sharedQuad = !exactSquare_ && !useContDeriv_ && computeDerivs;
+
+        // Ask the expansion how much memory it would like for it's one-point cache
+        const unsigned int cacheSize = expansion_.CacheSize();
+        quad_.SetDim(sharedQuad ? 2 : 1);
+        const unsigned int workspaceSize = exactSquare_ ? ExactWorkspaceSize() : quad_.WorkspaceSize();
+
+        // Create a policy with enough scratch memory to cache the polynomial evaluations
+        auto cacheBytes = Kokkos::View<double*,MemorySpace>::shmem_size(cacheSize+workspaceSize+2);
+
+        const int frozenOffset = FrozenOffset(pts);
+
+        auto functor = KOKKOS_CLASS_LAMBDA (typename Kokkos::TeamPolicy<ExecutionSpace>::member_type team_member) {
+
+            unsigned int ptInd = team_member.league_rank () * team_member.team_size () + team_member.team_rank ();
+
+            if(ptInd<numPts){
+                // Create a subview containing only the current point
+                auto pt = Kokkos::subview(pts, Kokkos::ALL(), ptInd);
+                const double xd = pt(dim_-1);
+
+                // Get a pointer to the shared memory Kokkos is managing for the cache
+                Kokkos::View<double*,MemorySpace> cache(team_member.thread_scratch(1), cacheSize);
+                Kokkos::View<double*,MemorySpace> workspace(team_member.thread_scratch(1), workspaceSize);
+                Kokkos::View<double*,MemorySpace> both(team_member.thread_scratch(1), 2);
+
+                // Fill in the cache with anything that doesn't depend on x_d
+                const int frozenInd = (frozenOffset<0) ? -1 : int(frozenOffset+ptInd);
+                FillCache1(cache.data(), pt, frozenInd, sharedBasis, ptInd);
+
+                if(sharedQuad){
+                    // Compute \int_0^x g( \partial_D f(x_1,...,x_{D-1},t)) dt and its derivative wrt x_d
+                    MonotoneIntegrand<ExpansionType, PosFuncType, decltype(pt), decltype(coeffs), MemorySpace> integrand(cache.data(), expansion_, pt, coeffs, DerivativeFlags::Diagonal, nugget_);
+                    IntegrateDiagonal(quad_, workspace.data(), integrand, FrozenDiagonalTable(frozenInd), both.data());
+                    derivs(ptInd) = both(1);
+
+                    // EvaluateImpl does not include the nugget, which adds exactly nugget*x_d to the integral
+                    if(computeEvals){
+                        expansion_.FillCache2(cache.data(), pt, 0.0, DerivativeFlags::None);
+                        evals(ptInd) = both(0) - nugget_*xd + expansion_.Evaluate(cache.data(), coeffs);
+                    }
+                    return;
+                }
+
+                if(computeEvals){
+                    if constexpr(exactSquare_){
+                        evals(ptInd) = EvaluateExact(cache.data(), workspace.data(), xd, coeffs, 0.0);
+                    }else{
+                        evals(ptInd) = EvaluateSingle(cache.data(), workspace.data(), pt, xd, coeffs, quad_, expansion_, 0.0, FrozenDiagonalTable(frozenInd));
+                    }
+                }
+
+                if(computeDerivs){
+                    // The closed form integral is exact, so the discrete derivative only differs from the continuous one by the nugget
+                    expansion_.FillCache2(cache.data(), pt, xd, DerivativeFlags::Diagonal);
+                    derivs(ptInd) = PosFuncType::Evaluate(expansion_.DiagonalDerivative(cache.data(), coeffs, 1)) + (useContDeriv_ ? 0.0 : nugget_);
+                }
+            }
+        };
+
+        auto policy = GetCachedRangePolicy<ExecutionSpace>(numPts, cacheBytes, functor);
+        Kokkos::parallel_for(policy, functor);
+    }
+
+    /** @brief Computes \f$s\nabla_{\mathbf{w}} T(x) + \nabla_{\mathbf{w}}\log\partial_D T(x)\f$ in a single pass over the points.
+        @details Combines CoeffJacobian and ContinuousMixedJacobian, so the cache is filled once per point for both terms.  The
+        evaluations and diagonal derivatives are by-products and can optionally be returned.  Only available when the continuous
+        derivative is used or the integral is computed in closed form.
+        @param[in] pts A \f$D\times N\f$ matrix containing the points.  Each column is a point.
+        @param[in] coeffs The coefficients in the expansion defining \f$f\f$.
+        @param[in] sens The sensitivity \f$s\f$ at each point.
+        @param[out] evals Either an empty view or a vector of length \f$N\f$ to store \f$T(x)\f$ as computed by EvaluateImpl.
+        @param[out] derivs Either an empty view or a vector of length \f$N\f$ to store \f$\partial T/\partial x_D\f$.
+        @param[out] output A matrix with one row per coefficient and \f$N\f$ columns to store the gradient.
+        @param[in] sharedBasis Optional basis evaluations at `pts`.  See SharedBasisTable.
+    */
+    template<typename ExecutionSpace=typename MemoryToExecution<MemorySpace>::Space>
+    void CoeffGradWithDerivative(StridedMatrix<const double, MemorySpace> const& pts,
+                                 StridedVector<const double, MemorySpace> const& coeffs,
+                                 StridedVector<const double, MemorySpace> const& sens,
+                                 StridedVector<double, MemorySpace>              evals,
+                                 StridedVector<double, MemorySpace>              derivs,
+                                 StridedMatrix<double, MemorySpace>              output,
+                                 SharedBasisTable<MemorySpace>            const& sharedBasis = SharedBasisTable<MemorySpace>())
+    {
+        const unsigned int numPts = pts.extent(1);
+        const unsigned int numTerms = coeffs.extent(0);
+        const bool computeEvals = (evals.extent(0)>0);
+        const bool computeDerivs = (derivs.extent(0)>0);
+
+        if(!useContDeriv_ && !exactSquare_){
+            ProcAgnosticError<MemorySpace,std::invalid_argument>::error("CoeffGradWithDerivative: Only available with the continuous derivative or a closed form integral.");
+        }
+        checkJacobianInput("CoeffGradWithDerivative", output.extent(0), output.extent(1), sens.extent(0), numTerms, numPts, numPts);
+
+        // Ask the expansion how much memory it would like for it's one-point cache
+        const unsigned int cacheSize = expansion_.CacheSize();
+        quad_.SetDim(numTerms+1);
+        const unsigned int workspaceSize = exactSquare_ ? ExactWorkspaceSize() : quad_.WorkspaceSize();
+
+        // Create a policy with enough scratch memory to cache the polynomial evaluations
+        auto cacheBytes = Kokkos::View<double*,MemorySpace>::shmem_size(cacheSize+workspaceSize+2*numTerms+1);
+
+        const int frozenOffset = FrozenOffset(pts);
+
+        auto functor = KOKKOS_CLASS_LAMBDA (typename Kokkos::TeamPolicy<ExecutionSpace>::member_type team_member) {
+
+            unsigned int ptInd = team_member.league_rank () * team_member.team_size () + team_member.team_rank ();
+
+            if(ptInd<numPts){
+                // Create a subview containing only the current point
+                auto pt = Kokkos::subview(pts, Kokkos::ALL(), ptInd);
+                auto gradView = Kokkos::subview(output, Kokkos::ALL(), ptInd);
+                const double xd = pt(dim_-1);
+
+                // Get a pointer to the shared memory that Kokkos has set up for the cache
+                Kokkos::View<double*,MemorySpace> cache(team_member.thread_scratch(1), cacheSize);
+                Kokkos::View<double*,MemorySpace> workspace(team_member.thread_scratch(1), workspaceSize);
+                Kokkos::View<double*,MemorySpace> integral(team_member.thread_scratch(1), numTerms+1);
+                Kokkos::View<double*,MemorySpace> mixed(team_member.thread_scratch(1), numTerms);
+
+                // Fill in the cache with anything that doesn't depend on x_d
+                const int frozenInd = (frozenOffset<0) ? -1 : int(frozenOffset+ptInd);
+                FillCache1(cache.data(), pt, frozenInd, sharedBasis, ptInd);
+
+                // Gradient of T wrt the coefficients, as in CoeffJacobian
+                double eval;
+                if constexpr(exactSquare_){
+                    eval = EvaluateExact(cache.data(), workspace.data(), xd, coeffs, nugget_);
+                    expansion_.DiagonalCoefficientsGradient(cache.data(), workspace.data(), gradView);
+                }else{
+                    MonotoneIntegrand<ExpansionType, PosFuncType, decltype(pt),decltype(coeffs), MemorySpace> integrand(cache.data(), expansion_, pt, coeffs, DerivativeFlags::Parameters, nugget_);
+                    IntegrateDiagonal(quad_, workspace.data(), integrand, FrozenDiagonalTable(frozenInd), integral.data());
+
+                    expansion_.FillCache2(cache.data(), pt, 0.0, DerivativeFlags::None);
+                    eval = integral(0) + expansion_.CoeffDerivative(cache.data(), coeffs, gradView);
+                    for(unsigned int termInd=0; termInd<numTerms; ++termInd)
+                        gradView(termInd) += integral(termInd+1);
+                }
+
+                // EvaluateImpl does not include the nugget, which adds exactly nugget*x_d to the integral
+                if(computeEvals)
+                    evals(ptInd) = eval - nugget_*xd;
+
+                // Gradient of log(g(\partial_D f)) wrt the coefficients, as in ContinuousMixedJacobian
+                expansion_.FillCache2(cache.data(), pt, xd, DerivativeFlags::Diagonal);
+                double df = expansion_.MixedCoeffDerivative(cache.data(), coeffs, 1, mixed);
+                double deriv = PosFuncType::Evaluate(df) + (useContDeriv_ ? 0.0 : nugget_);
+                double scale = PosFuncType::Derivative(df) / deriv;
+
+                if(computeDerivs)
+                    derivs(ptInd) = deriv;
+
+                for(unsigned int termInd=0; termInd<numTerms; ++termInd)
+                    gradView(termInd) = sens(ptInd)*gradView(termInd) + scale*mixed(termInd);
+            }
+        };
+
+        auto policy = GetCachedRangePolicy<ExecutionSpace>(numPts, cacheBytes, functor);
+        Kokkos::parallel_for(policy, functor);
+    }
+
     /** @brief Returns the gradient of the map with respect to the input \f$x_{1:d}\f$ at multiple points.
 
         @details
@@ -838,6 +1512,8 @@ public:
         // Create a policy with enough scratch memory to cache the polynomial evaluations
         auto cacheBytes = Kokkos::View<double*,MemorySpace>::shmem_size(cacheSize);
 
+        const int frozenOffset = FrozenOffset(pts);
+
         auto functor = KOKKOS_CLASS_LAMBDA (typename Kokkos::TeamPolicy<ExecutionSpace>::member_type team_member) {
 
             // The index of the for loop
@@ -852,7 +1528,7 @@ public:
                 Kokkos::View<double*,MemorySpace> cache(team_member.thread_scratch(1), cacheSize);
 
                 // Precompute anything that does not depend on x_d.  The DerivativeFlags::None arguments specifies that we won't want to derivative wrt to x_i for i<d
-                expansion_.FillCache1(cache.data(), pt, DerivativeFlags::None);
+                FillCache1(cache.data(), pt, (frozenOffset<0) ? -1 : int(frozenOffset+ptInd));
 
                 // Fill in parts of the cache that depend on x_d.  Tell the expansion we're going to want first derivatives wrt x_d
                 expansion_.FillCache2(cache.data(), pt, pt(dim-1), DerivativeFlags::Diagonal);
@@ -935,6 +1611,12 @@ public:
 
         checkMixedJacobianInput("DiscreteMixedJacobian", jacobian.extent(0), jacobian.extent(1), numTerms, numPts);
 
+        // The closed form integral is exact, so the discrete and continuous derivatives coincide
+        if constexpr(exactSquare_){
+            ContinuousMixedJacobian<ExecutionSpace>(pts, coeffs, jacobian);
+            return;
+        }
+
         // Ask the expansion how much memory it would like for it's one-point cache
         const unsigned int cacheSize = expansion_.CacheSize();
         quad_.SetDim(numTerms+1);
@@ -943,6 +1625,8 @@ public:
         // Create a policy with enough scratch memory to cache the polynomial evaluations
         auto cacheBytes = Kokkos::View<double*,MemorySpace>::shmem_size(cacheSize+workspaceSize+2*numTerms+1);
 
+        const int frozenOffset = FrozenOffset(pts);
+
         auto functor = KOKKOS_CLASS_LAMBDA (typename Kokkos::TeamPolicy<ExecutionSpace>::member_type team_member) {
 
             unsigned int ptInd = team_member.league_rank () * team_member.team_size () + team_member.team_rank ();
@@ -958,14 +1642,15 @@ public:
                 Kokkos::View<double*,MemorySpace> integral(team_member.thread_scratch(1), numTerms+1);
 
                 // Fill in the cache with anything that doesn't depend on x_d
-                expansion_.FillCache1(cache.data(), pt, DerivativeFlags::None);
+                const int frozenInd = (frozenOffset<0) ? -1 : int(frozenOffset+ptInd);
+                FillCache1(cache.data(), pt, frozenInd);
 
                 // Create the integrand g( \partial_D f(x_1,...,x_{D-1},t))
                 Kokkos::View<double*,MemorySpace> integrandWork(team_member.thread_scratch(1), numTerms);
                 MonotoneIntegrand<ExpansionType, PosFuncType,  decltype(pt), decltype(coeffs), MemorySpace> integrand(cache.data(), expansion_, pt, coeffs, DerivativeFlags::MixedCoeff, nugget_, integrandWork);
 
                 // Compute \int_0^x g( \partial_D f(x_1,...,x_{D-1},t)) dt as well as the gradient of this term wrt the coefficients of f
-                quad_.Integrate(workspace.data(), integrand, 0, 1, integral.data());
+                IntegrateDiagonal(quad_, workspace.data(), integrand, FrozenDiagonalTable(frozenInd), integral.data());
 
                 // Add the Integral to the coefficient gradient
                 for(unsigned int termInd=0; termInd<numTerms; ++termInd)
@@ -987,6 +1672,7 @@ public:
      @param workspace  Memory used by the quadrature routine to store evaluations
      @param pt
      @param coeffs
+     @param diagTable Optional basis values in \f$x_d\f$ at the quadrature nodes (see MonotoneIntegrand::SetDiagonalTable).  Only used with quadrature rules that have fixed nodes and when `xd` is the value the table was computed for.
      @return double
      */
     template<typename PointType, typename CoeffsType>
@@ -997,7 +1683,8 @@ public:
                                                  CoeffsType        const& coeffs,
                                                  QuadratureType    const& quad,
                                                  ExpansionType     const& expansion,
-                                                 double                   nugget=0.0)
+                                                 double                   nugget=0.0,
+                                                 const double*            diagTable=nullptr)
     {
         double output = 0.0;
         // Compute the integral \int_0^1 g( \partial_D f(x_1,...,x_{D-1},t*x_d)) dt
@@ -1008,7 +1695,7 @@ public:
                                                                                        coeffs,
                                                                                        DerivativeFlags::None,
                                                                                        nugget);
-        quad.Integrate(workspace, integrand, 0, 1, &output);
+        IntegrateDiagonal(quad, workspace, integrand, diagTable, &output);
 
         expansion.FillCache2(cache, pt, 0.0, DerivativeFlags::None);
         output += expansion.Evaluate(cache, coeffs);
@@ -1016,10 +1703,56 @@ public:
         return output;
     }
 
+    /** @brief Evaluates the monotone function in closed form when \f$g(x)=x^2\f$ and the expansion provides the integrals of its basis products.
+     @details Requires the cache to have been filled with FillCache1.  Upon return, the first \f$P_D+1\f$ entries of `workspace` contain the
+     derivatives of the output with respect to the grouped coefficients \f$v_a\f$ (see MultivariateExpansionWorker::DiagonalCoefficients),
+     which is used to compute the gradient with respect to the coefficients.
+     @param cache The expansion cache, filled by FillCache1.
+     @param workspace Memory for ExactWorkspaceSize() doubles.
+     @param xd The value of \f$x_D\f$.
+     @param coeffs The coefficients in the expansion defining \f$f\f$.
+     @param nugget The nugget \f$\epsilon\f$ added to the integrand.
+     */
+    template<typename CoeffsType>
+    KOKKOS_FUNCTION double EvaluateExact(double*           cache,
+                                         double*           workspace,
+                                         double            xd,
+                                         CoeffsType const& coeffs,
+                                         double            nugget) const
+    {
+        const unsigned int maxOrder = diagIntegrals_.extent(0)-1;
+        const unsigned int numCoeffs = diagIntegrals_.extent(2);
+
+        double* weights = workspace;
+        double* diagCoeffs = weights + maxOrder + 1;
+        double* zeroVals = diagCoeffs + maxOrder + 1;
+        double* vals = zeroVals + maxOrder + 1;
+
+        expansion_.DiagonalCoefficients(cache, coeffs, diagCoeffs);
+        expansion_.EvaluateDiagonalBasis(zeroVals, maxOrder, 0.0);
+        expansion_.EvaluateDiagonalBasis(vals, numCoeffs-1, xd);
+
+        // f(x_1,...,x_{D-1},0) = v_0 + \sum_a v_a \phi_a(0) and the integral \sum_{a,b} v_a v_b \int_0^{x_D} \phi_a^\prime \phi_b^\prime dt
+        double output = diagCoeffs[0] + nugget*xd;
+        weights[0] = 1.0;
+        for(unsigned int a=1; a<=maxOrder; ++a){
+            double integral = 0.0;
+            for(unsigned int b=1; b<=maxOrder; ++b){
+                double prodIntegral = 0.0;
+                for(unsigned int c=0; c<numCoeffs; ++c)
+                    prodIntegral += diagIntegrals_(a,b,c)*vals[c];
+                integral += diagCoeffs[b]*prodIntegral;
+            }
+            output += diagCoeffs[a]*(zeroVals[a] + integral);
+            weights[a] = zeroVals[a] + 2.0*integral;
+        }
+        return output;
+    }
+
     /** Give access to the underlying FixedMultiIndexSet
      * @return The FixedMultiIndexSet
      */
-    FixedMultiIndexSet<MemorySpace> GetMultiIndexSet() const {
+    FixedMultiIndexSet<MemorySpace> GetMultiIndexSet() const override {
         return expansion_.GetMultiIndexSet();
     }
 
@@ -1071,6 +1804,198 @@ private:
     bool useContDeriv_;
     double nugget_;
 
+    /// Inverse options used by the ConditionalMapBase interface (see SetInverseOptions)
+    bool inverseUseNewton_ = false;
+    double inverseXTol_ = 1e-6;
+    double inverseYTol_ = 1e-6;
+    unsigned int inverseSurrogateNodes_ = 0;
+    bool inverseSurrogatePolish_ = true;
+
+    /** @brief Extracts and validates the inverse options described in InverseImpl. */
+    static void ParseInverseOptions(std::map<std::string, std::string> options,
+                                    bool&                              useNewton,
+                                    double&                            xtol,
+                                    double&                            ytol,
+                                    unsigned int&                      surrogateNodes,
+                                    bool&                              surrogatePolish)
+    {
+        // Extract the method from the options map
+        std::string method;
+        if(options.count("Method")){
+            method = options["Method"];
+        }else{
+            method = "Bracket";
+        }
+
+        // Check to make sure the method is valid
+        if((method!="Bracket")&&(method!="Newton")){
+            std::stringstream msg;
+            msg << "Invalid method given to MonotoneComponent::Inverse.  Given \"" << method << "\", but valid options are [\"Bracket\", \"Newton\"].";
+            throw std::invalid_argument(msg.str());
+        }
+        useNewton = (method=="Newton");
+
+        // Extract the xtol and ytol option if they exist
+        if(options.count("xtol")){
+            xtol = std::stod(options["xtol"]);
+            if(xtol<0){
+                std::stringstream msg;
+                msg << "Invalid tolerance \"xtol\" given to MonotoneComponent::Inverse.  Value must be non-negative, but given " << xtol;
+                throw std::invalid_argument(msg.str());
+            }
+        }else{
+            xtol = 1e-6;
+        }
+        if(options.count("ytol")){
+            ytol = std::stod(options["ytol"]);
+            if(ytol<0){
+                std::stringstream msg;
+                msg << "Invalid tolerance \"ytol\" given to MonotoneComponent::Inverse.  Value must be non-negative, but given " << ytol;
+                throw std::invalid_argument(msg.str());
+            }
+        }else{
+            ytol = 1e-6;
+        }
+
+        if((ytol<=std::numeric_limits<double>::epsilon())&&(xtol<=std::numeric_limits<double>::epsilon())){
+            std::stringstream msg;
+            msg << "Invalid tolerances given to MonotoneComponent::Inverse.  Either \"xtol\" or \"ytol\" must be nonzero, but given values are " << xtol << " and " << ytol;
+            throw std::invalid_argument(msg.str());
+        }
+
+        // Extract the options for the tabulated surrogate
+        surrogateNodes = 0;
+        if(options.count("SurrogateNodes")){
+            int nodes = std::stoi(options["SurrogateNodes"]);
+            if((nodes<0)||(nodes==1)){
+                std::stringstream msg;
+                msg << "Invalid option \"SurrogateNodes\" given to MonotoneComponent::Inverse.  Value must be 0 or at least 2, but given " << nodes;
+                throw std::invalid_argument(msg.str());
+            }
+            surrogateNodes = nodes;
+        }
+
+        surrogatePolish = true;
+        if(options.count("SurrogatePolish")){
+            std::string polish = options["SurrogatePolish"];
+            if((polish!="true")&&(polish!="false")){
+                std::stringstream msg;
+                msg << "Invalid option \"SurrogatePolish\" given to MonotoneComponent::Inverse.  Given \"" << polish << "\", but valid options are [\"true\", \"false\"].";
+                throw std::invalid_argument(msg.str());
+            }
+            surrogatePolish = (polish=="true");
+        }
+    }
+
+    /// Whether the integral is computed in closed form, which requires g(x)=x^2 and an expansion that can integrate products of its basis functions
+    static constexpr bool exactSquare_ = std::is_same_v<PosFuncType,Square> && HasDiagonalProductIntegrals<ExpansionType>::value;
+
+    /// Whether the expansion can copy its basis values in x_1,...,x_{D-1} from a SharedBasisTable (see MultivariateExpansionWorker::CopyCache1)
+    static constexpr bool canShareBasis_ = HasSharedBasis<ExpansionType>::value;
+
+    /// For closed form components, the integrals of products of the derivatives of the basis in x_d (see MultivariateExpansionWorker::DiagonalProductIntegrals)
+    Kokkos::View<double***, Kokkos::LayoutRight, MemorySpace> diagIntegrals_;
+
+    /** @brief Number of doubles used by EvaluateExact. */
+    unsigned int ExactWorkspaceSize() const
+    {
+        return 3*diagIntegrals_.extent(0) + diagIntegrals_.extent(2);
+    }
+
+    /// Points passed to FreezeData and the x_d-independent cache values at each of them (one column per point)
+    StridedMatrix<const double, MemorySpace> frozenPts_;
+    Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> frozenCache_;
+
+    /// Whether the quadrature rule has fixed nodes, which allows the basis in x_d to be tabulated at each node by FreezeData
+    static constexpr bool hasFixedNodes_ = std::is_same_v<QuadratureType, ClenshawCurtisQuadrature<MemorySpace>> || std::is_same_v<QuadratureType, GaussLegendreQuadrature<MemorySpace>>;
+
+    /// For quadrature rules with fixed nodes, the basis values in x_d at every quadrature node of every frozen point (one column per point)
+    Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> frozenDiagTable_;
+
+    /** @brief Returns the column of the frozen cache matching the first column of `pts`, or -1 if `pts` is not a column range of the frozen points. */
+    template<class ViewType>
+    int FrozenOffset(ViewType const& pts) const
+    {
+        if((frozenCache_.extent(1)==0) || (pts.extent(1)==0) || (pts.extent(0)!=frozenPts_.extent(0)))
+            return -1;
+        if((pts.stride(0)!=frozenPts_.stride(0)) || (pts.stride(1)!=frozenPts_.stride(1)) || (frozenPts_.stride(1)==0))
+            return -1;
+
+        std::ptrdiff_t diff = pts.data() - frozenPts_.data();
+        if((diff<0) || (diff % frozenPts_.stride(1) != 0))
+            return -1;
+
+        std::size_t offset = diff / frozenPts_.stride(1);
+        if(offset + pts.extent(1) > frozenPts_.extent(1))
+            return -1;
+
+        return offset;
+    }
+
+    /** @brief Fills the x_d-independent part of the cache, either from column `frozenInd` of the frozen cache or, when `frozenInd` is negative, by calling `FillCache1` on the expansion. */
+    template<typename PointType>
+    KOKKOS_FUNCTION void FillCache1(double* cache, PointType const& pt, int frozenInd) const
+    {
+        if(frozenInd>=0){
+            for(unsigned int i=0; i<frozenCache_.extent(0); ++i)
+                cache[i] = frozenCache_(i,frozenInd);
+        }else{
+            expansion_.FillCache1(cache, pt, DerivativeFlags::None);
+        }
+    }
+
+    /** @brief Replaces each diagonal derivative in `vals` by its log, using \f$-\infty\f$ for nonpositive values. */
+    static void TakeLog(StridedVector<double, MemorySpace> vals)
+    {
+        auto policy = Kokkos::RangePolicy<typename MemoryToExecution<MemorySpace>::Space>(0,vals.extent(0));
+        Kokkos::parallel_for(policy, KOKKOS_LAMBDA (unsigned int i) {
+            if(vals(i)<=0){
+                vals(i) = -std::numeric_limits<double>::infinity();
+            }else{
+                vals(i) = std::log(vals(i));
+            }
+        });
+    }
+
+    /** @brief Same as above, but when `frozenInd` is negative and `sharedBasis` is not empty, the basis values are copied from column `ptInd` of `sharedBasis`. */
+    template<typename PointType>
+    KOKKOS_FUNCTION void FillCache1(double* cache, PointType const& pt, int frozenInd, SharedBasisTable<MemorySpace> const& sharedBasis, unsigned int ptInd) const
+    {
+        if constexpr(canShareBasis_){
+            if((frozenInd<0) && !sharedBasis.IsEmpty()){
+                expansion_.CopyCache1(cache, sharedBasis, ptInd);
+                return;
+            }
+        }
+        FillCache1(cache, pt, frozenInd);
+    }
+
+    /** @brief Returns the frozen basis values in x_d at the quadrature nodes for column `frozenInd` of the frozen points, or nullptr if there are none. */
+    KOKKOS_FUNCTION const double* FrozenDiagonalTable(int frozenInd) const
+    {
+        if((frozenInd<0) || (frozenDiagTable_.extent(0)==0))
+            return nullptr;
+        return &frozenDiagTable_(0,frozenInd);
+    }
+
+    /** @brief Integrates over \f$t\in[0,1]\f$, using the node tables in `diagTable` when the quadrature rule has fixed nodes. */
+    template<typename IntegrandType>
+    KOKKOS_FUNCTION static void IntegrateDiagonal(QuadratureType const& quad,
+                                                  double*               workspace,
+                                                  IntegrandType&        integrand,
+                                                  const double*         diagTable,
+                                                  double*               res)
+    {
+        if constexpr(hasFixedNodes_){
+            if(diagTable){
+                integrand.SetDiagonalTable(diagTable);
+                quad.IntegrateIndexed(workspace, integrand, 0, 1, res);
+                return;
+            }
+        }
+        quad.Integrate(workspace, integrand, 0, 1, res);
+    }
+
 
     template<typename PointType, typename CoeffType>
     struct SingleEvaluator {
@@ -1087,6 +2012,18 @@ private:
         double operator()(double x) {
             return EvaluateSingle(cache, workspace, pt, x, coeffs, quad, expansion, nugget);
         }
+
+        /** Evaluates the component and its first two derivatives with respect to \f$x_D\f$, using the continuous derivative. */
+        void ValueAndDerivatives(double x, double& f, double& df, double& d2f) {
+            f = EvaluateSingle(cache, workspace, pt, x, coeffs, quad, expansion, nugget);
+
+            expansion.FillCache2(cache, pt, x, DerivativeFlags::Diagonal2);
+            const double fd = expansion.DiagonalDerivative(cache, coeffs, 1);
+            const double fdd = expansion.DiagonalDerivative(cache, coeffs, 2);
+
+            df = PosFuncType::Evaluate(fd) + nugget;
+            d2f = PosFuncType::Derivative(fd) * fdd;
+        }
     };
 };
 
@@ -1111,6 +2048,14 @@ CEREAL_FORCE_DYNAMIC_INIT(mpartInitMapFactory15)
 CEREAL_FORCE_DYNAMIC_INIT(mpartInitMapFactory16)
 CEREAL_FORCE_DYNAMIC_INIT(mpartInitMapFactory17)
 CEREAL_FORCE_DYNAMIC_INIT(mpartInitMapFactory18)
+CEREAL_FORCE_DYNAMIC_INIT(mpartInitMapFactory19)
+CEREAL_FORCE_DYNAMIC_INIT(mpartInitMapFactory20)
+CEREAL_FORCE_DYNAMIC_INIT(mpartInitMapFactory21)
+CEREAL_FORCE_DYNAMIC_INIT(mpartInitMapFactory22)
+CEREAL_FORCE_DYNAMIC_INIT(mpartInitMapFactory23)
+CEREAL_FORCE_DYNAMIC_INIT(mpartInitMapFactory24)
+CEREAL_FORCE_DYNAMIC_INIT(mpartInitMapFactory25)
+CEREAL_FORCE_DYNAMIC_INIT(mpartInitMapFactory26)
 #endif
 
 #endif
\ No newline at end of file
@@ -116,6 +116,48 @@ public:
      taken care of inside this function.
     */
     KOKKOS_INLINE_FUNCTION void operator()(double t, double* output) const
+    {
+        // Finish filling in the cache at the quadrature point (FillCache1 is called outside this class)
+        expansion_.FillCache2(cache_, pt_, t*xd_, DiagonalCacheType());
+        EvaluateFromCache(t, output);
+    }
+
+    /**
+     Same as the operator above, but for the quadrature node with index `node`.  If a table was given to SetDiagonalTable, the
+     values of the basis in \f$x_d\f$ are copied from the table instead of being evaluated at \f$t x_d\f$.
+    */
+    KOKKOS_INLINE_FUNCTION void operator()(double t, unsigned int node, double* output) const
+    {
+        if(diagTable_){
+            expansion_.CopyDiagonalTable(cache_, &diagTable_[node*expansion_.DiagonalTableSize()], DiagonalCacheType());
+        }else{
+            expansion_.FillCache2(cache_, pt_, t*xd_, DiagonalCacheType());
+        }
+        EvaluateFromCache(t, output);
+    }
+
+    /**
+     @brief Sets precomputed values of the basis in \f$x_d\f$ at the nodes of a fixed quadrature rule.
+     @param table A pointer to consecutive tables computed by `ExpansionType::FillDiagonalTable`, one for each quadrature node.  The table
+                  for node \f$i\f$ must have been computed at \f$t_i x_d\f$, where \f$t_i\f$ is the value passed to operator() with index \f$i\f$.
+    */
+    KOKKOS_INLINE_FUNCTION void SetDiagonalTable(const double* table){diagTable_ = table;}
+
+    void setFailOnNaN(bool shouldFailOnNaN) {failOnNaN = shouldFailOnNaN;}
+private:
+
+    /** Derivative information in x_d that needs to be in the cache at each quadrature point. */
+    KOKKOS_INLINE_FUNCTION DerivativeFlags::DerivativeType DiagonalCacheType() const
+    {
+        if((derivType_==DerivativeFlags::Diagonal)||(derivType_==DerivativeFlags::MixedCoeff)||(derivType_==DerivativeFlags::Input)){
+            return DerivativeFlags::Diagonal2;
+        }else{
+            return DerivativeFlags::Diagonal;
+        }
+    }
+
+    /** Evaluates the integrand once the cache has been filled at the quadrature point. */
+    KOKKOS_INLINE_FUNCTION void EvaluateFromCache(double t, double* output) const
     {
         const unsigned int numTerms = expansion_.NumCoeffs();
         const unsigned int dim = pt_.size();
@@ -128,13 +170,6 @@ public:
         if((derivType_==DerivativeFlags::Input) || (derivType_==DerivativeFlags::MixedInput))
             numOutputs += dim;
 
-        // Finish filling in the cache at the quadrature point (FillCache1 is called outside this class)
-        if((derivType_==DerivativeFlags::Diagonal)||(derivType_==DerivativeFlags::MixedCoeff)||(derivType_==DerivativeFlags::Input)){
-            expansion_.FillCache2(cache_, pt_, t*xd_, DerivativeFlags::Diagonal2);
-        }else{
-            expansion_.FillCache2(cache_, pt_, t*xd_, DerivativeFlags::Diagonal);
-        }
-
         // Use the cache to evaluate \partial_d f and, optionally, the gradient of \partial_d f wrt the coefficients or input.
         double df = 0;
         if(derivType_==DerivativeFlags::Parameters){
@@ -202,9 +237,6 @@ public:
         }
     }
 
-    void setFailOnNaN(bool shouldFailOnNaN) {failOnNaN = shouldFailOnNaN;}
-private:
-
     const unsigned int dim_;
     double* cache_;
     ExpansionType const& expansion_;
@@ -214,6 +246,7 @@ private:
     DerivativeFlags::DerivativeType derivType_;
     double nugget_;
     Kokkos::View<double*,MemorySpace> workspace_;
+    const double* diagTable_ = nullptr;
     bool failOnNaN = true;
 
 }; // class MonotoneIntegrand
@@ -44,6 +44,23 @@ public:
                        Kokkos::View<unsigned int*, MemorySpace> _nzStarts,
                        Kokkos::View<unsigned int*, MemorySpace> _nzDims,
                        Kokkos::View<unsigned int*, MemorySpace> _nzOrders);
+    /** @brief Wrap the arrays of a compressed multiindex set without copying or checking them.
+
+        Unlike the other compressed constructor, the dimensions within each multiindex must already be
+        sorted and `_maxDegrees` must hold the maximum order in each dimension.  The views are stored
+        directly, so they may be unmanaged views into memory owned elsewhere, e.g., a memory-mapped file.
+    */
+    FixedMultiIndexSet(unsigned int                             _dim,
+                       Kokkos::View<unsigned int*, MemorySpace> _nzStarts,
+                       Kokkos::View<unsigned int*, MemorySpace> _nzDims,
+                       Kokkos::View<unsigned int*, MemorySpace> _nzOrders,
+                       Kokkos::View<unsigned int*, MemorySpace> _maxDegrees): nzStarts(_nzStarts),
+                                                                              nzDims(_nzDims),
+                                                                              nzOrders(_nzOrders),
+                                                                              maxDegrees(_maxDegrees),
+                                                                              dim(_dim),
+                                                                              isCompressed(true) {}
+
     /*
     Constructs a total order limited multiindex set
     */
@@ -140,16 +157,6 @@ private:
                         unsigned int &currTerm,
                         unsigned int &currNz);
 
-    FixedMultiIndexSet(unsigned int                             _dim,
-                       Kokkos::View<unsigned int*, MemorySpace> _nzStarts,
-                       Kokkos::View<unsigned int*, MemorySpace> _nzDims,
-                       Kokkos::View<unsigned int*, MemorySpace> _nzOrders,
-                       Kokkos::View<unsigned int*, MemorySpace> _maxDegrees): dim(_dim),
-                                                                              isCompressed(true),
-                                                                              nzStarts(_nzStarts),
-                                                                              nzDims(_nzDims),
-                                                                              nzOrders(_nzOrders),
-                                                                              maxDegrees(_maxDegrees) {}
 
 }; // class MultiIndexSet
 
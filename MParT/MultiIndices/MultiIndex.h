@@ -1,6 +1,7 @@
 #ifndef MPART_MULTIINDEX_H_
 #define MPART_MULTIINDEX_H_
 
+#include <cstdint>
 #include <initializer_list>
 #include <string>
 #include <vector>
@@ -196,6 +197,12 @@ public:
      * @return true if this has a nonzero entry at the end
     */
     bool HasNonzeroEnd() const;
+
+    /** Computes a 64 bit hash of the multiindex.  Equal multiindices have equal hashes.
+        @return A hash of the length and of the nonzero components of the multiindex.
+    */
+    uint64_t Hash() const;
+
 private:
 
     unsigned int length;
@@ -0,0 +1,86 @@
+#ifndef MPART_MULTIINDEXADJACENCY_H_
+#define MPART_MULTIINDEXADJACENCY_H_
+
+#include <vector>
+
+namespace mpart{
+
+/** @class MultiIndexAdjacency
+    @brief Stores the edges between the multiindices in a MultiIndexSet in one contiguous array.
+    @details Each node owns a slab of the array that holds the indices of its neighbors in ascending order.  When a slab is
+             full, it is moved to the end of the array with twice the capacity.  The number of neighbors of a multiindex is
+             small (at most the length of the multiindex for the DefaultNeighborhood), so sorted insertion into a slab is much
+             cheaper than maintaining a separate tree for every node.
+
+             The ranges returned by operator[] are invalidated by any call to Insert, so callers that modify the graph while
+             iterating over the neighbors of a node should first copy the neighbors.
+*/
+class MultiIndexAdjacency{
+
+public:
+
+    /** A view of the sorted neighbors of a single node. */
+    struct Range{
+        const int* first;
+        const int* last;
+
+        const int* begin() const{return first;};
+        const int* end() const{return last;};
+        unsigned int size() const{return last-first;};
+        bool empty() const{return first==last;};
+    };
+
+    /** Appends a node without any edges. */
+    void AddNode(){slabs.push_back(Slab{0,0,0});};
+
+    /** Returns the number of nodes in the graph. */
+    unsigned int NumNodes() const{return slabs.size();};
+
+    /** Adds `neighbor` to the neighbors of `node` if it is not already there.
+        @return true if the edge was added, false if it already existed.
+    */
+    bool Insert(unsigned int node, int neighbor);
+
+    /** Removes `neighbor` from the neighbors of `node`.
+        @return true if the edge existed.
+    */
+    bool Erase(unsigned int node, int neighbor);
+
+    /** Removes all the neighbors of `node`. */
+    void Clear(unsigned int node){slabs.at(node).size = 0;};
+
+    /** Returns the neighbors of a node without bounds checking. */
+    Range operator[](unsigned int node) const{
+        Slab const& slab = slabs[node];
+        const int* first = data.data() + slab.start;
+        return Range{first, first+slab.size};
+    };
+
+    /** Returns the neighbors of a node, throwing std::out_of_range if the node does not exist. */
+    Range at(unsigned int node) const{
+        slabs.at(node);
+        return (*this)[node];
+    };
+
+    /** Returns a copy of the neighbors of a node. */
+    std::vector<int> Copy(unsigned int node) const{
+        Range range = at(node);
+        return std::vector<int>(range.begin(), range.end());
+    };
+
+private:
+
+    struct Slab{
+        unsigned int start;
+        unsigned int size;
+        unsigned int capacity;
+    };
+
+    std::vector<Slab> slabs;
+    std::vector<int> data;
+
+}; // class MultiIndexAdjacency
+
+} // namespace mpart
+
+#endif // MPART_MULTIINDEXADJACENCY_H_
@@ -0,0 +1,55 @@
+#ifndef MPART_MULTIINDEXHASHINDEX_H_
+#define MPART_MULTIINDEXHASHINDEX_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "MParT/MultiIndices/MultiIndex.h"
+
+namespace mpart{
+
+/** @class MultiIndexHashIndex
+    @brief An open addressing hash table mapping multiindices to their position in a vector of multiindices.
+    @details The table does not store copies of the multiindices.  Each slot only holds the 64 bit hash of a multiindex
+             and its position in an external vector, which acts as the storage for the keys.  Lookups use linear probing and
+             only compare full multiindices when the hashes match.  Because the keys are passed to Find, a copied table remains
+             valid for a copy of the vector it indexes.
+*/
+class MultiIndexHashIndex{
+
+public:
+
+    MultiIndexHashIndex() = default;
+
+    /** Returns the position of `multi` in `keys`, or -1 if the multiindex was never inserted.
+        @param[in] multi The multiindex to look for.
+        @param[in] keys The vector of multiindices indexed by this table.
+    */
+    int Find(MultiIndex const& multi, std::vector<MultiIndex> const& keys) const;
+
+    /** Adds a multiindex to the table.  The multiindex must not already be in the table.
+        @param[in] multi The new multiindex.
+        @param[in] index The position of `multi` in the vector of keys.
+    */
+    void Insert(MultiIndex const& multi, unsigned int index);
+
+    /** Returns the number of multiindices in the table. */
+    unsigned int Size() const{return numEntries;};
+
+private:
+
+    struct Slot{
+        uint64_t hash;
+        int index; // -1 for an empty slot
+    };
+
+    void Rehash(std::size_t newCapacity);
+
+    std::vector<Slot> slots;
+    unsigned int numEntries = 0;
+
+}; // class MultiIndexHashIndex
+
+} // namespace mpart
+
+#endif // MPART_MULTIINDEXHASHINDEX_H_
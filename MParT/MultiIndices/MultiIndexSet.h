@@ -3,8 +3,6 @@
 
 #include <vector>
 #include <memory>
-#include <set>
-#include <map>
 #include <iostream>
 #include <functional>
 
@@ -16,6 +14,8 @@
 #include "MParT/MultiIndices/FixedMultiIndexSet.h"
 #include "MParT/MultiIndices/MultiIndex.h"
 #include "MParT/MultiIndices/MultiIndexLimiter.h"
+#include "MParT/MultiIndices/MultiIndexHashIndex.h"
+#include "MParT/MultiIndices/MultiIndexAdjacency.h"
 
 
 
@@ -419,9 +419,9 @@ protected:
   // Maps a global index to an active index.  Non-active values are -1
   std::vector<int> global2active;
 
-  // a vector of sets for the input and output edges.
-  std::vector<std::set<int>> outEdges; // edges going out of each multi
-  std::vector<std::set<int>> inEdges;  // edges coming in to each multi
+  // the input and output edges, stored in flat arrays
+  MultiIndexAdjacency outEdges; // edges going out of each multi
+  MultiIndexAdjacency inEdges;  // edges coming in to each multi
 
   std::vector<unsigned int> maxOrders; // the maximum order in each dimension
 
@@ -442,7 +442,7 @@ private:
                                       LimiterType const& limiter);
 
   std::shared_ptr<MultiIndexNeighborhood> neighborhood;
-  std::map<MultiIndex, unsigned int> multi2global; // map from a multiindex to an integer
+  MultiIndexHashIndex multi2global; // hash table from a multiindex to its position in allMultis
 
 }; // class MultiIndexSet
 
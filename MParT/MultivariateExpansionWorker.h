@@ -12,6 +12,7 @@
 #include "MParT/Utilities/ArrayConversions.h"
 #include "MParT/Utilities/Miscellaneous.h"
 #include "MParT/BasisEvaluator.h"
+#include "MParT/SharedBasisTable.h"
 
 
 namespace mpart{
@@ -104,6 +105,9 @@ public:
         Kokkos::View<unsigned int*, MemorySpace> dCacheSize("Temporary cache size",1);
         Kokkos::parallel_for(Kokkos::RangePolicy<typename MemoryToExecution<MemorySpace>::Space>(0,1), CacheSizeFunctor<MemorySpace>(startPos_, dCacheSize));
         cacheSize_ = ToHost(dCacheSize)(0);
+        auto startPosHost = ToHost(startPos_);
+        cache1Size_ = startPosHost(dim_-1);
+        diagTableSize_ = 3*(startPosHost(dim_) - startPosHost(dim_-1));
     };
 
     MultivariateExpansionWorker(MultivariateExpansionWorker const& other) = default;
@@ -117,6 +121,23 @@ public:
         //return startPos_(startPos_.extent(0)-1);
     };
 
+    /**
+     @brief Returns the number of leading cache entries filled by FillCache1 when no derivatives are requested.
+     @details These entries only depend on \f$x_1,\ldots,x_{d-1}\f$, so they can be computed once for a fixed point set and copied
+              into the cache instead of calling FillCache1 with DerivativeFlags::None.
+     @return unsigned int The number of doubles written by FillCache1 with DerivativeFlags::None.
+     */
+    KOKKOS_INLINE_FUNCTION unsigned int Cache1Size() const {
+        return cache1Size_;
+    };
+
+    /**
+     @brief Returns the number of doubles needed by FillDiagonalTable to store the last-dimension basis values and their first two derivatives at one value of \f$x_d\f$.
+     */
+    KOKKOS_INLINE_FUNCTION unsigned int DiagonalTableSize() const {
+        return diagTableSize_;
+    };
+
     /**
      @brief Returns the number of coefficients in this expansion.
      @return unsigned int The number of terms in the multiindexset, which corresponds to the number of coefficients needed to define the expansion.
@@ -201,6 +222,51 @@ public:
     }
 
 
+    /**
+     @brief Evaluates the basis in the last dimension, along with its first and second derivatives, at \f$x_d\f$ and stores them contiguously.
+     @details The values in the table can later be copied into a cache with CopyDiagonalTable instead of calling FillCache2.  This is
+              useful when the same values of \f$x_d\f$ are used repeatedly, e.g., at the nodes of a fixed quadrature rule.
+     @param table A pointer to memory with space for at least DiagonalTableSize() doubles.
+     @param xd The value of \f$x_d\f$.
+
+     @see CopyDiagonalTable
+     */
+    KOKKOS_FUNCTION void FillDiagonalTable(double* table, double xd) const
+    {
+        const unsigned int numVals = maxDegrees_(dim_-1)+1;
+        basis1d_.EvaluateSecondDerivatives(dim_ - 1, table, &table[numVals], &table[2*numVals], maxDegrees_(dim_-1), xd);
+    }
+
+    /**
+     @brief Fills the parts of the cache that depend on \f$x_d\f$ using a table computed by FillDiagonalTable.
+     @details This is equivalent to calling FillCache2 with the same value of \f$x_d\f$ and derivative type.
+     @param polyCache A pointer to the start of the cache.
+     @param table A table previously filled by FillDiagonalTable.
+     @param derivType The type of derivatives that will be needed.  Only the entries that FillCache2 would fill are copied.
+
+     @see FillDiagonalTable, FillCache2
+     */
+    KOKKOS_FUNCTION void CopyDiagonalTable(double*                         polyCache,
+                                           const double*                   table,
+                                           DerivativeFlags::DerivativeType derivType) const
+    {
+        const unsigned int numVals = maxDegrees_(dim_-1)+1;
+
+        for(unsigned int i=0; i<numVals; ++i)
+            polyCache[startPos_(dim_-1)+i] = table[i];
+
+        if((derivType==DerivativeFlags::None)||(derivType==DerivativeFlags::Parameters))
+            return;
+
+        for(unsigned int i=0; i<numVals; ++i)
+            polyCache[startPos_(2*dim_-1)+i] = table[numVals+i];
+
+        if((derivType==DerivativeFlags::Diagonal2) || (derivType==DerivativeFlags::MixedInput)){
+            for(unsigned int i=0; i<numVals; ++i)
+                polyCache[startPos_(2*dim_)+i] = table[2*numVals+i];
+        }
+    }
+
     template<typename CoeffVecType>
     KOKKOS_FUNCTION double Evaluate(const double* polyCache, CoeffVecType const& coeffs) const
     {
@@ -397,6 +463,120 @@ public:
         return df;
     }
 
+    /** Groups the terms of the expansion by their degree in \f$x_d\f$.  Entry \f$a\f$ of the output contains
+        \f$v_a = \sum_{k:\alpha_{k,d}=a} c_k \prod_{j<d}\phi_{\alpha_{k,j}}(x_j)\f$, so that \f$f(x) = v_0 + \sum_{a>0} v_a\phi_a(x_d)\f$.
+        Only available for expansions without a rectifier.
+        @param polyCache[in] Cache vector that has been set up by calling FillCache1 with `DerivativeFlags::None`.
+        @param coeffs[in] Vector of coefficients.  Must have parentheses access operator.
+        @param diagCoeffs[out] Memory for \f$P_d+1\f$ doubles, where \f$P_d\f$ is the maximum degree in \f$x_d\f$.
+    */
+    template<typename CoeffVecType>
+    KOKKOS_FUNCTION void DiagonalCoefficients(const double* polyCache, CoeffVecType const& coeffs, double* diagCoeffs) const
+    {
+        static_assert(std::is_same_v<Rectifier,Identity>, "DiagonalCoefficients is not available for rectified expansions.");
+
+        const unsigned int numTerms = multiSet_.Size();
+        for(unsigned int a=0; a<=maxDegrees_(dim_-1); ++a)
+            diagCoeffs[a] = 0.0;
+
+        unsigned int diagOrder;
+        for(unsigned int termInd=0; termInd<numTerms; ++termInd){
+            double termVal = GetTermValOffDiagonal(termInd, polyCache, diagOrder);
+            diagCoeffs[diagOrder] += termVal*coeffs(termInd);
+        }
+    }
+
+    /** Computes the gradient of a function of the grouped coefficients \f$v_a\f$ (see DiagonalCoefficients) with respect to the
+        coefficients of the expansion.  Entry \f$k\f$ of the gradient is \f$w_{\alpha_{k,d}}\prod_{j<d}\phi_{\alpha_{k,j}}(x_j)\f$.
+        @param polyCache[in] Cache vector that has been set up by calling FillCache1 with `DerivativeFlags::None`.
+        @param diagWeights[in] The derivatives \f$w_a\f$ of the function with respect to each \f$v_a\f$.
+        @param grad[out] Preallocated vector to hold the gradient.
+    */
+    template<typename GradVecType>
+    KOKKOS_FUNCTION void DiagonalCoefficientsGradient(const double* polyCache, const double* diagWeights, GradVecType& grad) const
+    {
+        static_assert(std::is_same_v<Rectifier,Identity>, "DiagonalCoefficientsGradient is not available for rectified expansions.");
+
+        const unsigned int numTerms = multiSet_.Size();
+
+        unsigned int diagOrder;
+        for(unsigned int termInd=0; termInd<numTerms; ++termInd){
+            double termVal = GetTermValOffDiagonal(termInd, polyCache, diagOrder);
+            grad(termInd) = termVal*diagWeights[diagOrder];
+        }
+    }
+
+    /** Evaluates the 1d basis functions in \f$x_d\f$ up to an arbitrary order, which may exceed the maximum degree in the multiindex set.
+        @param vals[out] Memory for at least maxOrder+1 doubles.
+        @param maxOrder The largest order to evaluate.
+        @param xd The value of \f$x_d\f$.
+    */
+    KOKKOS_FUNCTION void EvaluateDiagonalBasis(double* vals, unsigned int maxOrder, double xd) const
+    {
+        basis1d_.EvaluateAll(dim_-1, vals, maxOrder, xd);
+    }
+
+    /** Evaluates the 1d basis functions in input dimension \f$d\f$ up to an arbitrary order.  Used to fill a SharedBasisTable.
+        @param d The input dimension.
+        @param vals[out] Memory for at least maxOrder+1 doubles.
+        @param maxOrder The largest order to evaluate.
+        @param x The value of \f$x_d\f$.
+    */
+    KOKKOS_FUNCTION void EvaluateBasis(unsigned int d, double* vals, unsigned int maxOrder, double x) const
+    {
+        basis1d_.EvaluateAll(d, vals, maxOrder, x);
+    }
+
+    /** Fills the same entries of the cache as FillCache1 with `DerivativeFlags::None`, but copies the basis values from column `ptInd`
+        of a SharedBasisTable instead of evaluating them.  The table must contain at least the degrees returned by Cache1Degrees.
+    */
+    KOKKOS_FUNCTION void CopyCache1(double*                              polyCache,
+                                    SharedBasisTable<MemorySpace> const& table,
+                                    unsigned int                         ptInd) const
+    {
+        for(unsigned int d=0; d<dim_-1; ++d){
+            const unsigned int row = table.rowStarts(d);
+            for(unsigned int i=0; i<=maxDegrees_(d); ++i)
+                polyCache[startPos_(d)+i] = table.vals(row+i, ptInd);
+        }
+    }
+
+    /** Returns the maximum degree of the 1d basis in each of the first \f$d-1\f$ inputs, i.e., the degrees evaluated by FillCache1.
+        Only callable from the host.
+    */
+    std::vector<unsigned int> Cache1Degrees() const
+    {
+        auto maxDegrees = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), maxDegrees_);
+
+        std::vector<unsigned int> degrees(dim_-1);
+        for(unsigned int d=0; d<dim_-1; ++d)
+            degrees.at(d) = maxDegrees(d);
+        return degrees;
+    }
+
+    /** Returns true if `other` uses the same 1d basis functions, so that basis evaluations can be shared between the two expansions.
+        Only available when HasSharedBasis is true for this type.
+    */
+    bool SharesBasisWith(MultivariateExpansionWorker const& other) const
+    {
+        return basis1d_.basis1d_ == other.basis1d_.basis1d_;
+    }
+
+    /** Computes the integrals \f$\int_0^x \phi_a^\prime(t)\phi_b^\prime(t) dt\f$ of the 1d basis in \f$x_d\f$ for all \f$a,b\leq P_d\f$, expanded
+        in the basis itself.  See OrthogonalPolynomial::DerivativeProductIntegrals for the layout.  Only available when HasDiagonalProductIntegrals
+        is true for this type.  Only callable from the host.
+    */
+    Kokkos::View<double***, Kokkos::LayoutRight, MemorySpace> DiagonalProductIntegrals() const
+    {
+        FixedMultiIndexSet<MemorySpace> msetCopy = multiSet_;
+        auto maxDegrees = msetCopy.template ToDevice<Kokkos::HostSpace>().MaxDegrees();
+
+        auto hostIntegrals = basis1d_.basis1d_.DerivativeProductIntegrals(maxDegrees(dim_-1));
+        Kokkos::View<double***, Kokkos::LayoutRight, MemorySpace> integrals("Diagonal Product Integrals", hostIntegrals.extent(0), hostIntegrals.extent(1), hostIntegrals.extent(2));
+        Kokkos::deep_copy(integrals, hostIntegrals);
+        return integrals;
+    }
+
     /** Allows access to the Fixed MultiIndex Set
      * @return The Fixed MultiIndex Set
      */
@@ -416,6 +596,9 @@ public:
         ar(dim_, multiSet_, basis1d_);
         ar(startPos_, cacheSize_);
         maxDegrees_ = multiSet_.MaxDegrees();
+        auto startPosHost = ToHost(startPos_);
+        cache1Size_ = startPosHost(dim_-1);
+        diagTableSize_ = 3*(startPosHost(dim_) - startPosHost(dim_-1));
     }
 #endif // MPART_HAS_CEREAL
 
@@ -440,6 +623,20 @@ private:
         return termVal;
     }
 
+    /** Returns the product of the 1d basis functions in \f$x_1,\ldots,x_{d-1}\f$ for a term and sets diagOrder to the degree of the term in \f$x_d\f$. */
+    KOKKOS_FUNCTION double GetTermValOffDiagonal(unsigned int termInd, const double* polyCache, unsigned int& diagOrder) const {
+        double termVal = 1.0;
+        diagOrder = 0;
+        for(unsigned int i=multiSet_.nzStarts(termInd); i<multiSet_.nzStarts(termInd+1); ++i){
+            if(multiSet_.nzDims(i)==dim_-1){
+                diagOrder = multiSet_.nzOrders(i);
+            }else{
+                termVal *= polyCache[startPos_(multiSet_.nzDims(i)) + multiSet_.nzOrders(i)];
+            }
+        }
+        return termVal;
+    }
+
     KOKKOS_FUNCTION double GetTermValDiagonalDerivative(unsigned int termInd,
                                       const double* polyCache,
                                       const unsigned int posIndex) const {
@@ -559,10 +756,31 @@ private:
     Kokkos::View<const unsigned int*,MemorySpace> maxDegrees_;
 
     unsigned int cacheSize_;
+    unsigned int cache1Size_;
+    unsigned int diagTableSize_;
 
 }; // class MultivariateExpansion
 
 
+/** Whether an expansion type provides DiagonalProductIntegrals, which requires a homogeneous, unrectified basis whose
+    1d family can integrate products of its derivatives (e.g., OrthogonalPolynomial).
+*/
+template<typename ExpansionType>
+struct HasDiagonalProductIntegrals : std::false_type {};
+
+template<typename Basis1dType, typename MemorySpace>
+struct HasDiagonalProductIntegrals<MultivariateExpansionWorker<BasisEvaluator<BasisHomogeneity::Homogeneous, Basis1dType>, MemorySpace>> : HasDerivativeProductIntegrals<Basis1dType> {};
+
+/** Whether an expansion type can share its 1d basis evaluations with other expansions through a SharedBasisTable, which requires
+    a homogeneous, unrectified basis whose 1d family can be compared for equality.
+*/
+template<typename ExpansionType>
+struct HasSharedBasis : std::false_type {};
+
+template<typename Basis1dType, typename MemorySpace>
+struct HasSharedBasis<MultivariateExpansionWorker<BasisEvaluator<BasisHomogeneity::Homogeneous, Basis1dType>, MemorySpace>> : IsBasisComparable<Basis1dType> {};
+
+
 
 } // namespace mpart
 
@@ -2,7 +2,9 @@
 #define ORTHOGONALPOLYNOMIAL_H
 
 #include <Kokkos_Core.hpp>
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "MParT/Utilities/MathFunctions.h"
 
@@ -277,6 +279,117 @@ public:
         }
     }
 
+    /** @brief Computes the integrals of products of basis derivatives in closed form.
+        @details Returns an array \f$A\f$ of size \f$(P+1)\times(P+1)\times 2P\f$, where \f$P\f$ is `maxOrder`, such that
+        \f[
+            \int_0^x p_a^\prime(t)\, p_b^\prime(t)\, dt = \sum_{c=0}^{2P-1} A_{abc}\, p_c(x)
+        \f]
+        for all \f$a,b\leq P\f$, where \f$p_c\f$ are the (possibly normalized) polynomials returned by EvaluateAll.  The
+        product and antiderivative are computed exactly in the coefficient space of the polynomial family using the three
+        term recurrence, so evaluating the integral only requires the polynomials up to order \f$2P-1\f$.  When
+        `maxOrder` is zero, the single entry of the array is zero.  Only callable from the host.
+        @param maxOrder The largest order \f$P\f$ of the polynomials in the products.
+    */
+    Kokkos::View<double***, Kokkos::LayoutRight, Kokkos::HostSpace> DerivativeProductIntegrals(unsigned int maxOrder) const
+    {
+        const unsigned int numCoeffs = std::max(2*maxOrder, 1u);
+        Kokkos::View<double***, Kokkos::LayoutRight, Kokkos::HostSpace> output("Derivative Product Integrals", maxOrder+1, maxOrder+1, numCoeffs);
+        if(maxOrder==0)
+            return output;
+
+        // Polynomials are represented by their coefficients in the unnormalized basis p_0,...,p_{2P-1}
+        const double p0 = this->phi0(0.0);
+        const double alpha = this->phi1_deriv(0.0);
+        const double beta = this->phi1(0.0);
+
+        // Multiplies a polynomial of degree less than 2P-1 by x using the three term recurrence
+        auto timesX = [&](std::vector<double> const& u){
+            std::vector<double> res(numCoeffs, 0.0);
+            res[0] -= u[0]*beta/alpha;
+            res[1] += u[0]*p0/alpha;
+            for(unsigned int k=1; k+1<numCoeffs; ++k){
+                const double ak = this->ak(k+1);
+                res[k+1] += u[k]/ak;
+                res[k] -= u[k]*this->bk(k+1)/ak;
+                res[k-1] += u[k]*this->ck(k+1)/ak;
+            }
+            return res;
+        };
+
+        // Coefficients of the derivative of each polynomial, obtained by differentiating the recurrence
+        std::vector<std::vector<double>> derivs(numCoeffs, std::vector<double>(numCoeffs, 0.0));
+        derivs[1][0] = alpha/p0;
+        for(unsigned int k=2; k<numCoeffs; ++k){
+            std::vector<double> xDeriv = timesX(derivs[k-1]);
+            for(unsigned int j=0; j<numCoeffs; ++j)
+                derivs[k][j] = this->ak(k)*xDeriv[j] + this->bk(k)*derivs[k-1][j] - this->ck(k)*derivs[k-2][j];
+            derivs[k][k-1] += this->ak(k);
+        }
+
+        // Values of the polynomials at zero, which are used to fix the constant of integration
+        std::vector<double> zeroVals(numCoeffs);
+        zeroVals[0] = p0;
+        zeroVals[1] = beta;
+        for(unsigned int k=2; k<numCoeffs; ++k)
+            zeroVals[k] = this->bk(k)*zeroVals[k-1] - this->ck(k)*zeroVals[k-2];
+
+        std::vector<std::vector<double>> scaled(maxOrder, std::vector<double>(numCoeffs, 0.0));
+        std::vector<double> prod(numCoeffs), anti(numCoeffs);
+
+        for(unsigned int a=1; a<=maxOrder; ++a){
+
+            // Products of p_a^\prime with p_0,...,p_{P-1}
+            for(unsigned int j=0; j<numCoeffs; ++j)
+                scaled[0][j] = p0*derivs[a][j];
+            if(maxOrder>1){
+                std::vector<double> xDeriv = timesX(derivs[a]);
+                for(unsigned int j=0; j<numCoeffs; ++j)
+                    scaled[1][j] = alpha*xDeriv[j] + beta*derivs[a][j];
+            }
+            for(unsigned int m=2; m<maxOrder; ++m){
+                std::vector<double> xProd = timesX(scaled[m-1]);
+                for(unsigned int j=0; j<numCoeffs; ++j)
+                    scaled[m][j] = this->ak(m)*xProd[j] + this->bk(m)*scaled[m-1][j] - this->ck(m)*scaled[m-2][j];
+            }
+
+            for(unsigned int b=1; b<=maxOrder; ++b){
+
+                // Expand p_a^\prime p_b^\prime
+                std::fill(prod.begin(), prod.end(), 0.0);
+                for(unsigned int m=0; m<b; ++m){
+                    for(unsigned int j=0; j<numCoeffs; ++j)
+                        prod[j] += derivs[b][m]*scaled[m][j];
+                }
+
+                // Integrate by back substitution, since the derivative of p_k has degree k-1
+                std::fill(anti.begin(), anti.end(), 0.0);
+                for(unsigned int k=numCoeffs-1; k>=1; --k){
+                    anti[k] = prod[k-1]/derivs[k][k-1];
+                    for(unsigned int j=0; j<k; ++j)
+                        prod[j] -= anti[k]*derivs[k][j];
+                }
+
+                double zeroVal = 0.0;
+                for(unsigned int k=1; k<numCoeffs; ++k)
+                    zeroVal += anti[k]*zeroVals[k];
+                anti[0] = -zeroVal/p0;
+
+                for(unsigned int c=0; c<numCoeffs; ++c){
+                    if(normalize_){
+                        output(a,b,c) = anti[c]*this->Normalization(c)/(this->Normalization(a)*this->Normalization(b));
+                    }else{
+                        output(a,b,c) = anti[c];
+                    }
+                }
+            }
+        }
+
+        return output;
+    }
+
+    /** Returns true if both objects evaluate the same polynomials. */
+    bool operator==(OrthogonalPolynomial const& other) const {return normalize_==other.normalize_;}
+
     #if defined(MPART_HAS_CEREAL)
         // Define a serialize or save/load pair as you normally would
         template <class Archive>
@@ -16,6 +16,10 @@
 
 #include <Eigen/Core>
 
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
 namespace mpart {
 
 
@@ -183,6 +187,49 @@ namespace mpart {
                                    StridedMatrix<const double, MemorySpace> const& sens,
                                    StridedMatrix<double, MemorySpace>              output) = 0;
 
+        /** @brief Sets the maximum number of points processed at once by the public entry points (e.g., Evaluate, Gradient, and CoeffGrad).
+            @details Larger inputs are split into tiles of consecutive columns.  The `*Impl` functions are called once per tile and
+            write directly into the matching columns of the output, so intermediate arrays allocated by the `*Impl` functions
+            (e.g., the layer inputs of a ComposedMap) only span one tile.  This bounds the memory used for arbitrarily large
+            inputs and keeps the data of each tile in cache.
+            @param numPts The maximum number of points per tile.  The default value of 0 processes all points at once.
+            @see SetChunkBytes
+        */
+        void SetChunkSize(unsigned int numPts){chunkSize_ = numPts;};
+
+        /** @brief Returns the maximum number of points processed at once, or 0 if inputs are not split into tiles. */
+        unsigned int ChunkSize() const{return chunkSize_;};
+
+        /** @brief Sets the chunk size so that the inputs and outputs of one tile fit in `numBytes` bytes.
+            @details Each point uses \f$(d_{in}+d_{out})\f$ doubles.  A typical choice of `numBytes` is a fraction of the L2 or L3 cache size.
+            @see SetChunkSize
+        */
+        void SetChunkBytes(std::size_t numBytes){
+            SetChunkSize(std::max<std::size_t>(1, numBytes / ((inputDim+outputDim)*sizeof(double))));
+        };
+
+        /** @brief Evaluates the function at multiple points and stores the result in a preallocated matrix.
+            @details Equivalent to EvaluateImpl, but the points are processed in tiles of at most ChunkSize() columns.
+            @param pts A \f$d_{in}\times N\f$ matrix of points.
+            @param output A preallocated \f$d_{out}\times N\f$ matrix.
+        */
+        void EvaluateChunked(StridedMatrix<const double, MemorySpace> const& pts,
+                             StridedMatrix<double, MemorySpace>              output);
+
+        /** @brief Computes the gradient at multiple points and stores the result in a preallocated matrix.
+            @details Equivalent to GradientImpl, but the points are processed in tiles of at most ChunkSize() columns.
+        */
+        void GradientChunked(StridedMatrix<const double, MemorySpace> const& pts,
+                             StridedMatrix<const double, MemorySpace> const& sens,
+                             StridedMatrix<double, MemorySpace>              output);
+
+        /** @brief Computes the coefficient gradient at multiple points and stores the result in a preallocated matrix.
+            @details Equivalent to CoeffGradImpl, but the points are processed in tiles of at most ChunkSize() columns.
+        */
+        void CoeffGradChunked(StridedMatrix<const double, MemorySpace> const& pts,
+                              StridedMatrix<const double, MemorySpace> const& sens,
+                              StridedMatrix<double, MemorySpace>              output);
+
         /** Checks to see if the coefficients have been initialized yet, returns true if so, false if not */
         bool CheckCoefficients() const;
 
@@ -244,7 +291,24 @@ namespace mpart {
         /** Checks to see if the coefficients have been initialized yet. If not, an exception is thrown. */
         void CheckCoefficients(std::string const& functionName) const;
 
+        /** @brief Calls `f(cols)` for consecutive column ranges `cols` of at most ChunkSize() columns that cover \f$[0,N)\f$.
+            @details When chunking is disabled or \f$N\f$ is not larger than the chunk size, `f` is called once with the full range.
+        */
+        template<typename FunctorType>
+        void ForEachChunk(unsigned int numPts, FunctorType const& f) const
+        {
+            if((chunkSize_==0) || (numPts<=chunkSize_)){
+                f(std::make_pair(0u, numPts));
+                return;
+            }
+            for(unsigned int start=0; start<numPts; start+=chunkSize_)
+                f(std::make_pair(start, std::min(start+chunkSize_, numPts)));
+        }
+
         Kokkos::View<double*, MemorySpace> savedCoeffs;
+
+        /// Maximum number of points processed at once by the public entry points, or 0 to process all points at once
+        unsigned int chunkSize_ = 0;
         
     }; // class ParameterizedFunctionBase
 }
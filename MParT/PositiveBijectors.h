@@ -56,6 +56,33 @@ public:
 
 };
 
+/**
+ * @brief Defines the square function \f$g(x) = x^2\f$.
+ * @details Unlike SoftPlus and Exp, this function is only non-negative, so a nugget is needed to guarantee strict
+ * monotonicity.  When \f$\partial_D f\f$ is a polynomial in \f$x_D\f$, the integral of \f$g(\partial_D f)\f$ is also a
+ * polynomial and can be computed without quadrature.  See MonotoneComponent.
+ */
+class Square{
+public:
+
+    KOKKOS_INLINE_FUNCTION static double Evaluate(double x){
+        return x*x;
+    }
+
+    KOKKOS_INLINE_FUNCTION static double Derivative(double x){
+        return 2.0*x;
+    }
+
+    KOKKOS_INLINE_FUNCTION static double SecondDerivative(double){
+        return 2.0;
+    }
+
+    KOKKOS_INLINE_FUNCTION static double Inverse(double x){
+        return std::sqrt(x);
+    }
+
+};
+
 } // namespace mpart
 
 #endif
\ No newline at end of file
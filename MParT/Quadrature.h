@@ -308,6 +308,43 @@ public:
         }
     }
 
+    /**
+     @brief Same as Integrate, but also passes the index of the quadrature node to the integrand.
+     @details The integrand is called as `f(x, i, fval)` at the \f$i^{th}\f$ node, which allows integrands to reuse quantities that were
+              precomputed at the nodes of this fixed rule.  The nodes are at \f$x_i = \frac{1}{2}(x_U+x_L + (x_U-x_L)p_i)\f$, where \f$p_i\f$ is given by `Point(i)`.
+              If the interval is small enough for the midpoint rule to be used, `f(x, fval)` is called instead.
+     @tparam FunctionType The type of the integrand.  Must have both `operator()(double x, double* fval)` and `operator()(double x, unsigned int i, double* fval)` functions.
+     */
+    template<class FunctionType>
+    KOKKOS_FUNCTION void IntegrateIndexed(double*             workspace,
+                                          FunctionType const& f,
+                                          double              lb,
+                                          double              ub,
+                                          double*             res) const
+    {
+        double midpoint_tol = 15.0*std::numeric_limits<double>::epsilon();
+        if((ub-lb)<midpoint_tol){
+            Integrate(workspace, f, lb, ub, res);
+            return;
+        }
+
+        for(unsigned int j=0; j<this->fdim_; ++j)
+            res[j] = 0.0;
+
+        double* fval = workspace;
+        for (unsigned int i=0; i<pts_.size(); ++i){
+            f(0.5*(ub+lb + (ub-lb)*pts_(i)), i, fval);
+            for(unsigned int j=0; j<this->fdim_; ++j)
+                res[j] += 0.5*(ub-lb)*wts_(i) * fval[j];
+        }
+    }
+
+    /** Returns the number of nodes in the rule. */
+    KOKKOS_INLINE_FUNCTION unsigned int NumPts() const{return numPts_;};
+
+    /** Returns the location of the \f$i^{th}\f$ node on the reference interval \f$[-1,1]\f$. */
+    KOKKOS_INLINE_FUNCTION double Point(unsigned int i) const{return pts_(i);};
+
 #if defined(MPART_HAS_CEREAL)
     // Define a serialize or save/load pair as you normally would
     template <class Archive>
@@ -336,13 +373,14 @@ private:
 }; // class ClenshawCurtisQuadrature
 
 
-template<typename MemorySpace>
+/** Functor used to compute the points and weights of a fixed quadrature rule in the memory space of the rule. */
+template<typename MemorySpace, typename RuleType=ClenshawCurtisQuadrature<MemorySpace>>
 struct GetRuleFunctor{
 
     GetRuleFunctor(unsigned int numPts, double* pts, double* wts) : numPts_(numPts), pts_(pts), wts_(wts){};
 
     KOKKOS_INLINE_FUNCTION void operator()(const size_t i) const{
-        ClenshawCurtisQuadrature<MemorySpace>::GetRule(numPts_,wts_, pts_);
+        RuleType::GetRule(numPts_,wts_, pts_);
     };
 
     unsigned int numPts_;
@@ -378,6 +416,233 @@ inline ClenshawCurtisQuadrature<Kokkos::HostSpace>::ClenshawCurtisQuadrature(uns
 };
 
 
+/**
+ @brief Fixed Gauss-Legendre quadrature rule.
+ @details An \f$n\f$ point Gauss-Legendre rule integrates polynomials of degree \f$2n-1\f$ exactly, compared to degree \f$n-1\f$
+          (or \f$n\f$ for odd \f$n\f$) for a Clenshaw-Curtis rule with the same number of points.  For smooth integrands, this
+          rule therefore typically reaches the same accuracy as ClenshawCurtisQuadrature with roughly half the integrand evaluations.
+          The nodes are interior to the integration interval.  This class has the same interface as ClenshawCurtisQuadrature.
+ */
+template<typename MemorySpace=Kokkos::HostSpace>
+class GaussLegendreQuadrature : public QuadratureBase<MemorySpace>{
+public:
+#if defined(MPART_HAS_CEREAL)
+    friend class cereal::access;
+#endif 
+
+    /**
+     * @brief Construct a new Gauss-Legendre Quadrature object using an internally allocated workspace.
+     *
+     * @param numPts The number of points in the rule.
+     * @param maxDim The maximum dimension of the integrand.  Used to help set up workspace.
+     */
+    inline GaussLegendreQuadrature(unsigned int numPts, unsigned int maxDim);
+
+    /**
+        @brief Construct a new Gauss-Legendre Quadrature object with externally allocated workspace memory.
+
+        @param numPts The number of points in the rule.
+        @param maxDim The maximum dimension of the integrand.  Used to help set up workspace.
+        @param workspace A pointer to memory that is allocated as a workspace.  Must have space for at least maxDim components.  Set to null ptr if workspace memory will be allocated later using the SetWorkspace function.
+    */
+    inline GaussLegendreQuadrature(unsigned int numPts, unsigned int maxDim, double* workspace);
+
+    /** @brief Construct a new Gauss-Legendre Quadrature object without allocating memory, storing the rule in the given views.
+        @details See the analogous ClenshawCurtisQuadrature constructor.
+    */
+    KOKKOS_FUNCTION GaussLegendreQuadrature(Kokkos::View<double*, MemorySpace> pts, Kokkos::View<double*, MemorySpace> wts, unsigned int maxDim, double* workspace) : QuadratureBase<MemorySpace>(maxDim,maxDim,workspace),  pts_(pts), wts_(wts), numPts_(pts.extent(0))
+    {
+        GetRule(numPts_, wts_.data(), pts_.data());
+    };
+
+    /** @brief Returns the size of a double array needed as a workspace to integrate a function with dimension fdim. */
+    KOKKOS_FUNCTION static unsigned int GetWorkspaceSize(unsigned int fdim){return fdim;};
+
+    KOKKOS_INLINE_FUNCTION void SetDim(unsigned int fdim){
+
+        // If the workspace is managed internally, we need to make sure we won't required too much memory
+        if(this->internalWork_.extent(0)>0)
+            assert(fdim<=this->maxDim_);
+
+        this->fdim_ = fdim;
+        this->workspaceSize_=GetWorkspaceSize(fdim);
+        assert((this->internalWork_.extent(0)==0)||(this->internalWork_.extent(0)>=this->workspaceSize_));
+    }
+
+    static std::pair<Eigen::VectorXd, Eigen::VectorXd> GetRule(unsigned int order)
+    {
+        Eigen::VectorXd wts(order), pts(order);
+        GaussLegendreQuadrature::GetRule(order, wts.data(), pts.data());
+        return std::make_pair(wts,pts);
+    }
+
+    /**
+     @brief Computes the weights and points in a Gauss-Legendre rule on \f$[-1,1]\f$.
+     @details The points are the roots of the Legendre polynomial \f$P_n\f$, which are found with Newton's method starting from
+              the asymptotic approximation \f$\cos(\pi(i+3/4)/(n+1/2))\f$.  The points are stored in increasing order.
+     @param[in] numPts The number of points in the quadrature rule.
+     @param[out] wts A pointer to the memory where the weights will be stored.  Must be at least numPts long.
+     @param[out] pts A pointer to the memory where the points will be stored.  Must be at least numPts long.
+     */
+    KOKKOS_FUNCTION static void GetRule(unsigned int numPts, double* wts, double* pts)
+    {
+        if(numPts==0){
+            return;
+        }
+
+        // The rule is symmetric, so only the positive roots need to be computed
+        for(unsigned int i=0; i<(numPts+1)/2; ++i){
+
+            double x = std::cos(M_PI * (i+0.75) / (numPts+0.5));
+            double deriv = 1.0;
+
+            for(unsigned int it=0; it<100; ++it){
+
+                // Evaluate P_n(x) and P_{n-1}(x) with the three term recurrence
+                double pPrev = 1.0;
+                double pCurr = x;
+                for(unsigned int k=2; k<=numPts; ++k){
+                    double pNext = ((2.0*k-1.0)*x*pCurr - (k-1.0)*pPrev)/k;
+                    pPrev = pCurr;
+                    pCurr = pNext;
+                }
+
+                deriv = numPts*(x*pCurr - pPrev)/(x*x-1.0);
+                double dx = pCurr / deriv;
+                x -= dx;
+
+                if(std::abs(dx)<=4.0*std::numeric_limits<double>::epsilon())
+                    break;
+            }
+
+            // The middle point of an odd rule is exactly zero
+            if((numPts%2==1) && (i==(numPts-1)/2))
+                x = 0.0;
+
+            pts[i] = -x;
+            pts[numPts-1-i] = x;
+            wts[i] = 2.0/((1.0-x*x)*deriv*deriv);
+            wts[numPts-1-i] = wts[i];
+        }
+    }
+
+    /**
+     @brief Approximates the integral \f$\int_{x_L}^{x_U} f(x) dx\f$ using a Gauss-Legendre quadrature rule.
+     @param[in] f The integrand.
+     @param[in] lb The lower bound \f$x_L\f$ in the integration.
+     @param[in] lb The upper bound \f$x_U\f$ in the integration.
+     @param[out] res A pointer to the array where the approximation of \f$\int_{x_L}^{x_U} f(x) dx\f$ should be stored.
+     @tparam FunctionType The type of the integrand.  Must have an operator()(double x, double* fval) function.
+     */
+    template<class FunctionType>
+    KOKKOS_FUNCTION void Integrate(FunctionType const& f,
+                                   double              lb,
+                                   double              ub,
+                                   double*             res) const
+    {
+        assert(this->workspace_);
+        Integrate(this->workspace_, f, lb, ub, res);
+    }
+
+    template<class FunctionType>
+    KOKKOS_FUNCTION void Integrate(double*             workspace,
+                                   FunctionType const& f,
+                                   double              lb,
+                                   double              ub,
+                                   double*             res) const
+    {
+        for(unsigned int j=0; j<this->fdim_; ++j)
+            res[j] = 0.0;
+
+        double* fval = workspace;
+        for (unsigned int i=0; i<pts_.size(); ++i){
+            f(0.5*(ub+lb + (ub-lb)*pts_(i)), fval);
+            for(unsigned int j=0; j<this->fdim_; ++j)
+                res[j] += 0.5*(ub-lb)*wts_(i) * fval[j];
+        }
+    }
+
+    /**
+     @brief Same as Integrate, but also passes the index of the quadrature node to the integrand.
+     @details See ClenshawCurtisQuadrature::IntegrateIndexed.  Because the Gauss-Legendre nodes are interior to the interval,
+              the indexed integrand is called at every node regardless of the interval width.
+     */
+    template<class FunctionType>
+    KOKKOS_FUNCTION void IntegrateIndexed(double*             workspace,
+                                          FunctionType const& f,
+                                          double              lb,
+                                          double              ub,
+                                          double*             res) const
+    {
+        for(unsigned int j=0; j<this->fdim_; ++j)
+            res[j] = 0.0;
+
+        double* fval = workspace;
+        for (unsigned int i=0; i<pts_.size(); ++i){
+            f(0.5*(ub+lb + (ub-lb)*pts_(i)), i, fval);
+            for(unsigned int j=0; j<this->fdim_; ++j)
+                res[j] += 0.5*(ub-lb)*wts_(i) * fval[j];
+        }
+    }
+
+    /** Returns the number of nodes in the rule. */
+    KOKKOS_INLINE_FUNCTION unsigned int NumPts() const{return numPts_;};
+
+    /** Returns the location of the \f$i^{th}\f$ node on the reference interval \f$[-1,1]\f$. */
+    KOKKOS_INLINE_FUNCTION double Point(unsigned int i) const{return pts_(i);};
+
+#if defined(MPART_HAS_CEREAL)
+    template <class Archive>
+    void save( Archive & ar ) const
+    {   
+        ar(cereal::base_class<QuadratureBase<MemorySpace>>(this));
+        ar(pts_,wts_, numPts_);
+    }
+    template <class Archive>
+    void load( Archive & ar )
+    {   
+        ar(cereal::base_class<QuadratureBase<MemorySpace>>(this));
+        ar(pts_,wts_, numPts_);
+    }
+
+    /** Default constructor should never be used directly.  Only for serialization. */
+    GaussLegendreQuadrature(){};
+
+#endif 
+
+private:
+    
+    Kokkos::View<double*, MemorySpace> pts_, wts_;
+    unsigned int numPts_;
+
+}; // class GaussLegendreQuadrature
+
+
+template<typename MemorySpace>
+inline GaussLegendreQuadrature<MemorySpace>::GaussLegendreQuadrature(unsigned int numPts, unsigned int maxDim) : QuadratureBase<MemorySpace>(maxDim,maxDim),  pts_("Points", numPts), wts_("Weights", numPts), numPts_(numPts)
+{
+    Kokkos::parallel_for(1, GetRuleFunctor<MemorySpace, GaussLegendreQuadrature<MemorySpace>>(numPts, pts_.data(), wts_.data()));
+};
+
+template<>
+inline GaussLegendreQuadrature<Kokkos::HostSpace>::GaussLegendreQuadrature(unsigned int numPts, unsigned int maxDim) : QuadratureBase<Kokkos::HostSpace>(maxDim,maxDim),  pts_("Points", numPts), wts_("Weights", numPts), numPts_(numPts)
+{
+    GetRule(numPts, wts_.data(), pts_.data());
+};
+
+template<typename MemorySpace>
+inline GaussLegendreQuadrature<MemorySpace>::GaussLegendreQuadrature(unsigned int numPts, unsigned int maxDim, double* workspace) : QuadratureBase<MemorySpace>(maxDim,maxDim,workspace),  pts_("Points", numPts), wts_("Weights", numPts), numPts_(numPts)
+{
+    Kokkos::parallel_for(1, GetRuleFunctor<MemorySpace, GaussLegendreQuadrature<MemorySpace>>(numPts, pts_.data(), wts_.data()));
+};
+
+template<>
+inline GaussLegendreQuadrature<Kokkos::HostSpace>::GaussLegendreQuadrature(unsigned int numPts, unsigned int maxDim, double* workspace) : QuadratureBase<Kokkos::HostSpace>(maxDim,maxDim,workspace),  pts_("Points", numPts), wts_("Weights", numPts), numPts_(numPts)
+{
+    GetRule(numPts, wts_.data(), pts_.data());
+};
+
+
 template<typename MemorySpace>
 class RecursiveQuadratureBase : public QuadratureBase<MemorySpace>
 {
@@ -1085,6 +1350,203 @@ inline AdaptiveClenshawCurtis<Kokkos::HostSpace>::AdaptiveClenshawCurtis(unsigne
 };
 
 
+/**
+ @brief Adaptive quadrature based on the 15 point Gauss-Kronrod rule.
+ @details The 15 point Kronrod rule contains the 7 points of a Gauss-Legendre rule, so the integral can be estimated on each
+          interval at two different orders without any additional integrand evaluations.  The Kronrod estimate is used as the
+          integral on the interval and its difference from the Gauss estimate as the error.  Intervals where the error is too large
+          are split into two equal halves, which are then processed recursively, until the error is acceptable or the maximum
+          number of subdivisions is reached.  Unlike AdaptiveClenshawCurtis and AdaptiveSimpson, no evaluations are shared between
+          levels, but the high order of the rule typically means that far fewer levels are needed for smooth integrands.
+ */
+template<typename MemorySpace=Kokkos::HostSpace>
+class AdaptiveGaussKronrod : public RecursiveQuadratureBase<MemorySpace> {
+public:
+#if defined(MPART_HAS_CEREAL)
+    friend class cereal::access;
+#endif 
+
+    /**
+       @brief Construct a new adaptive quadrature class with specified stopping criteria.
+       @param maxSub The maximum number of subdivisions allowed.
+       @param maxDim The maximum dimension of the integrand.
+       @param[in] absTol An absolute error tolerance used to stop the adaptive integration.
+       @param[in] relTol A relative error tolerance used to stop te adaptive integration.
+       @param[in] errorMetric A flag specifying the type of error metric to use.
+       @param[in] minSub The minimum number of subdivisions.
+     */
+    AdaptiveGaussKronrod(unsigned int maxSub,
+                         unsigned int maxDim,
+                         double absTol,
+                         double relTol,
+                         QuadError::Type errorMetric,
+                         unsigned int minSub=0) : RecursiveQuadratureBase<MemorySpace>(maxSub, maxDim, GetWorkspaceSize(maxSub,maxDim), absTol, relTol, errorMetric, minSub){};
+
+    KOKKOS_FUNCTION AdaptiveGaussKronrod(unsigned int maxSub,
+                                         unsigned int maxDim,
+                                         double* workspace,
+                                         double absTol,
+                                         double relTol,
+                                         QuadError::Type errorMetric,
+                                         unsigned int minSub=0) : RecursiveQuadratureBase<MemorySpace>(maxSub, maxDim, GetWorkspaceSize(maxSub,maxDim), workspace, absTol, relTol, errorMetric, minSub){};
+
+    /** The workspace holds one integrand evaluation, the Gauss and Kronrod estimates, and a stack of at most maxSub+1 pending intervals. */
+    KOKKOS_FUNCTION static unsigned int GetWorkspaceSize(unsigned int maxSub, unsigned int fdim){return 3*fdim + 3*(maxSub+1);};
+
+    KOKKOS_INLINE_FUNCTION void SetDim(unsigned int fdim){
+
+        // If the workspace is managed internally, we need to make sure we won't required too much memory
+        if(this->internalWork_.extent(0)>0)
+            assert(fdim<=this->maxDim_);
+
+        this->fdim_ = fdim;
+        this->workspaceSize_=GetWorkspaceSize(this->maxSub_, fdim);
+        assert((this->internalWork_.extent(0)==0)||(this->internalWork_.extent(0)>=this->workspaceSize_));
+    }
+
+    /**
+     @brief Approximates the integral \f$\int_{x_L}^{x_U} f(x) dx\f$
+     @param[in] f The integrand.
+     @param[in] lb The lower bound \f$x_L\f$ in the integration.
+     @param[in] lb The upper bound \f$x_U\f$ in the integration.
+     @param[out] res A pointer to the array where the approximation of \f$\int_{x_L}^{x_U} f(x) dx\f$ should be stored.
+     @tparam FunctionType The type of the integrand.  Must have an operator()(double x, double* fval) function.
+     */
+    template<class FunctionType>
+    KOKKOS_FUNCTION void Integrate(FunctionType const& f,
+                                   double              lb,
+                                   double              ub,
+                                   double*             res) const
+    {
+        assert(this->workspace_);
+        Integrate(this->workspace_, f, lb, ub, res);
+    }
+
+    template<class FunctionType>
+    KOKKOS_FUNCTION void Integrate(double*             workspace,
+                                   FunctionType const& f,
+                                   double              lb,
+                                   double              ub,
+                                   double*             res) const
+    {
+        for(unsigned int i=0; i<this->fdim_; ++i){
+            res[i] = 0;
+        }
+
+        double* fval = &workspace[0];
+        double* intCoarse = &workspace[this->fdim_];
+        double* intFine = &workspace[2*this->fdim_];
+
+        // Depth-first traversal of the subdivision tree.  Each entry holds the left point, right point, and level of an interval.
+        // Only the right half of each split interval is pending at any time, so the stack never holds more than maxSub+1 entries.
+        double* stack = &workspace[3*this->fdim_];
+        unsigned int stackSize = 1;
+        stack[0] = lb;
+        stack[1] = ub;
+        stack[2] = 0;
+
+        double error, errorTol;
+
+        while(stackSize>0){
+
+            stackSize--;
+            const double leftPt = stack[3*stackSize];
+            const double rightPt = stack[3*stackSize+1];
+            const unsigned int currLevel = static_cast<unsigned int>(stack[3*stackSize+2]);
+
+            ApplyRule(f, leftPt, rightPt, fval, intCoarse, intFine);
+
+            this->EstimateError(intCoarse, intFine, error, errorTol);
+
+            // Checking for convergence or other termination criteria
+            if((((error<errorTol)||(currLevel+1>=this->maxSub_))&&(currLevel>=this->minSub_))||(std::abs(rightPt-leftPt)<1e-14)){
+
+                for(unsigned int i=0; i<this->fdim_; ++i)
+                    res[i] += intFine[i];
+
+            // If not successful, split the interval and process the left half next
+            }else{
+                const double midPt = 0.5*(leftPt+rightPt);
+
+                stack[3*stackSize] = midPt;
+                stack[3*stackSize+1] = rightPt;
+                stack[3*stackSize+2] = currLevel+1;
+
+                stack[3*stackSize+3] = leftPt;
+                stack[3*stackSize+4] = midPt;
+                stack[3*stackSize+5] = currLevel+1;
+
+                stackSize += 2;
+            }
+        }
+    }
+
+#if defined(MPART_HAS_CEREAL)
+    template <class Archive>
+    void save( Archive & ar ) const
+    {   
+        ar(cereal::base_class<RecursiveQuadratureBase<MemorySpace>>(this));
+    }
+    template <class Archive>
+    void load( Archive & ar )
+    {   
+        ar(cereal::base_class<RecursiveQuadratureBase<MemorySpace>>(this));
+    }
+
+    AdaptiveGaussKronrod(){};
+#endif 
+
+private:
+
+    /** Computes the 7 point Gauss and 15 point Kronrod approximations of the integral over [leftPt, rightPt]. */
+    template<class FunctionType>
+    KOKKOS_FUNCTION void ApplyRule(FunctionType const& f,
+                                   double              leftPt,
+                                   double              rightPt,
+                                   double*             fval,
+                                   double*             intGauss,
+                                   double*             intKronrod) const
+    {
+        // Nonnegative Kronrod nodes in decreasing order.  The odd entries (and zero) are the Gauss nodes.
+        const double kronrodPts[8] = {0.991455371120812639206854697526329, 0.949107912342758524526189684047851,
+                                      0.864864423359769072789712788640926, 0.741531185599394439863864773280788,
+                                      0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+                                      0.207784955007898467600689403773245, 0.000000000000000000000000000000000};
+        const double kronrodWts[8] = {0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+                                      0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+                                      0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+                                      0.204432940075298892414161999234649, 0.209482141084727828012999174891714};
+        const double gaussWts[4] = {0.129484966168869693270611432679082, 0.279705391489276667901467771423780,
+                                    0.381830050505118944950369775488975, 0.417959183673469387755102040816327};
+
+        const double midPt = 0.5*(leftPt+rightPt);
+        const double scale = 0.5*(rightPt-leftPt);
+
+        f(midPt, fval);
+        for(unsigned int j=0; j<this->fdim_; ++j){
+            intKronrod[j] = kronrodWts[7]*fval[j];
+            intGauss[j] = gaussWts[3]*fval[j];
+        }
+
+        for(unsigned int i=0; i<7; ++i){
+            for(int side=-1; side<=1; side+=2){
+                f(midPt + side*scale*kronrodPts[i], fval);
+                for(unsigned int j=0; j<this->fdim_; ++j){
+                    intKronrod[j] += kronrodWts[i]*fval[j];
+                    if(i%2==1)
+                        intGauss[j] += gaussWts[i/2]*fval[j];
+                }
+            }
+        }
+
+        for(unsigned int j=0; j<this->fdim_; ++j){
+            intKronrod[j] *= scale;
+            intGauss[j] *= scale;
+        }
+    }
+
+}; // class AdaptiveGaussKronrod
+
 
 } // namespace mpart
 
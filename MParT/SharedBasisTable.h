@@ -0,0 +1,33 @@
+#ifndef MPART_SHAREDBASISTABLE_H
+#define MPART_SHAREDBASISTABLE_H
+
+#include <Kokkos_Core.hpp>
+
+namespace mpart{
+
+/**
+ @brief Evaluations of a 1d basis in each input dimension that are shared by several maps evaluated at the same points.
+ @details TriangularMap uses this table to evaluate the 1d basis in each of its inputs only once per point.  Each component
+ then copies the values it needs instead of re-evaluating the basis in \f$x_1,\ldots,x_{k-1}\f$ itself.  The values of the
+ 1d basis function of degree \f$p\f$ in dimension \f$d\f$ at point \f$i\f$ are stored in `vals(rowStarts(d)+p, i)`, where
+ `rowStarts` has one more entry than the number of tabulated dimensions, so that the largest degree in dimension \f$d\f$ is
+ `rowStarts(d+1)-rowStarts(d)-1`.  A default constructed table is empty and indicates that no values are shared.
+
+ @see ConditionalMapBase::CanShareBasis
+ */
+template<typename MemorySpace>
+struct SharedBasisTable {
+
+    /// Basis evaluations, one column per point
+    Kokkos::View<const double**, Kokkos::LayoutLeft, MemorySpace> vals;
+
+    /// The first row of `vals` holding each input dimension, followed by the total number of rows
+    Kokkos::View<const unsigned int*, MemorySpace> rowStarts;
+
+    /** Returns true if the table does not contain any values. */
+    KOKKOS_INLINE_FUNCTION bool IsEmpty() const {return vals.extent(1)==0;}
+};
+
+} // namespace mpart
+
+#endif // MPART_SHAREDBASISTABLE_H
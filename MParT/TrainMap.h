@@ -16,7 +16,7 @@ namespace mpart {
  *
  */
 struct TrainOptions {
-    /** NLOpt: Optimization Algorithm to use */
+    /** NLOpt: Optimization Algorithm to use.  The values "SGD" and "ADAM" select MParT's mini-batch stochastic optimizers instead of NLopt. */
     std::string opt_alg = "LD_SLSQP";
     /** NLOpt: Lower bound on optimizer */
     double opt_stopval = -std::numeric_limits<double>::infinity();
@@ -32,6 +32,20 @@ struct TrainOptions {
     int opt_maxeval = 1000;
     /** NLOpt: Maximum amount of time to spend optimizing */
     double opt_maxtime = std::numeric_limits<double>::infinity();
+    /** Stochastic: Number of samples in each mini-batch (0 uses the full training set) */
+    unsigned int opt_batch_size = 0;
+    /** Stochastic: Number of passes through the (shuffled) training set */
+    unsigned int opt_epochs = 10;
+    /** Stochastic: Initial step size */
+    double opt_learning_rate = 1e-2;
+    /** Stochastic: Step size decay, the step size in epoch \f$k\f$ is opt_learning_rate/(1+opt_lr_decay*k) */
+    double opt_lr_decay = 0.0;
+    /** Stochastic: Exponential decay rate of the ADAM first moment estimate */
+    double opt_beta1 = 0.9;
+    /** Stochastic: Exponential decay rate of the ADAM second moment estimate */
+    double opt_beta2 = 0.999;
+    /** Stochastic: Seed used to shuffle the training set between epochs */
+    unsigned int opt_seed = 0;
     /** Verbosity of map training (1: verbose, 2: debug) */
     int verbose = 0;
 
@@ -50,6 +64,13 @@ struct TrainOptions {
         ss << "opt_xtol_abs = " << opt_xtol_abs << "\n";
         ss << "opt_maxeval = " << opt_maxeval << "\n";
         ss << "opt_maxtime = " << opt_maxtime << "\n";
+        ss << "opt_batch_size = " << opt_batch_size << "\n";
+        ss << "opt_epochs = " << opt_epochs << "\n";
+        ss << "opt_learning_rate = " << opt_learning_rate << "\n";
+        ss << "opt_lr_decay = " << opt_lr_decay << "\n";
+        ss << "opt_beta1 = " << opt_beta1 << "\n";
+        ss << "opt_beta2 = " << opt_beta2 << "\n";
+        ss << "opt_seed = " << opt_seed << "\n";
         ss << "verbose = " << verbose;
         return ss.str();
     }
@@ -58,6 +79,10 @@ struct TrainOptions {
 
 /**
  * @brief Function to train a map inplace given an objective and optimization options
+ * @details When `options.opt_alg` is "SGD" or "ADAM", the map is trained with first-order stochastic updates computed
+ *          on shuffled mini-batches of the objective's training set (see the `opt_batch_size`, `opt_epochs`, `opt_learning_rate`,
+ *          `opt_lr_decay`, `opt_beta1`, `opt_beta2` and `opt_seed` options).  Any other value is passed to NLopt, which
+ *          optimizes over the full training set.
  *
  * @param map Map to optimize (inplace)
  * @param objective MapObjective to optimize over
@@ -66,6 +91,23 @@ struct TrainOptions {
 template<typename MemorySpace>
 double TrainMap(std::shared_ptr<ConditionalMapBase<MemorySpace>> map, std::shared_ptr<MapObjective<MemorySpace>> objective, TrainOptions options);
 
+/**
+ * @brief Trains the blocks of a TriangularMap as independent problems when the objective separates over map outputs.
+ * @details The forward KL objective separates over the blocks of a triangular map when the reference density factorizes over
+ *          the map outputs, which is the case for a KLObjective whose density is a GaussianSamplerDensity with identity
+ *          covariance.  Each block \f$T_k\f$ is then trained with TrainMap against the marginal Gaussian of its outputs, using
+ *          only the first \f$N_k\f$ rows of the training data.  Blocks are trained one after another, so each optimization only
+ *          involves the coefficients of one block while the kernels of each block still run in parallel over the training points.
+ *          If the map is not a TriangularMap or the objective does not separate, this function falls back to TrainMap.
+ *
+ * @param map Map to optimize (inplace)
+ * @param objective MapObjective to optimize over
+ * @param options Options for optimizing each block
+ * @return double The objective value of the trained map, i.e., the sum of the final objective values of the blocks
+ */
+template<typename MemorySpace>
+double TrainMapComponentwise(std::shared_ptr<ConditionalMapBase<MemorySpace>> map, std::shared_ptr<MapObjective<MemorySpace>> objective, TrainOptions options);
+
 } // namespace mpart
 
 #endif // MPART_TRAINMAP_H
\ No newline at end of file
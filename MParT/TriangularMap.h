@@ -65,6 +65,16 @@ public:
 
     virtual std::shared_ptr<ConditionalMapBase<MemorySpace>> GetComponent(unsigned int i){ return comps_.at(i);}
 
+    /** Returns the number of blocks \f$K\f$ in the block triangular map. */
+    unsigned int NumComponents() const { return comps_.size(); }
+
+    /** @brief Freezes the rows of `pts` seen by each component.
+        @see ConditionalMapBase::FreezeData
+    */
+    void FreezeData(StridedMatrix<const double, MemorySpace> const& pts) override;
+
+    void UnfreezeData() override;
+
     /** @brief Computes the log determinant of the Jacobian matrix of this map.
 
     @details
@@ -107,9 +117,27 @@ public:
                      StridedMatrix<double, MemorySpace>              output) override;
 
 
+    /** @brief Computes the inverse starting from the initial guesses in `x2Guess`.  Each component is inverted with
+               ConditionalMapBase::InverseWithGuessImpl, so the bracket widths of every output dimension are used and updated.
+    */
+    void InverseWithGuessImpl(StridedMatrix<const double, MemorySpace> const& x1,
+                              StridedMatrix<const double, MemorySpace> const& r,
+                              StridedMatrix<const double, MemorySpace> const& x2Guess,
+                              StridedMatrix<double, MemorySpace>              bracketWidths,
+                              StridedMatrix<double, MemorySpace>              output) override;
+
     virtual void InverseInplace(StridedMatrix<double, MemorySpace>              x1,
                                 StridedMatrix<const double, MemorySpace> const& r);
 
+    /** @brief Inverts the map in place, using the current values of the last rows of `x` as the initial guess.
+        @param x The \f$d_{in}\times N\f$ input.  The last \f$d_{out}\f$ rows contain the initial guess on entry and the inverse on exit.
+        @param r The map output to invert.
+        @param bracketWidths Either an empty view or a \f$d_{out}\times N\f$ matrix of initial bracketing steps, which is updated in place.
+    */
+    virtual void InverseInplace(StridedMatrix<double, MemorySpace>              x,
+                                StridedMatrix<const double, MemorySpace> const& r,
+                                StridedMatrix<double, MemorySpace>              bracketWidths);
+
 
     void CoeffGradImpl(StridedMatrix<const double, MemorySpace> const& pts,
                        StridedMatrix<const double, MemorySpace> const& sens,
@@ -122,6 +150,13 @@ public:
     void LogDeterminantInputGradImpl(StridedMatrix<const double, MemorySpace> const& pts,
                                              StridedMatrix<double, MemorySpace>              output) override;
 
+    /** @brief Calls ConditionalMapBase::ForwardPassImpl on each component, sharing basis evaluations between them when possible. */
+    void ForwardPassImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                         StridedMatrix<const double, MemorySpace> const& sens,
+                         StridedMatrix<double, MemorySpace>              evals,
+                         StridedVector<double, MemorySpace>              logDets,
+                         StridedMatrix<double, MemorySpace>              coeffGrad) override;
+
     std::vector<unsigned int> DiagonalCoeffIndices() const;
 #if defined(MPART_HAS_CEREAL)
     template<class Archive>
@@ -149,8 +184,19 @@ public:
 
 private:
 
+    /** @brief Evaluates the 1d basis shared by all components at `pts`.  Returns an empty table if the components cannot
+               share basis evaluations or if the data is frozen, in which case each component fills its own cache.
+    */
+    SharedBasisTable<MemorySpace> EvaluateSharedBasis(StridedMatrix<const double, MemorySpace> const& pts) const;
+
     std::vector<std::shared_ptr<ConditionalMapBase<MemorySpace>>> comps_;
 
+    /// Layout of the SharedBasisTable filled by EvaluateSharedBasis (see SharedBasisTable::rowStarts), or empty if the components do not share a basis
+    Kokkos::View<unsigned int*, MemorySpace> sharedRows_;
+
+    /// Whether FreezeData has been called.  Frozen caches take precedence over shared basis evaluations.
+    bool frozen_ = false;
+
 
 }; // class TriangularMap
 
@@ -0,0 +1,112 @@
+#ifndef MPART_COUNTERRNG_H
+#define MPART_COUNTERRNG_H
+
+#include <Kokkos_Core.hpp>
+#include <cstdint>
+
+#include "MParT/Utilities/MathFunctions.h"
+
+namespace mpart{
+
+/**
+ @brief The Philox4x32-10 counter-based random number generator of Salmon et al., "Parallel random numbers: as easy as 1, 2, 3" (2011).
+ @details Unlike the generators in a Kokkos random pool, a counter-based generator does not have any state.  The random bits are a
+ fixed function of a 128 bit counter and a 64 bit key, so each entry of a sample matrix can be generated independently from its
+ indices without acquiring a generator from a locked pool.  The resulting samples are therefore also independent of the number of
+ threads and of the execution space.
+ */
+struct Philox4x32 {
+
+    /** Computes the 10 round Philox4x32 bijection of the counter `ctr` with the key `key`, overwriting `ctr` with the result. */
+    KOKKOS_INLINE_FUNCTION static void Apply(uint32_t ctr[4], uint32_t const key[2])
+    {
+        uint32_t k0 = key[0];
+        uint32_t k1 = key[1];
+        for(unsigned int round=0; round<10; ++round){
+            if(round>0){
+                k0 += 0x9E3779B9u;
+                k1 += 0xBB67AE85u;
+            }
+            const uint64_t prod0 = uint64_t(0xD2511F53u) * uint64_t(ctr[0]);
+            const uint64_t prod1 = uint64_t(0xCD9E8D57u) * uint64_t(ctr[2]);
+
+            const uint32_t c1 = ctr[1];
+            const uint32_t c3 = ctr[3];
+            ctr[0] = uint32_t(prod1 >> 32) ^ c1 ^ k0;
+            ctr[1] = uint32_t(prod1);
+            ctr[2] = uint32_t(prod0 >> 32) ^ c3 ^ k1;
+            ctr[3] = uint32_t(prod0);
+        }
+    }
+
+    /** Converts two 32 bit words into a double that is uniformly distributed on the open interval \f$(0,1)\f$ using 53 random bits. */
+    KOKKOS_INLINE_FUNCTION static double ToUniform(uint32_t hi, uint32_t lo)
+    {
+        const uint64_t bits = ((uint64_t(hi) << 32) | uint64_t(lo)) >> 11;
+        return (double(bits) + 0.5) * (1.0 / 9007199254740992.0); // 2^{-53}
+    }
+
+    /** @brief Generates a pair of independent standard normal random variables with the Box-Muller transform.
+        @param seed The seed (i.e., the key) of the generator.
+        @param stream The first 64 bits of the counter, typically the index of a sample.
+        @param substream The last 64 bits of the counter, typically the index of a pair of dimensions within a sample.
+        @param z0 The first normal random variable.
+        @param z1 The second normal random variable.
+    */
+    KOKKOS_INLINE_FUNCTION static void NormalPair(uint64_t seed, uint64_t stream, uint64_t substream, double& z0, double& z1)
+    {
+        uint32_t ctr[4] = {uint32_t(stream), uint32_t(stream >> 32), uint32_t(substream), uint32_t(substream >> 32)};
+        const uint32_t key[2] = {uint32_t(seed), uint32_t(seed >> 32)};
+        Apply(ctr, key);
+
+        const double u1 = ToUniform(ctr[0], ctr[1]);
+        const double u2 = ToUniform(ctr[2], ctr[3]);
+
+        const double r = MathSpace::sqrt(-2.0 * MathSpace::log(u1));
+        const double theta = 6.283185307179586476925286766559 * u2;
+        z0 = r * MathSpace::cos(theta);
+        z1 = r * MathSpace::sin(theta);
+    }
+};
+
+
+/** Mixes the bits of a 32 bit integer with the "lowbias32" hash of C. Wellons. */
+KOKKOS_INLINE_FUNCTION uint32_t HashUInt32(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+/** Reverses the order of the bits in a 32 bit integer. */
+KOKKOS_INLINE_FUNCTION uint32_t ReverseBits(uint32_t x)
+{
+    x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+    x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+    x = ((x >> 4) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4);
+    x = ((x >> 8) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8);
+    return (x >> 16) | (x << 16);
+}
+
+/** @brief Applies a hash based nested uniform (Owen) scramble to the binary digits of \f$x 2^{-32}\f$.
+    @details Follows B. Burley, "Practical hash-based Owen scrambling" (2020).  Each bit of the output only depends on the
+             seed and on the bits of the input that are at least as significant, so the scramble maps every dyadic interval
+             onto another dyadic interval of the same size and preserves the stratification of digital nets.
+*/
+KOKKOS_INLINE_FUNCTION uint32_t OwenScramble(uint32_t x, uint32_t seed)
+{
+    x = ReverseBits(x);
+    x += seed;
+    x ^= x * 0x6c50b47cu;
+    x ^= x * 0xb82f1e52u;
+    x ^= x * 0xc7afe638u;
+    x ^= x * 0x8d22f6e6u;
+    return ReverseBits(x);
+}
+
+} // namespace mpart
+
+#endif // MPART_COUNTERRNG_H
@@ -0,0 +1,102 @@
+#ifndef MPART_UTILITIES_MAPPEDDATASET_H
+#define MPART_UTILITIES_MAPPEDDATASET_H
+
+#include "MParT/Utilities/ArrayConversions.h"
+#include "MParT/Utilities/MappedFile.h"
+
+#include <Kokkos_Core.hpp>
+#include <cstdint>
+#include <string>
+
+namespace mpart{
+
+/**
+ * @brief A read-only dataset of samples stored in a memory-mapped binary file.
+ * @details The file holds a \f$d\times N\f$ matrix of doubles in column-major order, so each sample is contiguous
+ * and a block of consecutive samples is a contiguous range of the file.  The data is preceded by a 32 byte header:
+ *
+ * | Bytes   | Contents                                        |
+ * |---------|-------------------------------------------------|
+ * | 0-7     | The characters `MPARTDAT`                       |
+ * | 8-11    | Format version (uint32, currently 1)            |
+ * | 12-15   | Reserved, zero                                  |
+ * | 16-23   | Dimension \f$d\f$ of each sample (uint64)       |
+ * | 24-31   | Number of samples \f$N\f$ (uint64)              |
+ *
+ * All integers are stored in the native byte order of the machine that wrote the file.  Files can be created with
+ * MappedDataset::Write or by any program that writes the same layout.
+ *
+ * Blocks of the dataset are returned as unmanaged views into the mapping, so no data is read until it is accessed
+ * and the operating system is free to evict pages that are no longer used.  This allows datasets that are larger
+ * than the available memory to be streamed through a MapObjective.
+ *
+ * @code{.cpp}
+ * MappedDataset::Write("samples.bin", samples);
+ * auto data = std::make_shared<MappedDataset>("samples.bin");
+ * auto objective = ObjectiveFactory::CreateGaussianKLObjective<Kokkos::HostSpace>(data);
+ * @endcode
+ */
+class MappedDataset {
+public:
+
+    /**
+     * @brief Map an existing dataset file into memory.
+     *
+     * @param filename Path to a file with the layout described above
+     * @throws std::runtime_error if the file cannot be opened or mapped, or if its header is invalid
+     */
+    MappedDataset(std::string const& filename);
+
+    /** @brief Dimension of each sample, i.e., the number of rows of the dataset. */
+    unsigned int Dim() const {return dim_;}
+
+    /** @brief Number of samples, i.e., the number of columns of the dataset. */
+    unsigned int NumSamples() const {return numSamples_;}
+
+    /** @brief Path of the mapped file. */
+    std::string const& Filename() const {return file_.Filename();}
+
+    /**
+     * @brief Returns the samples with indices in `[start, end)` without copying them.
+     *
+     * @param start Index of the first sample in the block
+     * @param end One past the index of the last sample in the block
+     * @return StridedMatrix<const double, Kokkos::HostSpace> A `Dim() x (end-start)` view into the mapped file
+     */
+    StridedMatrix<const double, Kokkos::HostSpace> Block(unsigned int start, unsigned int end) const;
+
+    /** @brief Returns a view of the entire dataset without copying it. */
+    StridedMatrix<const double, Kokkos::HostSpace> All() const {return Block(0, numSamples_);}
+
+    /**
+     * @brief Tells the operating system that the samples in `[start, end)` will not be needed again soon.
+     * @details Only pages that lie entirely inside the block are released.  This is only a hint and does not
+     * invalidate views returned by Block; released pages are read again from the file if they are accessed.
+     *
+     * @param start Index of the first sample in the block
+     * @param end One past the index of the last sample in the block
+     */
+    void Release(unsigned int start, unsigned int end) const;
+
+    /**
+     * @brief Writes a dataset to a file that can be opened with the MappedDataset constructor.
+     *
+     * @param filename Path of the file to write.  Existing files are overwritten.
+     * @param data A `dim x N` matrix of samples
+     * @throws std::runtime_error if the file cannot be written
+     */
+    static void Write(std::string const& filename, StridedMatrix<const double, Kokkos::HostSpace> data);
+
+    /** @brief Size of the file header in bytes.  The sample data begins at this offset. */
+    static constexpr std::size_t HeaderBytes = 32;
+
+private:
+    MappedFile file_;
+    unsigned int dim_ = 0;
+    unsigned int numSamples_ = 0;
+    const double* data_ = nullptr;
+};
+
+} // namespace mpart
+
+#endif // MPART_UTILITIES_MAPPEDDATASET_H
@@ -0,0 +1,66 @@
+#ifndef MPART_UTILITIES_MAPPEDFILE_H
+#define MPART_UTILITIES_MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace mpart{
+
+/**
+ * @brief Owns a memory mapping of an entire file.
+ * @details The mapping is private to the process.  A read-only mapping faults on any write, while a copy-on-write mapping
+ * lets the process modify its view of the data without touching the file: pages are shared with other processes
+ * mapping the same file until they are written to.  The mapping is released when the object is destroyed, so any
+ * pointers or views into the data must not outlive it.
+ *
+ * @see MappedDataset
+ */
+class MappedFile {
+public:
+
+    /**
+     * @brief Map a file into memory.
+     *
+     * @param filename Path of the file to map
+     * @param copyOnWrite If true, the mapping is writable and writes are private to this process.  Otherwise the mapping is read-only.
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    MappedFile(std::string const& filename, bool copyOnWrite=false);
+
+    ~MappedFile();
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    /** @brief Pointer to the first byte of the file. */
+    char* Data() const {return static_cast<char*>(mapping_);}
+
+    /** @brief Size of the file in bytes. */
+    std::size_t Size() const {return size_;}
+
+    /** @brief Path of the mapped file. */
+    std::string const& Filename() const {return filename_;}
+
+    /** @brief Hints that the file will be read from front to back. */
+    void AdviseSequential() const;
+
+    /**
+     * @brief Hints that the bytes in `[offset, offset+bytes)` will not be needed again soon.
+     * @details Only pages that lie entirely inside the range are released.  Released pages of a read-only mapping are
+     * read again from the file if they are accessed.  This should not be used on modified pages of a copy-on-write mapping,
+     * since the modifications would be lost.
+     *
+     * @param offset Offset of the first byte in the range
+     * @param bytes Number of bytes in the range
+     */
+    void Release(std::size_t offset, std::size_t bytes) const;
+
+private:
+    std::string filename_;
+    void* mapping_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+} // namespace mpart
+
+#endif // MPART_UTILITIES_MAPPEDFILE_H
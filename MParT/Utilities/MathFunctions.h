@@ -21,6 +21,43 @@ namespace mpart{
         return out;
     }
 
+    /** @brief Computes the inverse \f$\Phi^{-1}(p)\f$ of the standard normal CDF for \f$p\in(0,1)\f$.
+        @details Uses the rational approximation of P. J. Acklam followed by one step of Halley's method, which gives
+                 a relative error of roughly \f$10^{-14}\f$ in \f$p\f$.
+    */
+    KOKKOS_INLINE_FUNCTION double InverseNormalCDF(double p)
+    {
+        const double a[6] = {-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                              1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00};
+        const double b[5] = {-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+                              6.680131188771972e+01, -1.328068155288572e+01};
+        const double c[6] = {-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                             -2.549732539343734e+00,  4.374664141464968e+00,  2.938163982698783e+00};
+        const double d[4] = { 7.784695709041462e-03,  3.224671290700398e-01,  2.445134137142996e+00,
+                              3.754408661907416e+00};
+        const double pLow = 0.02425;
+
+        double x;
+        if(p < pLow){
+            double q = MathSpace::sqrt(-2.0*MathSpace::log(p));
+            x = (((((c[0]*q+c[1])*q+c[2])*q+c[3])*q+c[4])*q+c[5]) / ((((d[0]*q+d[1])*q+d[2])*q+d[3])*q+1.0);
+        }else if(p <= 1.0-pLow){
+            double q = p - 0.5;
+            double r = q*q;
+            x = (((((a[0]*r+a[1])*r+a[2])*r+a[3])*r+a[4])*r+a[5])*q / (((((b[0]*r+b[1])*r+b[2])*r+b[3])*r+b[4])*r+1.0);
+        }else{
+            double q = MathSpace::sqrt(-2.0*MathSpace::log(1.0-p));
+            x = -(((((c[0]*q+c[1])*q+c[2])*q+c[3])*q+c[4])*q+c[5]) / ((((d[0]*q+d[1])*q+d[2])*q+d[3])*q+1.0);
+        }
+
+        // Halley refinement
+        const double sqrt2 = 1.4142135623730950488;
+        const double sqrt2pi = 2.5066282746310005024;
+        double e = 0.5*MathSpace::erfc(-x/sqrt2) - p;
+        double u = e*sqrt2pi*MathSpace::exp(0.5*x*x);
+        return x - u/(1.0 + 0.5*x*u);
+    }
+
 }
 
 #endif
\ No newline at end of file
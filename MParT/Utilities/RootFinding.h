@@ -15,17 +15,18 @@ KOKKOS_INLINE_FUNCTION void swapPair(T& x1, T& x2, T& y1, T& y2) {
  * The info argument can be used to detect when a bracket cannot be found.  Upon exit, a value of info=0
  * indicates success while a negative value indicates failure.  info=-1 indicates that the function 
  * seems to be perfectly flat and a root might not exist.  info=-2 indicates that the maximum number of 
- * iterations (128) was exceeded.
+ * iterations (128) was exceeded.  The initial step `stepSize` is doubled after every step that fails to
+ * bracket the root.
 */
 template<typename MemorySpace, typename FunctorType>
 KOKKOS_INLINE_FUNCTION void FindBracket(FunctorType f,
                                         double& xlb, double& ylb,
                                         double& xub, double& yub,
                                         const double yd,
-                                        int& info)
+                                        int& info,
+                                        double stepSize = 1.0)
 {
     const unsigned int maxIts = 128;
-    double stepSize = 1.0;
     info = 0;
 
     ylb = f(xlb);
@@ -120,12 +121,15 @@ KOKKOS_INLINE_FUNCTION double Find_x_ITP(double xlb, double xub, double yd, doub
  * @param xtol Tolerance for the root
  * @param ftol Tolerance for the function value
  * @param info Output flag
+ * @param stepSize The initial step used to search for a bracket around x0.  Non-positive values are replaced with 1.
  * @return root of the function \f$f(\cdot)-y_d\f$
  */
 template<typename MemorySpace, typename FunctorType>
-KOKKOS_INLINE_FUNCTION double InverseSingleBracket(double yd, FunctorType f, double x0, const double xtol, const double ftol, int& info)
+KOKKOS_INLINE_FUNCTION double InverseSingleBracket(double yd, FunctorType f, double x0, const double xtol, const double ftol, int& info,
+                                                   double stepSize=1.0)
 {   
-    double stepSize=1.0;
+    if(!(stepSize>0.0))
+        stepSize = 1.0;
     const unsigned int maxIts = 10000;
 
     // First, we need to find two points that bound the solution.
@@ -139,7 +143,7 @@ KOKKOS_INLINE_FUNCTION double InverseSingleBracket(double yd, FunctorType f, dou
 
     // Compute initial bracket containing the root
     int bracket_info = 0;
-    FindBracket<MemorySpace>(f, xlb, ylb, xub, yub, yd, bracket_info);
+    FindBracket<MemorySpace>(f, xlb, ylb, xub, yub, yd, bracket_info, stepSize);
     
     if((bracket_info<0)||(((ylb>yd)||(yub<yd)))){
         info = -2;
@@ -178,6 +182,143 @@ KOKKOS_INLINE_FUNCTION double InverseSingleBracket(double yd, FunctorType f, dou
     return 0.5*(xub+xlb);
 }
 
+/**
+ * @brief Safeguarded Halley/Newton solver for monotone functions with cheap derivatives.
+ * @details Finds \f$x\f$ such that \f$f(x)=y_d\f$ for a continuous and monotonically increasing function \f$f\f$.  Each
+ * iteration takes a Halley step, or a Newton step when the Halley correction is unreliable.  Points where \f$f(x)<y_d\f$
+ * and \f$f(x)>y_d\f$ are recorded as they are visited.  Once the root is bracketed, steps that leave the bracket are
+ * replaced by bisection.  Before the root is bracketed, the step length is limited to a trust radius that starts at
+ * `stepSize` and doubles whenever it is reached, mirroring FindBracket.  If the iteration does not converge within 50 steps,
+ * or the derivative is not positive, this function falls back to InverseSingleBracket starting from the current iterate.
+ * The info argument is set as in InverseSingleBracket.
+ * @tparam FunctorType A functor with `double operator()(double x)` and `void ValueAndDerivatives(double x, double& f, double& df, double& d2f)`.
+ * @param yd Given output value
+ * @param f Functor
+ * @param x0 Initial guess
+ * @param xtol Tolerance for the root
+ * @param ftol Tolerance for the function value
+ * @param info Output flag
+ * @param stepSize The initial trust radius.  Non-positive values are replaced with 1.
+ * @return root of the function \f$f(\cdot)-y_d\f$
+ */
+template<typename MemorySpace, typename FunctorType>
+KOKKOS_INLINE_FUNCTION double InverseSingleNewton(double yd, FunctorType f, double x0, const double xtol, const double ftol, int& info,
+                                                  double stepSize=1.0)
+{
+    const unsigned int maxIts = 50;
+    info = 0;
+
+    bool hasLower = false, hasUpper = false;
+    double xlb = 0.0, xub = 0.0;
+    double maxStep = (stepSize>0.0) ? stepSize : 1.0;
+
+    double xc = x0;
+    double fc, dfc, d2fc;
+
+    for(unsigned int it=0; it<maxIts; ++it){
+
+        f.ValueAndDerivatives(xc, fc, dfc, d2fc);
+        const double r = fc - yd;
+
+        if(fabs(r)<ftol)
+            return xc;
+
+        if(!(dfc>0.0) || std::isnan(fc))
+            break;
+
+        // Keep track of the tightest bracket seen so far
+        if(r<0){
+            if(!hasLower || (xc>xlb))
+                xlb = xc;
+            hasLower = true;
+        }else{
+            if(!hasUpper || (xc<xub))
+                xub = xc;
+            hasUpper = true;
+        }
+
+        // Halley's correction to the Newton step, which is dropped when it would change the step substantially
+        double step = r/dfc;
+        const double denom = 1.0 - 0.5*step*d2fc/dfc;
+        if((denom>0.5) && (denom<2.0))
+            step /= denom;
+
+        double xn = xc - step;
+
+        if(hasLower && hasUpper){
+            if((xn<=xlb) || (xn>=xub))
+                xn = 0.5*(xlb+xub);
+
+            if((xub-xlb)<xtol)
+                return 0.5*(xlb+xub);
+
+        }else if(fabs(step)>maxStep){
+            xn = xc - ((step>0) ? maxStep : -maxStep);
+            maxStep *= 2.0;
+        }
+
+        if(fabs(xn-xc)<xtol)
+            return xn;
+
+        xc = xn;
+    }
+
+    return InverseSingleBracket<MemorySpace>(yd, f, xc, xtol, ftol, info, maxStep);
+}
+
+/**
+ * @brief Inverts a cubic Hermite interpolant on a single interval.
+ * @details Given the values \f$y_0\leq y_d\leq y_1\f$ and derivatives \f$d_0,d_1\f$ of a function at the ends of an interval of
+ * width \f$h\f$, finds \f$t\in[0,1]\f$ such that the cubic Hermite interpolant \f$p\f$ satisfies \f$p(t)=y_d\f$.  Newton steps
+ * on \f$p\f$ are safeguarded with bisection, so a root in \f$[0,1]\f$ is found even when \f$p\f$ is not monotone.
+ * @param yd Given output value
+ * @param y0 Value at the left end of the interval
+ * @param y1 Value at the right end of the interval
+ * @param d0 Derivative at the left end of the interval, with respect to \f$x\f$
+ * @param d1 Derivative at the right end of the interval, with respect to \f$x\f$
+ * @param h The width of the interval
+ * @return The relative position \f$t\f$ of the root, so that the root is at \f$x_0 + th\f$.
+ */
+KOKKOS_INLINE_FUNCTION double InverseHermiteCubic(double yd, double y0, double y1, double d0, double d1, double h)
+{
+    const double dy = y1 - y0;
+    if(!(dy>0.0))
+        return 0.5;
+
+    // Scale the derivatives to the unit interval
+    const double m0 = h*d0;
+    const double m1 = h*d1;
+
+    double tlb = 0.0, tub = 1.0;
+    double t = fmin(fmax((yd-y0)/dy, 0.0), 1.0);
+
+    for(unsigned int it=0; it<50; ++it){
+        const double t2 = t*t;
+        const double t3 = t2*t;
+        const double p = (2.0*t3 - 3.0*t2 + 1.0)*y0 + (t3 - 2.0*t2 + t)*m0 + (-2.0*t3 + 3.0*t2)*y1 + (t3 - t2)*m1;
+        const double dp = (6.0*t2 - 6.0*t)*y0 + (3.0*t2 - 4.0*t + 1.0)*m0 + (6.0*t - 6.0*t2)*y1 + (3.0*t2 - 2.0*t)*m1;
+        const double r = p - yd;
+
+        if(fabs(r)<=1e-14*dy)
+            return t;
+
+        if(r<0){
+            tlb = t;
+        }else{
+            tub = t;
+        }
+
+        double tn = (dp>0.0) ? t - r/dp : 0.5*(tlb+tub);
+        if((tn<=tlb) || (tn>=tub))
+            tn = 0.5*(tlb+tub);
+
+        if(fabs(tn-t)<1e-15)
+            return tn;
+        t = tn;
+    }
+    return t;
+}
+
 } // RootFinding
 
 } // mpart
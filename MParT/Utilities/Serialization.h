@@ -14,6 +14,10 @@
 #define REGISTER_MONO_COMP(BASIS_HOMOGENEITY, BASIS_TYPE, POS_TYPE, QUAD_TYPE, MEMORY_SPACE) \
     CEREAL_REGISTER_TYPE(mpart::MonotoneComponent<mpart::MultivariateExpansionWorker<mpart::BasisEvaluator<BASIS_HOMOGENEITY, BASIS_TYPE>, MEMORY_SPACE>, mpart::POS_TYPE, mpart::QUAD_TYPE<MEMORY_SPACE>, MEMORY_SPACE>)
 
+// Registers a MonotoneComponent built on a FixedDimExpansionWorker.  Used in MapFactoryImpl19.cpp
+#define REGISTER_FIXED_DIM_MONO_COMP(DIM, MAX_ORDER, BASIS_HOMOGENEITY, BASIS_TYPE, POS_TYPE, QUAD_TYPE, MEMORY_SPACE) \
+    CEREAL_REGISTER_TYPE(mpart::MonotoneComponent<mpart::FixedDimExpansionWorker<DIM, MAX_ORDER, mpart::BasisEvaluator<BASIS_HOMOGENEITY, BASIS_TYPE>, MEMORY_SPACE>, mpart::POS_TYPE, mpart::QUAD_TYPE<MEMORY_SPACE>, MEMORY_SPACE>)
+
 
 namespace cereal {
     template <typename ScalarType, typename Archive, typename... Traits>
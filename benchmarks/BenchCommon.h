@@ -0,0 +1,70 @@
+#ifndef MPART_BENCHCOMMON_H
+#define MPART_BENCHCOMMON_H
+
+#include <benchmark/benchmark.h>
+
+#include "MParT/MapOptions.h"
+#include "MParT/Utilities/ArrayConversions.h"
+
+#include <Kokkos_Core.hpp>
+
+#include <random>
+#include <vector>
+
+namespace mpart{
+namespace bench{
+
+    /** Basis types swept by the benchmarks.  The benchmark argument is the index into this array. */
+    inline const std::vector<BasisTypes> basisSweep = {BasisTypes::ProbabilistHermite, BasisTypes::PhysicistHermite, BasisTypes::HermiteFunctions};
+
+    /** Quadrature types swept by the benchmarks.  The benchmark argument is the index into this array. */
+    inline const std::vector<QuadTypes> quadSweep = {QuadTypes::AdaptiveSimpson, QuadTypes::ClenshawCurtis, QuadTypes::AdaptiveClenshawCurtis};
+
+    /** Builds the map options for a benchmark from the basis and quadrature indices in its arguments. */
+    inline MapOptions GetOptions(unsigned int basisInd, unsigned int quadInd)
+    {
+        MapOptions opts;
+        opts.basisType = basisSweep.at(basisInd);
+        opts.quadType = quadSweep.at(quadInd);
+        opts.quadPts = 7;
+        return opts;
+    }
+
+    /** Returns a dim x numPts matrix of standard normal samples generated with a fixed seed. */
+    inline Kokkos::View<double**, Kokkos::HostSpace> RandomPoints(unsigned int dim, unsigned int numPts, unsigned int seed=2024)
+    {
+        std::mt19937 gen(seed);
+        std::normal_distribution<double> dist;
+
+        Kokkos::View<double**, Kokkos::HostSpace> pts("Benchmark Points", dim, numPts);
+        for(unsigned int i=0; i<dim; ++i){
+            for(unsigned int j=0; j<numPts; ++j)
+                pts(i,j) = dist(gen);
+        }
+        return pts;
+    }
+
+    /** Returns a vector of small pseudo-random coefficients so that the maps are not trivially linear. */
+    inline Kokkos::View<double*, Kokkos::HostSpace> RandomCoeffs(unsigned int numCoeffs, unsigned int seed=1234)
+    {
+        std::mt19937 gen(seed);
+        std::normal_distribution<double> dist(0.0, 0.1);
+
+        Kokkos::View<double*, Kokkos::HostSpace> coeffs("Benchmark Coefficients", numCoeffs);
+        for(unsigned int i=0; i<numCoeffs; ++i)
+            coeffs(i) = dist(gen);
+        return coeffs;
+    }
+
+    /** Records the problem size and the number of host threads used by Kokkos in the benchmark output. */
+    inline void SetCounters(benchmark::State& state, unsigned int numPts, unsigned int numCoeffs)
+    {
+        state.counters["threads"] = Kokkos::DefaultHostExecutionSpace().concurrency();
+        state.counters["coeffs"] = numCoeffs;
+        state.counters["pts/s"] = benchmark::Counter(double(numPts), benchmark::Counter::kIsIterationInvariantRate);
+    }
+
+} // namespace bench
+} // namespace mpart
+
+#endif
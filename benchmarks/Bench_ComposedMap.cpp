@@ -0,0 +1,61 @@
+#include "BenchCommon.h"
+
+#include "MParT/ComposedMap.h"
+#include "MParT/MapFactory.h"
+
+using namespace mpart;
+using namespace mpart::bench;
+using MemorySpace = Kokkos::HostSpace;
+
+// Benchmark arguments: {dim, number of layers, number of points, maximum number of checkpoints (-1 stores every layer)}
+
+namespace{
+
+    std::shared_ptr<ConditionalMapBase<MemorySpace>> CreateBenchComposedMap(benchmark::State const& state)
+    {
+        const unsigned int dim = state.range(0);
+        const unsigned int numLayers = state.range(1);
+
+        std::vector<std::shared_ptr<ConditionalMapBase<MemorySpace>>> maps(numLayers);
+        for(unsigned int i=0; i<numLayers; ++i)
+            maps.at(i) = MapFactory::CreateTriangular<MemorySpace>(dim, dim, 2, GetOptions(0,0));
+
+        auto composed = std::make_shared<ComposedMap<MemorySpace>>(maps, false, int(state.range(3)));
+        composed->SetCoeffs(RandomCoeffs(composed->numCoeffs));
+        return composed;
+    }
+
+    void ComposedArgs(benchmark::internal::Benchmark* b)
+    {
+        b->ArgNames({"dim", "layers", "pts", "checks"});
+        b->ArgsProduct({{2, 4}, {4, 16}, {1000}, {-1, 1, 2, 4}});
+        b->Unit(benchmark::kMillisecond);
+    }
+}
+
+static void BM_ComposedMap_CoeffGrad(benchmark::State& state)
+{
+    auto map = CreateBenchComposedMap(state);
+    auto pts = RandomPoints(map->inputDim, state.range(2));
+    auto sens = RandomPoints(map->outputDim, state.range(2), 11);
+
+    for(auto _ : state){
+        auto output = map->CoeffGrad(pts, sens);
+        benchmark::DoNotOptimize(output.data());
+    }
+    SetCounters(state, state.range(2), map->numCoeffs);
+}
+BENCHMARK(BM_ComposedMap_CoeffGrad)->Apply(ComposedArgs);
+
+static void BM_ComposedMap_LogDeterminantCoeffGrad(benchmark::State& state)
+{
+    auto map = CreateBenchComposedMap(state);
+    auto pts = RandomPoints(map->inputDim, state.range(2));
+
+    for(auto _ : state){
+        auto output = map->LogDeterminantCoeffGrad(pts);
+        benchmark::DoNotOptimize(output.data());
+    }
+    SetCounters(state, state.range(2), map->numCoeffs);
+}
+BENCHMARK(BM_ComposedMap_LogDeterminantCoeffGrad)->Apply(ComposedArgs);
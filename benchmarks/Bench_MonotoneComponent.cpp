@@ -0,0 +1,86 @@
+#include "BenchCommon.h"
+
+#include "MParT/MapFactory.h"
+#include "MParT/ConditionalMapBase.h"
+#include "MParT/MultiIndices/MultiIndexSet.h"
+
+using namespace mpart;
+using namespace mpart::bench;
+using MemorySpace = Kokkos::HostSpace;
+
+// Benchmark arguments: {dim, total order, number of points, basis index, quadrature index}
+
+namespace{
+
+    std::shared_ptr<ConditionalMapBase<MemorySpace>> CreateBenchComponent(benchmark::State const& state)
+    {
+        const unsigned int dim = state.range(0);
+        const unsigned int order = state.range(1);
+
+        FixedMultiIndexSet<MemorySpace> mset = MultiIndexSet::CreateTotalOrder(dim, order).Fix();
+        auto comp = MapFactory::CreateComponent<MemorySpace>(mset, GetOptions(state.range(3), state.range(4)));
+        comp->SetCoeffs(RandomCoeffs(comp->numCoeffs));
+        return comp;
+    }
+
+    void ComponentArgs(benchmark::internal::Benchmark* b)
+    {
+        b->ArgNames({"dim", "order", "pts", "basis", "quad"});
+        b->ArgsProduct({{1, 3, 6}, {2, 4}, {100, 10000}, {0, 1, 2}, {0, 1, 2}});
+        b->Unit(benchmark::kMillisecond);
+    }
+}
+
+static void BM_MonotoneComponent_Evaluate(benchmark::State& state)
+{
+    auto comp = CreateBenchComponent(state);
+    auto pts = RandomPoints(comp->inputDim, state.range(2));
+
+    for(auto _ : state){
+        auto output = comp->Evaluate(pts);
+        benchmark::DoNotOptimize(output.data());
+    }
+    SetCounters(state, state.range(2), comp->numCoeffs);
+}
+BENCHMARK(BM_MonotoneComponent_Evaluate)->Apply(ComponentArgs);
+
+static void BM_MonotoneComponent_Inverse(benchmark::State& state)
+{
+    auto comp = CreateBenchComponent(state);
+    auto pts = RandomPoints(comp->inputDim, state.range(2));
+    auto r = RandomPoints(1, state.range(2), 7);
+
+    for(auto _ : state){
+        auto output = comp->Inverse(pts, r);
+        benchmark::DoNotOptimize(output.data());
+    }
+    SetCounters(state, state.range(2), comp->numCoeffs);
+}
+BENCHMARK(BM_MonotoneComponent_Inverse)->Apply(ComponentArgs);
+
+static void BM_MonotoneComponent_CoeffGrad(benchmark::State& state)
+{
+    auto comp = CreateBenchComponent(state);
+    auto pts = RandomPoints(comp->inputDim, state.range(2));
+    auto sens = RandomPoints(1, state.range(2), 11);
+
+    for(auto _ : state){
+        auto output = comp->CoeffGrad(pts, sens);
+        benchmark::DoNotOptimize(output.data());
+    }
+    SetCounters(state, state.range(2), comp->numCoeffs);
+}
+BENCHMARK(BM_MonotoneComponent_CoeffGrad)->Apply(ComponentArgs);
+
+static void BM_MonotoneComponent_LogDeterminantCoeffGrad(benchmark::State& state)
+{
+    auto comp = CreateBenchComponent(state);
+    auto pts = RandomPoints(comp->inputDim, state.range(2));
+
+    for(auto _ : state){
+        auto output = comp->LogDeterminantCoeffGrad(pts);
+        benchmark::DoNotOptimize(output.data());
+    }
+    SetCounters(state, state.range(2), comp->numCoeffs);
+}
+BENCHMARK(BM_MonotoneComponent_LogDeterminantCoeffGrad)->Apply(ComponentArgs);
@@ -0,0 +1,116 @@
+#include "BenchCommon.h"
+
+#include "MParT/MultiIndices/MultiIndexSet.h"
+
+using namespace mpart;
+using namespace mpart::bench;
+
+// Benchmark arguments: {dim, total order} for construction and {dim, number of active terms} for adaptation
+
+namespace{
+
+    void ConstructionArgs(benchmark::internal::Benchmark* b)
+    {
+        b->ArgNames({"dim", "order"});
+        b->Args({10, 4});
+        b->Args({10, 6});
+        b->Args({20, 3});
+        b->Args({20, 4});
+        b->Args({40, 3});
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    void AdaptArgs(benchmark::internal::Benchmark* b)
+    {
+        b->ArgNames({"dim", "terms"});
+        b->ArgsProduct({{10, 20}, {5000, 20000}});
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    /** Grows a set from the constant term by repeatedly expanding the whole frontier until it has at least numTerms active terms. */
+    MultiIndexSet GrowSet(unsigned int dim, unsigned int numTerms)
+    {
+        MultiIndexSet mset(dim);
+        mset.AddActive(MultiIndex(dim));
+        while(mset.Size() < numTerms)
+            mset.Expand();
+        return mset;
+    }
+
+    void SetSetCounters(benchmark::State& state, MultiIndexSet const& mset)
+    {
+        state.counters["terms"] = mset.Size();
+        state.counters["terms/s"] = benchmark::Counter(double(mset.Size()), benchmark::Counter::kIsIterationInvariantRate);
+    }
+}
+
+static void BM_MultiIndexSet_CreateTotalOrder(benchmark::State& state)
+{
+    unsigned int size = 0;
+    for(auto _ : state){
+        MultiIndexSet mset = MultiIndexSet::CreateTotalOrder(state.range(0), state.range(1));
+        size = mset.Size();
+        benchmark::DoNotOptimize(size);
+    }
+    state.counters["terms"] = size;
+    state.counters["terms/s"] = benchmark::Counter(double(size), benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_MultiIndexSet_CreateTotalOrder)->Apply(ConstructionArgs);
+
+static void BM_MultiIndexSet_Expand(benchmark::State& state)
+{
+    MultiIndexSet mset(state.range(0));
+    for(auto _ : state){
+        mset = GrowSet(state.range(0), state.range(1));
+        benchmark::DoNotOptimize(mset.Size());
+    }
+    SetSetCounters(state, mset);
+}
+BENCHMARK(BM_MultiIndexSet_Expand)->Apply(AdaptArgs);
+
+static void BM_MultiIndexSet_ReducedMargin(benchmark::State& state)
+{
+    MultiIndexSet mset = GrowSet(state.range(0), state.range(1));
+    for(auto _ : state){
+        std::vector<MultiIndex> margin = mset.ReducedMargin();
+        benchmark::DoNotOptimize(margin.data());
+    }
+    SetSetCounters(state, mset);
+}
+BENCHMARK(BM_MultiIndexSet_ReducedMargin)->Apply(AdaptArgs);
+
+static void BM_MultiIndexSet_Frontier(benchmark::State& state)
+{
+    MultiIndexSet mset = GrowSet(state.range(0), state.range(1));
+    for(auto _ : state){
+        std::vector<unsigned int> frontier = mset.Frontier();
+        benchmark::DoNotOptimize(frontier.data());
+    }
+    SetSetCounters(state, mset);
+}
+BENCHMARK(BM_MultiIndexSet_Frontier)->Apply(AdaptArgs);
+
+static void BM_MultiIndexSet_Lookup(benchmark::State& state)
+{
+    MultiIndexSet mset = GrowSet(state.range(0), state.range(1));
+
+    // Query every active term and one of its admissible forward neighbors
+    std::vector<MultiIndex> queries;
+    for(unsigned int i=0; i<mset.Size(); ++i){
+        queries.push_back(mset.at(i));
+        MultiIndex next = mset.at(i);
+        next.Set(i%mset.Length(), next.Get(i%mset.Length())+1);
+        queries.push_back(next);
+    }
+
+    for(auto _ : state){
+        unsigned int numAdmissible = 0;
+        for(auto const& multi : queries){
+            numAdmissible += mset.IsAdmissible(multi) ? 1 : 0;
+            benchmark::DoNotOptimize(mset.MultiToIndex(multi));
+        }
+        benchmark::DoNotOptimize(numAdmissible);
+    }
+    SetSetCounters(state, mset);
+}
+BENCHMARK(BM_MultiIndexSet_Lookup)->Apply(AdaptArgs);
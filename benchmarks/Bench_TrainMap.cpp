@@ -0,0 +1,69 @@
+#include "BenchCommon.h"
+
+#include "MParT/MapFactory.h"
+#include "MParT/MapObjective.h"
+#include "MParT/TrainMap.h"
+
+using namespace mpart;
+using namespace mpart::bench;
+using MemorySpace = Kokkos::HostSpace;
+
+// Benchmark arguments: {dim, total order, number of training points}
+
+static void BM_TrainMap(benchmark::State& state)
+{
+    const unsigned int dim = state.range(0);
+    const unsigned int order = state.range(1);
+    const unsigned int numPts = state.range(2);
+
+    // Samples from a banana-shaped density so that the optimum is not the identity map
+    auto train = RandomPoints(dim, numPts);
+    for(unsigned int i=0; i<numPts; ++i)
+        train(dim-1,i) += train(0,i)*train(0,i);
+
+    StridedMatrix<const double, MemorySpace> trainPts = train;
+    auto objective = ObjectiveFactory::CreateGaussianKLObjective<MemorySpace>(trainPts);
+
+    TrainOptions trainOpts;
+    trainOpts.opt_maxeval = 50;
+
+    for(auto _ : state){
+        state.PauseTiming();
+        auto map = MapFactory::CreateTriangular<MemorySpace>(dim, dim, order, GetOptions(0,0));
+        state.ResumeTiming();
+
+        double obj = TrainMap(map, objective, trainOpts);
+        benchmark::DoNotOptimize(obj);
+    }
+    SetCounters(state, numPts, 0);
+}
+BENCHMARK(BM_TrainMap)->ArgNames({"dim", "order", "pts"})->ArgsProduct({{2, 4}, {2, 3}, {1000, 10000}})->Unit(benchmark::kMillisecond);
+
+// Same problem as BM_TrainMap, with each block of the map trained as a separate problem
+static void BM_TrainMapComponentwise(benchmark::State& state)
+{
+    const unsigned int dim = state.range(0);
+    const unsigned int order = state.range(1);
+    const unsigned int numPts = state.range(2);
+
+    auto train = RandomPoints(dim, numPts);
+    for(unsigned int i=0; i<numPts; ++i)
+        train(dim-1,i) += train(0,i)*train(0,i);
+
+    StridedMatrix<const double, MemorySpace> trainPts = train;
+    auto objective = ObjectiveFactory::CreateGaussianKLObjective<MemorySpace>(trainPts);
+
+    TrainOptions trainOpts;
+    trainOpts.opt_maxeval = 50;
+
+    for(auto _ : state){
+        state.PauseTiming();
+        auto map = MapFactory::CreateTriangular<MemorySpace>(dim, dim, order, GetOptions(0,0));
+        state.ResumeTiming();
+
+        double obj = TrainMapComponentwise(map, objective, trainOpts);
+        benchmark::DoNotOptimize(obj);
+    }
+    SetCounters(state, numPts, 0);
+}
+BENCHMARK(BM_TrainMapComponentwise)->ArgNames({"dim", "order", "pts"})->ArgsProduct({{2, 4}, {2, 3}, {1000, 10000}})->Unit(benchmark::kMillisecond);
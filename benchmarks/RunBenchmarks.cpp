@@ -0,0 +1,17 @@
+#include <benchmark/benchmark.h>
+
+#include "MParT/Initialization.h"
+
+int main( int argc, char* argv[] ) {
+
+  // Kokkos removes the arguments it recognizes (e.g., --kokkos-threads) before google benchmark parses the rest
+  mpart::Initialize(argc,argv);
+
+  benchmark::Initialize(&argc, argv);
+  if(benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -21,12 +21,15 @@ void mpart::binding::MapOptionsWrapper(jlcxx::Module &mod) {
     mod.add_bits<PosFuncTypes>("__PosFuncTypes", jlcxx::julia_type("CppEnum"));
     mod.set_const("__Exp", PosFuncTypes::Exp);
     mod.set_const("__SoftPlus", PosFuncTypes::SoftPlus);
+    mod.set_const("__Square", PosFuncTypes::Square);
 
     // QuadTypes
     mod.add_bits<QuadTypes>("__QuadTypes", jlcxx::julia_type("CppEnum"));
     mod.set_const("__ClenshawCurtis", QuadTypes::ClenshawCurtis);
     mod.set_const("__AdaptiveSimpson", QuadTypes::AdaptiveSimpson);
     mod.set_const("__AdaptiveClenshawCurtis", QuadTypes::AdaptiveClenshawCurtis);
+    mod.set_const("__GaussLegendre", QuadTypes::GaussLegendre);
+    mod.set_const("__AdaptiveGaussKronrod", QuadTypes::AdaptiveGaussKronrod);
 
     // SigmoidTypes
     mod.add_bits<SigmoidTypes>("__SigmoidTypes", jlcxx::julia_type("CppEnum"));
@@ -54,6 +57,7 @@ void mpart::binding::MapOptionsWrapper(jlcxx::Module &mod) {
         .method("__quadPts!", [](MapOptions &opts, unsigned int pts){ opts.quadPts = pts; })
         .method("__contDeriv!", [](MapOptions &opts, bool deriv){ opts.contDeriv = deriv; })
         .method("__nugget!", [](MapOptions &opts, double nugget){ opts.nugget = nugget; })
+        .method("__fixedDimWorker!", [](MapOptions &opts, bool useFixed){ opts.fixedDimWorker = useFixed; })
         .method("Serialize", [](MapOptions &opts, std::string &filename){
 #if defined(MPART_HAS_CEREAL)
             std::ofstream os (filename);
@@ -9,6 +9,13 @@ void mpart::binding::TrainMapWrapper(jlcxx::Module &mod) {
         .method("__opt_xtol_rel!", [](TrainOptions &opts, double tol){opts.opt_xtol_rel = tol;})
         .method("__opt_xtol_abs!", [](TrainOptions &opts, double tol){opts.opt_xtol_abs = tol;})
         .method("__opt_maxeval!", [](TrainOptions &opts, int eval){opts.opt_maxeval = eval;})
+        .method("__opt_batch_size!", [](TrainOptions &opts, unsigned int size){opts.opt_batch_size = size;})
+        .method("__opt_epochs!", [](TrainOptions &opts, unsigned int epochs){opts.opt_epochs = epochs;})
+        .method("__opt_learning_rate!", [](TrainOptions &opts, double rate){opts.opt_learning_rate = rate;})
+        .method("__opt_lr_decay!", [](TrainOptions &opts, double decay){opts.opt_lr_decay = decay;})
+        .method("__opt_beta1!", [](TrainOptions &opts, double beta){opts.opt_beta1 = beta;})
+        .method("__opt_beta2!", [](TrainOptions &opts, double beta){opts.opt_beta2 = beta;})
+        .method("__opt_seed!", [](TrainOptions &opts, unsigned int seed){opts.opt_seed = seed;})
         .method("__verbose!", [](TrainOptions &opts, int verbose){opts.verbose = verbose;})
     ;
 
@@ -18,4 +25,5 @@ void mpart::binding::TrainMapWrapper(jlcxx::Module &mod) {
 
     // TrainMap
     mod.method("TrainMap", &mpart::TrainMap<Kokkos::HostSpace>);
+    mod.method("TrainMapComponentwise", &mpart::TrainMapComponentwise<Kokkos::HostSpace>);
 }
\ No newline at end of file
@@ -1,5 +1,5 @@
 classdef PosFuncTypes
    enumeration
-        Exp,SoftPlus
+        Exp,SoftPlus,Square
    end
 end
\ No newline at end of file
@@ -1,5 +1,5 @@
 classdef QuadTypes
     enumeration
-        ClenshawCurtis,AdaptiveSimpson,AdaptiveClenshawCurtis
+        ClenshawCurtis,AdaptiveSimpson,AdaptiveClenshawCurtis,GaussLegendre,AdaptiveGaussKronrod
     end
 end
\ No newline at end of file
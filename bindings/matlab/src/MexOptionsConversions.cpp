@@ -28,6 +28,8 @@ MapOptions MapOptionsFromMatlabArgs(
     opts.posFuncType    = PosFuncTypes::Exp;
     } else if (posFuncType == "SoftPlus") {
     opts.posFuncType    = PosFuncTypes::SoftPlus;
+    } else if (posFuncType == "Square") {
+    opts.posFuncType    = PosFuncTypes::Square;
     } else {
     std::cout << "Unknown posFuncType type, value is set to default" <<std::endl;
     }
@@ -38,6 +40,10 @@ MapOptions MapOptionsFromMatlabArgs(
     opts.quadType    = QuadTypes::AdaptiveSimpson;
     } else if (quadType == "AdaptiveClenshawCurtis") {
     opts.quadType    = QuadTypes::AdaptiveClenshawCurtis;
+    } else if (quadType == "GaussLegendre") {
+    opts.quadType    = QuadTypes::GaussLegendre;
+    } else if (quadType == "AdaptiveGaussKronrod") {
+    opts.quadType    = QuadTypes::AdaptiveGaussKronrod;
     } else {
     std::cout << "Unknown quadType, value is set to default" <<std::endl;
     }
@@ -6,12 +6,41 @@
 #include <string>
 #include <vector>
 #include <chrono>
+#include <mutex>
 
 #include "../../common/include/CommonUtilities.h"
 
 namespace mpart{
 namespace binding{
 
+/**
+   @brief Serializes the Kokkos kernels launched by bindings that release the GIL.
+   @details Kokkos does not support launching kernels on the default execution space from several threads at once, so only
+   one python thread at a time may run a function guarded by ReleaseGIL.  The lock is taken after the GIL is released, so a
+   thread waiting for it does not block python code that does not call into MParT.
+ */
+struct KokkosDispatchLock {
+    KokkosDispatchLock() : lock_(Mutex()){};
+
+    static std::mutex& Mutex(){
+        static std::mutex mutex;
+        return mutex;
+    }
+
+private:
+    std::lock_guard<std::mutex> lock_;
+};
+
+/**
+   @brief Call guard for bindings of compute-heavy functions.
+   @details Releases the GIL after the arguments have been converted and reacquires it before the result is converted
+   back to python, so other python threads can run while a map is evaluated or trained.  Arguments converted from numpy
+   arrays are held (or copied) by their type casters until the call returns, so the underlying memory stays valid.
+   While the GIL is released, the call holds the KokkosDispatchLock, so guarded calls from different python threads run
+   one at a time.  Functions using this guard must not touch python objects.
+ */
+using ReleaseGIL = pybind11::call_guard<pybind11::gil_scoped_release, KokkosDispatchLock>;
+
 /** Define a wrapper around Kokkos::Initialize that accepts a python dictionary instead of argc and argv. */
 void Initialize(pybind11::dict opts);
 
@@ -17,8 +17,22 @@ void mpart::binding::ComposedMapWrapper(py::module &m)
     if(!std::is_same<MemorySpace,Kokkos::HostSpace>::value) tName = "d" + tName;
 
     // ComposedMap
-    py::class_<ComposedMap<MemorySpace>, ConditionalMapBase<MemorySpace>, std::shared_ptr<ComposedMap<MemorySpace>>>(m, tName.c_str())
+    py::class_<ComposedMap<MemorySpace>, ConditionalMapBase<MemorySpace>, std::shared_ptr<ComposedMap<MemorySpace>>> composedMap(m, tName.c_str());
+    composedMap
         .def(py::init<std::vector<std::shared_ptr<ConditionalMapBase<MemorySpace>>>,bool,int>(), py::arg("maps"), py::arg("moveCoeffs") = false, py::arg("maxChecks")=-1)
+        .def("SetCheckpointBudget", &ComposedMap<MemorySpace>::SetCheckpointBudget, py::arg("maxBytes"))
+        .def("CheckpointBudget", &ComposedMap<MemorySpace>::CheckpointBudget)
+        .def("NumCheckpoints", &ComposedMap<MemorySpace>::NumCheckpoints, py::arg("numPts"))
+        .def("LastCheckpointReport", &ComposedMap<MemorySpace>::LastCheckpointReport)
+        ;
+
+    // ComposedMap::CheckpointReport
+    py::class_<typename ComposedMap<MemorySpace>::CheckpointReport>(composedMap, "CheckpointReport")
+        .def_readonly("maxCheckpoints", &ComposedMap<MemorySpace>::CheckpointReport::maxCheckpoints)
+        .def_readonly("peakCheckpoints", &ComposedMap<MemorySpace>::CheckpointReport::peakCheckpoints)
+        .def_readonly("numLayerEvals", &ComposedMap<MemorySpace>::CheckpointReport::numLayerEvals)
+        .def_readonly("bytesPerCheckpoint", &ComposedMap<MemorySpace>::CheckpointReport::bytesPerCheckpoint)
+        .def_readonly("peakBytes", &ComposedMap<MemorySpace>::CheckpointReport::peakBytes)
         ;
 
 }
@@ -1,5 +1,6 @@
 #include "CommonPybindUtilities.h"
 #include "MParT/MapFactory.h"
+#include "MParT/MappedMap.h"
 #include "MParT/ConditionalMapBase.h"
 #include <pybind11/stl.h>
 #include <pybind11/eigen.h>
@@ -29,6 +30,12 @@ void mpart::binding::MapFactoryWrapper(py::module &m)
 
     // CreateSigmoidTriangular
     m.def(isDevice? "dCreateSigmoidTriangular" : "CreateSigmoidTriangular", py::overload_cast<unsigned int, unsigned int, unsigned int, Eigen::Ref<const Eigen::RowMatrixXd> const&, MapOptions>(&MapFactory::CreateSigmoidTriangular<MemorySpace>));
+
+    // Flat memory-mapped map files are only supported on the host
+    if(!isDevice){
+        m.def("SaveMappedMap", &SaveMappedMap, py::arg("filename"), py::arg("map"), py::arg("options"));
+        m.def("LoadMappedMap", &LoadMappedMap, py::arg("filename"));
+    }
 }
 template void mpart::binding::MapFactoryWrapper<Kokkos::HostSpace>(py::module&);
 #if defined(MPART_ENABLE_GPU)
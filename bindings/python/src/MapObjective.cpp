@@ -23,9 +23,25 @@ void mpart::binding::MapObjectiveWrapper(py::module &m) {
         mName = "d" + mName;
     }
 
+    // The dataset files live on the host and are shared by the host and device objectives
+    if(std::is_same<MemorySpace,Kokkos::HostSpace>::value) {
+        py::class_<MappedDataset, std::shared_ptr<MappedDataset>>(m, "MappedDataset")
+            .def(py::init<std::string const&>(), "filename"_a)
+            .def("Dim", &MappedDataset::Dim)
+            .def("NumSamples", &MappedDataset::NumSamples)
+            .def("Filename", &MappedDataset::Filename)
+            .def_static("Write", [](std::string const& filename, Eigen::Ref<Eigen::MatrixXd> &data){
+                MappedDataset::Write(filename, MatToKokkos<double, Kokkos::HostSpace>(data));
+            }, "filename"_a, "data"_a)
+        ;
+    }
+
     py::class_<MapObjective<MemorySpace>, std::shared_ptr<MapObjective<MemorySpace>>>(m, t1Name.c_str())
-        .def("TestError", &KLObjective<MemorySpace>::TestError)
-        .def("TrainError", &KLObjective<MemorySpace>::TrainError)
+        .def("TestError", &KLObjective<MemorySpace>::TestError, ReleaseGIL())
+        .def("TrainError", &KLObjective<MemorySpace>::TrainError, ReleaseGIL())
+        .def("IsStreamed", &MapObjective<MemorySpace>::IsStreamed)
+        .def("SetStreamBlockBytes", &MapObjective<MemorySpace>::SetStreamBlockBytes)
+        .def("GetStreamBlockBytes", &MapObjective<MemorySpace>::GetStreamBlockBytes)
     ;
 
     py::class_<KLObjective<MemorySpace>, MapObjective<MemorySpace>, std::shared_ptr<KLObjective<MemorySpace>>>(m, t2Name.c_str());
@@ -47,6 +63,9 @@ void mpart::binding::MapObjectiveWrapper(py::module &m) {
             testView = storeTest;
             return ObjectiveFactory::CreateGaussianKLObjective(trainView, testView, dim);
         }, "train"_a, "test"_a, "dim"_a = 0)
+        .def(mName.c_str(), [](std::shared_ptr<MappedDataset> train, std::shared_ptr<MappedDataset> test, unsigned int dim){
+            return ObjectiveFactory::CreateGaussianKLObjective<MemorySpace>(train, test, dim);
+        }, "train"_a, "test"_a = nullptr, "dim"_a = 0)
     ;
 }
 
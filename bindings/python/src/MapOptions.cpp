@@ -26,13 +26,16 @@ void mpart::binding::MapOptionsWrapper(py::module &m)
     // PosFuncTypes
     py::enum_<PosFuncTypes>(m, "PosFuncTypes")
     .value("Exp",PosFuncTypes::Exp)
-    .value("SoftPlus",PosFuncTypes::SoftPlus);
+    .value("SoftPlus",PosFuncTypes::SoftPlus)
+    .value("Square",PosFuncTypes::Square);
 
     // QuadTypes
     py::enum_<QuadTypes>(m, "QuadTypes")
     .value("ClenshawCurtis",QuadTypes::ClenshawCurtis)
     .value("AdaptiveSimpson",QuadTypes::AdaptiveSimpson)
-    .value("AdaptiveClenshawCurtis",QuadTypes::AdaptiveClenshawCurtis);
+    .value("AdaptiveClenshawCurtis",QuadTypes::AdaptiveClenshawCurtis)
+    .value("GaussLegendre",QuadTypes::GaussLegendre)
+    .value("AdaptiveGaussKronrod",QuadTypes::AdaptiveGaussKronrod);
 
     // SigmoidTypes
     py::enum_<SigmoidTypes>(m, "SigmoidTypes")
@@ -64,6 +67,7 @@ void mpart::binding::MapOptionsWrapper(py::module &m)
     .def_readwrite("quadPts", &MapOptions::quadPts)
     .def_readwrite("contDeriv", &MapOptions::contDeriv)
     .def_readwrite("nugget", &MapOptions::nugget)
+    .def_readwrite("fixedDimWorker", &MapOptions::fixedDimWorker)
     #if defined(MPART_HAS_CEREAL)
     .def("Serialize", [](MapOptions const &opts, std::string const &filename){
         std::ofstream os (filename);
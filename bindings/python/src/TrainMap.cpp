@@ -25,6 +25,13 @@ void mpart::binding::TrainOptionsWrapper(py::module &m)
     .def_readwrite("opt_xtol_abs", &TrainOptions::opt_xtol_abs)
     .def_readwrite("opt_maxeval", &TrainOptions::opt_maxeval)
     .def_readwrite("opt_maxtime", &TrainOptions::opt_maxtime)
+    .def_readwrite("opt_batch_size", &TrainOptions::opt_batch_size)
+    .def_readwrite("opt_epochs", &TrainOptions::opt_epochs)
+    .def_readwrite("opt_learning_rate", &TrainOptions::opt_learning_rate)
+    .def_readwrite("opt_lr_decay", &TrainOptions::opt_lr_decay)
+    .def_readwrite("opt_beta1", &TrainOptions::opt_beta1)
+    .def_readwrite("opt_beta2", &TrainOptions::opt_beta2)
+    .def_readwrite("opt_seed", &TrainOptions::opt_seed)
     .def_readwrite("verbose", &TrainOptions::verbose)
     ;
 }
@@ -35,7 +42,13 @@ void mpart::binding::TrainMapWrapper(py::module &m) {
     std::string tName = "TrainMap";
     if(!std::is_same<MemorySpace,Kokkos::HostSpace>::value) tName = "d" + tName;
 
-    m.def(tName.c_str(), &TrainMap<Kokkos::HostSpace>)
+    m.def(tName.c_str(), &TrainMap<Kokkos::HostSpace>, ReleaseGIL())
+    ;
+
+    std::string tCompName = "TrainMapComponentwise";
+    if(!std::is_same<MemorySpace,Kokkos::HostSpace>::value) tCompName = "d" + tCompName;
+
+    m.def(tCompName.c_str(), &TrainMapComponentwise<Kokkos::HostSpace>, py::arg("map"), py::arg("objective"), py::arg("options"), ReleaseGIL())
     ;
 }
 
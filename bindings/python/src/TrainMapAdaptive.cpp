@@ -53,7 +53,7 @@ void mpart::binding::TrainMapAdaptiveWrapper(py::module &m) {
     std::string tName = "TrainMapAdaptive";
     if(!std::is_same<MemorySpace,Kokkos::HostSpace>::value) tName = "d" + tName;
 
-    m.def(tName.c_str(), &TrainMapAdaptiveSmartPointerPython<MemorySpace>);
+    m.def(tName.c_str(), &TrainMapAdaptiveSmartPointerPython<MemorySpace>, ReleaseGIL());
 }
 
 template void mpart::binding::TrainMapAdaptiveWrapper<Kokkos::HostSpace>(py::module&);
@@ -40,3 +40,23 @@ def test_Inverse():
     x_ = component.Inverse(np.zeros((1,num_samples)),y)
     assert np.allclose(x_, x[-1,:], atol=1E-3)
 
+
+def test_ThreadedEvaluate():
+    # The GIL is released during evaluation, but a dispatch lock makes calls from several threads run one at a time
+    from concurrent.futures import ThreadPoolExecutor
+
+    coeffs = np.random.randn(component.numCoeffs)
+    component.SetCoeffs(coeffs)
+
+    # Non-contiguous inputs are copied by the bindings before the GIL is released
+    x_strided = np.random.randn(1,2*num_samples)[:,::2]
+    y = component.Evaluate(x_strided)
+    logdet = component.LogDeterminant(x_strided)
+
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        evals = list(pool.map(lambda _: component.Evaluate(x_strided), range(8)))
+        logdets = list(pool.map(lambda _: component.LogDeterminant(x_strided), range(8)))
+
+    for y_thread, logdet_thread in zip(evals, logdets):
+        assert np.allclose(y_thread, y)
+        assert np.allclose(logdet_thread, logdet)
@@ -178,6 +178,20 @@ void AffineMap<MemorySpace>::LogDeterminantInputGradImpl(StridedMatrix<const dou
     return;
 }
 
+template<typename MemorySpace>
+void AffineMap<MemorySpace>::ForwardPassImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                                             StridedMatrix<const double, MemorySpace> const& sens,
+                                             StridedMatrix<double, MemorySpace>              evals,
+                                             StridedVector<double, MemorySpace>              logDets,
+                                             StridedMatrix<double, MemorySpace>              coeffGrad)
+{
+    if(evals.size()>0)
+        EvaluateImpl(pts, evals);
+
+    if(logDets.size()>0)
+        Kokkos::deep_copy(logDets, logDet_);
+}
+
 template<typename MemorySpace>
 void AffineMap<MemorySpace>::GradientImpl(StridedMatrix<const double, MemorySpace> const& pts,
                                           StridedMatrix<const double, MemorySpace> const& sens,
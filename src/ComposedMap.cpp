@@ -3,6 +3,7 @@
 #include "MParT/Utilities/Miscellaneous.h"
 #include "MParT/Utilities/LinearAlgebra.h"
 
+#include <algorithm>
 #include <numeric>
 
 using namespace mpart;
@@ -109,6 +110,7 @@ Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> ComposedMap<MemorySpace>
         // Compute the input by reevaluating from the last checkpoint
         int i = checkpointLayers_.back();
         maps_.at(i)->EvaluateImpl(checkpoints_.back(), workspace1_);
+        ++numLayerEvals_;
         ++i;
         for(; i<layerInd; ++i){
 
@@ -118,11 +120,13 @@ Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> ComposedMap<MemorySpace>
                 Kokkos::deep_copy(checkpoints_.back(),workspace1_);
 
                 checkpointLayers_.push_back(i);
+                peakCheckpoints_ = std::max<unsigned int>(peakCheckpoints_, checkpoints_.size());
 
                 nextCheckLayer = GetNextCheckpoint(layerInd);
             }
 
             maps_.at(i)->EvaluateImpl(workspace1_, workspace2_);
+            ++numLayerEvals_;
             simple_swap(workspace1_,workspace2_);
         }
 
@@ -130,6 +134,50 @@ Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> ComposedMap<MemorySpace>
     }
 }
 
+template<typename MemorySpace>
+typename ComposedMap<MemorySpace>::CheckpointReport ComposedMap<MemorySpace>::Checkpointer::Report() const
+{
+    CheckpointReport report;
+    report.maxCheckpoints = maxSaves_;
+    report.peakCheckpoints = peakCheckpoints_;
+    report.numLayerEvals = numLayerEvals_;
+    report.bytesPerCheckpoint = workspace1_.extent(0)*workspace1_.extent(1)*sizeof(double);
+    report.peakBytes = (peakCheckpoints_+2)*report.bytesPerCheckpoint;
+    return report;
+}
+
+template<typename MemorySpace>
+typename ComposedMap<MemorySpace>::CheckpointReport ComposedMap<MemorySpace>::LastCheckpointReport() const
+{
+    std::lock_guard<std::mutex> lock(reportMutex_);
+    return lastReport_;
+}
+
+template<typename MemorySpace>
+void ComposedMap<MemorySpace>::StoreReport(CheckpointReport const& report)
+{
+    std::lock_guard<std::mutex> lock(reportMutex_);
+    lastReport_ = report;
+}
+
+template<typename MemorySpace>
+unsigned int ComposedMap<MemorySpace>::NumCheckpoints(unsigned int numPts) const
+{
+    if(maxCheckBytes_==0)
+        return maxChecks_;
+
+    // Each checkpoint and each of the two work arrays stores one layer input
+    const std::size_t stateBytes = std::size_t(this->inputDim)*numPts*sizeof(double);
+    if(stateBytes==0)
+        return maps_.size();
+
+    const std::size_t numStates = maxCheckBytes_ / stateBytes;
+    if(numStates<3)
+        return 1;
+
+    return std::min<std::size_t>(numStates-2, maps_.size());
+}
+
 
 template<typename MemorySpace>
 ComposedMap<MemorySpace>::ComposedMap(std::vector<std::shared_ptr<ConditionalMapBase<MemorySpace>>> const& maps, bool moveCoeffs,
@@ -298,7 +346,7 @@ void ComposedMap<MemorySpace>::GradientImpl(StridedMatrix<const double, MemorySp
     Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace>  intSens2("intermediate Sens", sens.extent(0), sens.extent(1));
     Kokkos::deep_copy(intSens1,sens);
 
-    Checkpointer checker(maxChecks_, pts, maps_);
+    Checkpointer checker(NumCheckpoints(pts.extent(1)), pts, maps_);
 
     for(int i = maps_.size() - 1; i>=0; --i){
 
@@ -311,6 +359,7 @@ void ComposedMap<MemorySpace>::GradientImpl(StridedMatrix<const double, MemorySp
     }
 
     Kokkos::deep_copy(output, intSens1);
+    StoreReport(checker.Report());
 }
 
 
@@ -350,7 +399,7 @@ void ComposedMap<MemorySpace>::CoeffGradImpl(StridedMatrix<const double, MemoryS
     Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace>  intSens2("intermediate sens 2", sens.extent(0), sens.extent(1));
     Kokkos::deep_copy(intSens1, sens);
 
-    Checkpointer checker(maxChecks_, pts, maps_);
+    Checkpointer checker(NumCheckpoints(pts.extent(1)), pts, maps_);
 
     StridedMatrix<double, MemorySpace> subOut;
     int endParamDim = this->numCoeffs;
@@ -377,6 +426,7 @@ void ComposedMap<MemorySpace>::CoeffGradImpl(StridedMatrix<const double, MemoryS
         endParamDim -= maps_.at(i)->numCoeffs;
     }
 
+    StoreReport(checker.Report());
 }
 
 
@@ -391,7 +441,7 @@ void ComposedMap<MemorySpace>::LogDeterminantCoeffGradImpl(StridedMatrix<const d
 
 
     // Get the gradient of the log determinant contribution from the last component
-    Checkpointer checker(maxChecks_, pts, maps_);
+    Checkpointer checker(NumCheckpoints(pts.extent(1)), pts, maps_);
     auto input = checker.GetLayerInput(maps_.size()-1);
 
     int endParamDim = this->numCoeffs;
@@ -434,6 +484,8 @@ void ComposedMap<MemorySpace>::LogDeterminantCoeffGradImpl(StridedMatrix<const d
         }
         endParamDim -= maps_.at(i)->numCoeffs;
     }
+
+    StoreReport(checker.Report());
 }
 
 
@@ -446,7 +498,7 @@ void ComposedMap<MemorySpace>::LogDeterminantInputGradImpl(StridedMatrix<const d
     Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace>  intSens2("intermediate Sens", pts.extent(0), pts.extent(1));
 
     // Get the gradient of the log determinant contribution from the last component
-    Checkpointer checker(maxChecks_, pts, maps_);
+    Checkpointer checker(NumCheckpoints(pts.extent(1)), pts, maps_);
     auto input = checker.GetLayerInput(maps_.size()-1);
 
     maps_.back()->LogDeterminantInputGradImpl(input, intSens1);
@@ -465,6 +517,88 @@ void ComposedMap<MemorySpace>::LogDeterminantInputGradImpl(StridedMatrix<const d
     }
 
     Kokkos::deep_copy(output, intSens1);
+    StoreReport(checker.Report());
+}
+
+template<typename MemorySpace>
+void ComposedMap<MemorySpace>::ForwardPassImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                                               StridedMatrix<const double, MemorySpace> const& sens,
+                                               StridedMatrix<double, MemorySpace>              evals,
+                                               StridedVector<double, MemorySpace>              logDets,
+                                               StridedMatrix<double, MemorySpace>              coeffGrad)
+{
+    const bool computeEvals = (evals.size()>0);
+    const bool computeDets = (logDets.size()>0);
+    const bool computeGrad = (coeffGrad.size()>0);
+
+    // Forward sweep: x_{i+1} = T_i(x_i) and the log determinant of T_i are computed together for each layer
+    if(computeEvals || computeDets){
+        Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace>  intPts1("intermediate points 1", pts.extent(0), pts.extent(1));
+        Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace>  intPts2("intermediate points 2", pts.extent(0), pts.extent(1));
+
+        Kokkos::View<double*, Kokkos::LayoutLeft, MemorySpace> compDetIncrement;
+        if(computeDets && (maps_.size()>1))
+            compDetIncrement = Kokkos::View<double*, Kokkos::LayoutLeft, MemorySpace>("Log Determinant", logDets.extent(0));
+
+        StridedMatrix<const double, MemorySpace> input = pts;
+        for(unsigned int i=0; i<maps_.size(); ++i){
+
+            // Only the output of the last layer is skipped when it is not requested
+            StridedMatrix<double, MemorySpace> layerOut;
+            if(i+1<maps_.size()){
+                layerOut = (i%2==0) ? intPts1 : intPts2;
+            }else if(computeEvals){
+                layerOut = evals;
+            }
+
+            StridedVector<double, MemorySpace> layerDet;
+            if(computeDets)
+                layerDet = (i==0) ? logDets : StridedVector<double, MemorySpace>(compDetIncrement);
+
+            maps_.at(i)->ForwardPassImpl(input, StridedMatrix<const double, MemorySpace>(), layerOut, layerDet, StridedMatrix<double, MemorySpace>());
+
+            if(computeDets && (i>0))
+                logDets += compDetIncrement;
+
+            input = layerOut;
+        }
+    }
+
+    // Backward sweep: the sensitivity s_i of layer i combines the sensitivity of the output with the input gradients of the
+    // log determinants of later layers, so each layer needs a single call for s_i^T \nabla_{w_i} T_i + \nabla_{w_i} \log\det T_i
+    if(computeGrad){
+        Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace>  intSens1("intermediate sens 1", sens.extent(0), sens.extent(1));
+        Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace>  intSens2("intermediate sens 2", sens.extent(0), sens.extent(1));
+        Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace>  detSens("log determinant sens", sens.extent(0), sens.extent(1));
+        Kokkos::deep_copy(intSens1, sens);
+
+        Checkpointer checker(NumCheckpoints(pts.extent(1)), pts, maps_);
+
+        int endParamDim = this->numCoeffs;
+        for(int i = maps_.size() - 1; i>=0; --i){
+
+            auto input = checker.GetLayerInput(i);
+
+            StridedMatrix<double, MemorySpace> subOut;
+            if(maps_.at(i)->numCoeffs>0)
+                subOut = Kokkos::subview(coeffGrad, std::make_pair(int(endParamDim-maps_.at(i)->numCoeffs), endParamDim), Kokkos::ALL());
+
+            maps_.at(i)->ForwardPassImpl(input, intSens1, StridedMatrix<double, MemorySpace>(), StridedVector<double, MemorySpace>(), subOut);
+
+            //s_{i-1}^T = s_{i}^T J_i(x*) + \nabla_x \log\det T_i(x*)
+            if(i>0){
+                maps_.at(i)->GradientImpl(input, intSens1, intSens2);
+                simple_swap<decltype(intSens1)>(intSens1, intSens2);
+
+                Kokkos::deep_copy(detSens, 0.0);
+                maps_.at(i)->LogDeterminantInputGradImpl(input, detSens);
+                intSens1 += detSens;
+            }
+            endParamDim -= maps_.at(i)->numCoeffs;
+        }
+
+        StoreReport(checker.Report());
+    }
 }
 
 // Explicit template instantiation
@@ -1,6 +1,7 @@
 #include "MParT/ConditionalMapBase.h"
 #include "MParT/Utilities/ArrayConversions.h"
 #include "MParT/Utilities/Miscellaneous.h"
+#include "MParT/Utilities/LinearAlgebra.h"
 
 using namespace mpart;
 
@@ -10,7 +11,7 @@ Kokkos::View<double*, Kokkos::HostSpace> ConditionalMapBase<Kokkos::HostSpace>::
 {
     this->CheckCoefficients("LogDeterminant");
     Kokkos::View<double*, Kokkos::HostSpace> output("Log Determinants", pts.extent(1));
-    LogDeterminantImpl(pts, output);
+    LogDeterminantChunked(pts, output);
     return output;
 }
 
@@ -33,7 +34,7 @@ Kokkos::View<double*, mpart::DeviceSpace> ConditionalMapBase<mpart::DeviceSpace>
 {
     this->CheckCoefficients("LogDeterminant");
     Kokkos::View<double*, mpart::DeviceSpace> output("Log Determinants", pts.extent(1));
-    LogDeterminantImpl(pts, output);
+    LogDeterminantChunked(pts, output);
     return output;
 }
 
@@ -76,7 +77,7 @@ StridedMatrix<double, Kokkos::HostSpace> ConditionalMapBase<Kokkos::HostSpace>::
     }
 
     Kokkos::View<double**, Kokkos::HostSpace> output("Map Inverse Evaluations", this->outputDim, r.extent(1));
-    InverseImpl(x1,r, output);
+    InverseChunked(x1,r, output);
     return output;
 }
 
@@ -108,7 +109,7 @@ StridedMatrix<double, mpart::DeviceSpace> ConditionalMapBase<mpart::DeviceSpace>
     }
 
     Kokkos::View<double**, mpart::DeviceSpace> output("Map Inverse Evaluations", this->outputDim, r.extent(1));
-    InverseImpl(x1,r, output);
+    InverseChunked(x1,r, output);
     return output;
 }
 
@@ -146,7 +147,7 @@ StridedMatrix<double, Kokkos::HostSpace> ConditionalMapBase<Kokkos::HostSpace>::
 {
     this->CheckCoefficients("LogDeterminantCoeffGrad");
     Kokkos::View<double**, Kokkos::HostSpace> output("LogDeterminantCoeffGrad", this->numCoeffs, pts.extent(1));
-    LogDeterminantCoeffGradImpl(pts,output);
+    LogDeterminantCoeffGradChunked(pts,output);
     return output;
 }
 
@@ -169,7 +170,7 @@ StridedMatrix<double, mpart::DeviceSpace> ConditionalMapBase<mpart::DeviceSpace>
 {
     this->CheckCoefficients("LogDeterminantCoeffGrad");
     Kokkos::View<double**, mpart::DeviceSpace> output("LogDeterminantCoeffGrad", this->numCoeffs, pts.extent(1));
-    LogDeterminantCoeffGradImpl(pts,output);
+    LogDeterminantCoeffGradChunked(pts,output);
     return output;
 }
 
@@ -223,7 +224,7 @@ StridedMatrix<double, Kokkos::HostSpace> ConditionalMapBase<Kokkos::HostSpace>::
     this->CheckCoefficients("LogDeterminantInputGrad");
 
     Kokkos::View<double**, Kokkos::HostSpace> output("LogDeterminantInputGrad", pts.extent(0), pts.extent(1));
-    LogDeterminantInputGradImpl(pts, output);
+    LogDeterminantInputGradChunked(pts, output);
     return output;
 }
 
@@ -246,7 +247,7 @@ StridedMatrix<double, mpart::DeviceSpace> ConditionalMapBase<mpart::DeviceSpace>
 {
     this->CheckCoefficients("LogDeterminantInputGrad");
     Kokkos::View<double**, mpart::DeviceSpace> output("LogDeterminantInputGrad", pts.extent(0), pts.extent(1));
-    LogDeterminantInputGradImpl(pts,output);
+    LogDeterminantInputGradChunked(pts,output);
     return output;
 }
 
@@ -292,6 +293,175 @@ Eigen::RowMatrixXd ConditionalMapBase<mpart::DeviceSpace>::LogDeterminantInputGr
 
 #endif
 
+template<typename MemorySpace>
+StridedMatrix<double, MemorySpace> ConditionalMapBase<MemorySpace>::Inverse(StridedMatrix<const double, MemorySpace> const& x1,
+                                                                            StridedMatrix<const double, MemorySpace> const& r,
+                                                                            StridedMatrix<const double, MemorySpace> const& x2Guess,
+                                                                            StridedMatrix<double, MemorySpace>              bracketWidths)
+{
+    this->CheckCoefficients("Inverse");
+
+    if(x1.extent(1)!=r.extent(1)){
+        std::stringstream msg;
+        msg << "x1 and r have different numbers of columns.  x1.extent(1)=" << x1.extent(1) << ", but r.extent(1)=" << r.extent(1);
+        throw std::invalid_argument(msg.str());
+    }
+    if((x2Guess.extent(0)!=this->outputDim)||(x2Guess.extent(1)!=r.extent(1))){
+        std::stringstream msg;
+        msg << "The initial guess has size " << x2Guess.extent(0) << "x" << x2Guess.extent(1) << ", but expected size " << this->outputDim << "x" << r.extent(1) << ".";
+        throw std::invalid_argument(msg.str());
+    }
+    if((bracketWidths.size()>0)&&((bracketWidths.extent(0)!=this->outputDim)||(bracketWidths.extent(1)!=r.extent(1)))){
+        std::stringstream msg;
+        msg << "The bracket widths have size " << bracketWidths.extent(0) << "x" << bracketWidths.extent(1) << ", but expected size " << this->outputDim << "x" << r.extent(1) << ".";
+        throw std::invalid_argument(msg.str());
+    }
+
+    Kokkos::View<double**, MemorySpace> output("Map Inverse Evaluations", this->outputDim, r.extent(1));
+    InverseWithGuessChunked(x1, r, x2Guess, bracketWidths, output);
+    return output;
+}
+
+template<typename MemorySpace>
+void ConditionalMapBase<MemorySpace>::InverseWithGuessImpl(StridedMatrix<const double, MemorySpace> const& x1,
+                                                           StridedMatrix<const double, MemorySpace> const& r,
+                                                           StridedMatrix<const double, MemorySpace> const& x2Guess,
+                                                           StridedMatrix<double, MemorySpace>              bracketWidths,
+                                                           StridedMatrix<double, MemorySpace>              output)
+{
+    // Place the initial guess in the rows of the input corresponding to the output
+    const unsigned int extraInputs = this->inputDim - this->outputDim;
+    Kokkos::View<double**, MemorySpace> fullX("Inverse Initial Guess", this->inputDim, x1.extent(1));
+    Kokkos::deep_copy(Kokkos::subview(fullX, std::make_pair(0u, extraInputs), Kokkos::ALL()), Kokkos::subview(x1, std::make_pair(0u, extraInputs), Kokkos::ALL()));
+    Kokkos::deep_copy(Kokkos::subview(fullX, std::make_pair(extraInputs, this->inputDim), Kokkos::ALL()), x2Guess);
+
+    InverseImpl(fullX, r, output);
+}
+
+template<typename MemorySpace>
+void ConditionalMapBase<MemorySpace>::FillSharedBasis(StridedMatrix<const double, MemorySpace> const& pts,
+                                                      Kokkos::View<const unsigned int*, MemorySpace> const& rowStarts,
+                                                      Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> vals) const
+{
+    throw std::runtime_error("ConditionalMapBase::FillSharedBasis: This map does not support shared basis evaluations.");
+}
+
+template<typename MemorySpace>
+void ConditionalMapBase<MemorySpace>::EvaluateSharedImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                                                         SharedBasisTable<MemorySpace>            const& basis,
+                                                         StridedMatrix<double, MemorySpace>              output)
+{
+    this->EvaluateImpl(pts, output);
+}
+
+template<typename MemorySpace>
+void ConditionalMapBase<MemorySpace>::LogDeterminantSharedImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                                                               SharedBasisTable<MemorySpace>            const& basis,
+                                                               StridedVector<double, MemorySpace>              output)
+{
+    LogDeterminantImpl(pts, output);
+}
+
+template<typename MemorySpace>
+void ConditionalMapBase<MemorySpace>::CoeffGradSharedImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                                                          StridedMatrix<const double, MemorySpace> const& sens,
+                                                          SharedBasisTable<MemorySpace>            const& basis,
+                                                          StridedMatrix<double, MemorySpace>              output)
+{
+    this->CoeffGradImpl(pts, sens, output);
+}
+
+template<typename MemorySpace>
+void ConditionalMapBase<MemorySpace>::ForwardPassImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                                                      StridedMatrix<const double, MemorySpace> const& sens,
+                                                      StridedMatrix<double, MemorySpace>              evals,
+                                                      StridedVector<double, MemorySpace>              logDets,
+                                                      StridedMatrix<double, MemorySpace>              coeffGrad)
+{
+    if(evals.size()>0)
+        this->EvaluateImpl(pts, evals);
+
+    if(logDets.size()>0)
+        LogDeterminantImpl(pts, logDets);
+
+    if(coeffGrad.size()>0){
+        this->CoeffGradImpl(pts, sens, coeffGrad);
+
+        Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> detGrad("Log Determinant Coefficient Gradient", coeffGrad.extent(0), coeffGrad.extent(1));
+        LogDeterminantCoeffGradImpl(pts, detGrad);
+        coeffGrad += detGrad;
+    }
+}
+
+template<typename MemorySpace>
+void ConditionalMapBase<MemorySpace>::ForwardPassSharedImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                                                            SharedBasisTable<MemorySpace>            const& basis,
+                                                            StridedMatrix<const double, MemorySpace> const& sens,
+                                                            StridedMatrix<double, MemorySpace>              evals,
+                                                            StridedVector<double, MemorySpace>              logDets,
+                                                            StridedMatrix<double, MemorySpace>              coeffGrad)
+{
+    ForwardPassImpl(pts, sens, evals, logDets, coeffGrad);
+}
+
+template<typename MemorySpace>
+void ConditionalMapBase<MemorySpace>::LogDeterminantChunked(StridedMatrix<const double, MemorySpace> const& pts,
+                                                            StridedVector<double, MemorySpace>              output)
+{
+    this->ForEachChunk(pts.extent(1), [&](std::pair<unsigned int, unsigned int> cols){
+        LogDeterminantImpl(Kokkos::subview(pts, Kokkos::ALL(), cols), Kokkos::subview(output, cols));
+    });
+}
+
+template<typename MemorySpace>
+void ConditionalMapBase<MemorySpace>::InverseChunked(StridedMatrix<const double, MemorySpace> const& x1,
+                                                     StridedMatrix<const double, MemorySpace> const& r,
+                                                     StridedMatrix<double, MemorySpace>              output)
+{
+    this->ForEachChunk(r.extent(1), [&](std::pair<unsigned int, unsigned int> cols){
+        InverseImpl(Kokkos::subview(x1, Kokkos::ALL(), cols), Kokkos::subview(r, Kokkos::ALL(), cols), Kokkos::subview(output, Kokkos::ALL(), cols));
+    });
+}
+
+template<typename MemorySpace>
+void ConditionalMapBase<MemorySpace>::InverseWithGuessChunked(StridedMatrix<const double, MemorySpace> const& x1,
+                                                              StridedMatrix<const double, MemorySpace> const& r,
+                                                              StridedMatrix<const double, MemorySpace> const& x2Guess,
+                                                              StridedMatrix<double, MemorySpace>              bracketWidths,
+                                                              StridedMatrix<double, MemorySpace>              output)
+{
+    this->ForEachChunk(r.extent(1), [&](std::pair<unsigned int, unsigned int> cols){
+        // An empty bracketWidths view means the default step is used for every point
+        StridedMatrix<double, MemorySpace> widthChunk = bracketWidths;
+        if(bracketWidths.size()>0)
+            widthChunk = Kokkos::subview(bracketWidths, Kokkos::ALL(), cols);
+
+        InverseWithGuessImpl(Kokkos::subview(x1, Kokkos::ALL(), cols),
+                             Kokkos::subview(r, Kokkos::ALL(), cols),
+                             Kokkos::subview(x2Guess, Kokkos::ALL(), cols),
+                             widthChunk,
+                             Kokkos::subview(output, Kokkos::ALL(), cols));
+    });
+}
+
+template<typename MemorySpace>
+void ConditionalMapBase<MemorySpace>::LogDeterminantCoeffGradChunked(StridedMatrix<const double, MemorySpace> const& pts,
+                                                                     StridedMatrix<double, MemorySpace>              output)
+{
+    this->ForEachChunk(pts.extent(1), [&](std::pair<unsigned int, unsigned int> cols){
+        LogDeterminantCoeffGradImpl(Kokkos::subview(pts, Kokkos::ALL(), cols), Kokkos::subview(output, Kokkos::ALL(), cols));
+    });
+}
+
+template<typename MemorySpace>
+void ConditionalMapBase<MemorySpace>::LogDeterminantInputGradChunked(StridedMatrix<const double, MemorySpace> const& pts,
+                                                                     StridedMatrix<double, MemorySpace>              output)
+{
+    this->ForEachChunk(pts.extent(1), [&](std::pair<unsigned int, unsigned int> cols){
+        LogDeterminantInputGradImpl(Kokkos::subview(pts, Kokkos::ALL(), cols), Kokkos::subview(output, Kokkos::ALL(), cols));
+    });
+}
+
 // Explicit template instantiation
 template class mpart::ConditionalMapBase<Kokkos::HostSpace>;
 #if defined(MPART_ENABLE_GPU)
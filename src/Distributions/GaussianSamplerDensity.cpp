@@ -79,6 +79,45 @@ void GaussianSamplerDensity<MemorySpace>::LogDensityInputGradImpl(StridedMatrix<
 }
 
 
+template<typename MemorySpace>
+void GaussianSamplerDensity<MemorySpace>::SetSeed(unsigned int seed) {
+    SampleGenerator<MemorySpace>::SetSeed(seed);
+    sampleCounter_ = 0;
+}
+
+template<typename MemorySpace>
+void GaussianSamplerDensity<MemorySpace>::SampleStandardNormal(StridedMatrix<double, MemorySpace> output) {
+    int M = output.extent(0);
+    int N = output.extent(1);
+
+    if(rngType_ == RNGTypes::Counter) {
+        // Each thread computes the pair of dimensions (2p, 2p+1) of sample j from the counter (sampleCounter_+j, p)
+        const uint64_t seed = seed_;
+        const uint64_t firstSample = sampleCounter_;
+        const int numPairs = (M+1)/2;
+        Kokkos::MDRangePolicy<Kokkos::Rank<2>, typename MemoryToExecution<MemorySpace>::Space> policy({{0, 0}}, {{N, numPairs}});
+        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int j, const int p) {
+            double z0, z1;
+            Philox4x32::NormalPair(seed, firstSample + j, p, z0, z1);
+            output(2*p,j) = z0;
+            if(2*p+1 < M)
+                output(2*p+1,j) = z1;
+        });
+        sampleCounter_ += N;
+    }
+    else {
+        // Acquire one generator from the pool for each sample instead of each entry
+        auto pool = rand_pool;
+        Kokkos::RangePolicy<typename MemoryToExecution<MemorySpace>::Space> policy(0, N);
+        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int j) {
+            GeneratorType rgen = pool.get_state();
+            for(int i=0; i<M; ++i)
+                output(i,j) = rgen.normal();
+            pool.free_state(rgen);
+        });
+    }
+}
+
 // Currently this requires that output be a LayoutLeft view
 template<typename MemorySpace>
 void GaussianSamplerDensity<MemorySpace>::SampleImpl(StridedMatrix<double, MemorySpace> output_) {
@@ -92,20 +131,11 @@ void GaussianSamplerDensity<MemorySpace>::SampleImpl(StridedMatrix<double, Memor
     Kokkos::MDRangePolicy<Kokkos::Rank<2>, typename MemoryToExecution<MemorySpace>::Space> policy({{0, 0}}, {{N, M}});
     // If the covariance is the identity, we can just sample from a shifted normal
     if(idCov_) {
-        // If dim_ is 0, the distribution is the standard normal
-        if(mean_.extent(0) == 0) {
-            Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int j, const int i) {
-                GeneratorType rgen = rand_pool.get_state();
-                output_(i,j) = rgen.normal();
-                rand_pool.free_state(rgen);
-            });
-        }
-        // Otherwise, we sample from the mean-shifted normal
-        else {
+        SampleStandardNormal(output_);
+        // If the mean is nonzero, we shift the standard normal samples
+        if(mean_.extent(0) != 0) {
             Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int j, const int i) {
-                GeneratorType rgen = rand_pool.get_state();
-                output_(i,j) = rgen.normal() + mean_(i);
-                rand_pool.free_state(rgen);
+                output_(i,j) += mean_(i);
             });
         }
     }
@@ -114,11 +144,7 @@ void GaussianSamplerDensity<MemorySpace>::SampleImpl(StridedMatrix<double, Memor
         // Enforce that the output is the correct layout!
         Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> output = output_;
         // Sample from the standard normal
-        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int j, const int i) {
-            GeneratorType rgen = rand_pool.get_state();
-            output(i,j) = rgen.normal();
-            rand_pool.free_state(rgen);
-        });
+        SampleStandardNormal(output);
         // Transform by the Cholesky factor
         auto mul = covChol_.multiplyL(output);
         // Add the mean (if nonzero)
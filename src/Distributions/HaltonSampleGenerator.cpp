@@ -0,0 +1,111 @@
+#include "MParT/Distributions/HaltonSampleGenerator.h"
+#include "MParT/Utilities/CounterRNG.h"
+#include "MParT/Utilities/MathFunctions.h"
+
+#include <sstream>
+
+using namespace mpart;
+
+template<typename MemorySpace>
+HaltonSampleGenerator<MemorySpace>::HaltonSampleGenerator(unsigned int dim, bool gaussian, bool scramble, unsigned int seed) :
+    SampleGenerator<MemorySpace>(dim, seed), gaussian_(gaussian), scramble_(scramble)
+{
+    if(dim==0){
+        throw std::invalid_argument("HaltonSampleGenerator: The dimension must be positive.");
+    }
+
+    Kokkos::View<uint32_t*, Kokkos::HostSpace> hostBases("Halton Bases", dim);
+    Kokkos::View<unsigned int*, Kokkos::HostSpace> hostDigits("Halton Digits", dim);
+
+    // Find the first dim primes and the number of digits needed to resolve intervals of width 2^{-32}
+    uint32_t candidate = 2;
+    for(unsigned int d=0; d<dim; ++d){
+        bool isPrime = false;
+        while(!isPrime){
+            isPrime = true;
+            for(uint32_t f=2; f*f<=candidate; ++f){
+                if(candidate%f==0){
+                    isPrime = false;
+                    break;
+                }
+            }
+            if(!isPrime)
+                ++candidate;
+        }
+        hostBases(d) = candidate;
+
+        unsigned int digits = 0;
+        for(uint64_t power=1; power < (uint64_t(1) << 32); power *= candidate)
+            ++digits;
+        hostDigits(d) = digits;
+
+        ++candidate;
+    }
+
+    bases_ = Kokkos::create_mirror_view(MemorySpace(), hostBases);
+    Kokkos::deep_copy(bases_, hostBases);
+    numDigits_ = Kokkos::create_mirror_view(MemorySpace(), hostDigits);
+    Kokkos::deep_copy(numDigits_, hostDigits);
+}
+
+template<typename MemorySpace>
+void HaltonSampleGenerator<MemorySpace>::SetSeed(unsigned int seed) {
+    SampleGenerator<MemorySpace>::SetSeed(seed);
+    sampleCounter_ = 0;
+}
+
+template<typename MemorySpace>
+void HaltonSampleGenerator<MemorySpace>::SampleImpl(StridedMatrix<double, MemorySpace> output) {
+    int M = output.extent(0);
+    int N = output.extent(1);
+    if(M != dim_) {
+        throw std::runtime_error("HaltonSampleGenerator::SampleImpl: The number of rows in output must match the dimension of the distribution.");
+    }
+
+    const uint64_t firstSample = sampleCounter_;
+    const uint32_t seed = seed_;
+    const bool gaussian = gaussian_;
+    const bool scramble = scramble_;
+    auto bases = bases_;
+    auto numDigits = numDigits_;
+
+    Kokkos::MDRangePolicy<Kokkos::Rank<2>, typename MemoryToExecution<MemorySpace>::Space> policy({{0, 0}}, {{N, M}});
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int j, const int i) {
+        const uint32_t base = bases(i);
+        const double invBase = 1.0 / double(base);
+
+        uint64_t index = firstSample + uint64_t(j);
+
+        // The hash of the more significant digits, which selects the permutation of the next digit
+        uint32_t prefix = HashUInt32(seed ^ HashUInt32(uint32_t(i)+1));
+
+        double u = 0.0;
+        double scale = invBase;
+        for(unsigned int k=0; k<numDigits(i); ++k){
+            uint32_t digit = uint32_t(index % base);
+            index /= base;
+
+            if(scramble){
+                const uint32_t h = HashUInt32(prefix);
+                const uint32_t mult = 1 + h % (base-1);
+                const uint32_t shift = (h >> 16) % base;
+                prefix = HashUInt32(prefix ^ (0x9E3779B9u*(digit+1)));
+                digit = uint32_t((uint64_t(mult)*digit + shift) % base);
+            }
+
+            u += digit*scale;
+            scale *= invBase;
+        }
+        // Use the center of the finest interval
+        u += 0.5*scale*base;
+
+        output(i,j) = gaussian ? InverseNormalCDF(u) : u;
+    });
+
+    sampleCounter_ += N;
+}
+
+template class mpart::HaltonSampleGenerator<Kokkos::HostSpace>;
+#ifdef MPART_ENABLE_GPU
+template class mpart::HaltonSampleGenerator<mpart::DeviceSpace>;
+#endif
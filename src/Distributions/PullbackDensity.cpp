@@ -1,5 +1,7 @@
 #include "MParT/Distributions/PullbackDensity.h"
 
+#include <algorithm>
+
 using namespace mpart;
 
 template<typename MemorySpace>
@@ -10,30 +12,114 @@ PullbackDensity<MemorySpace>::PullbackDensity(std::shared_ptr<ConditionalMapBase
     }
 }
 
+template<typename MemorySpace>
+unsigned int PullbackDensity<MemorySpace>::TileSize(unsigned int numPts) const {
+    const unsigned int chunkSize = map_->ChunkSize();
+    return ((chunkSize==0) || (chunkSize>numPts)) ? numPts : chunkSize;
+}
+
 template<typename MemorySpace>
 void PullbackDensity<MemorySpace>::LogDensityImpl(StridedMatrix<const double, MemorySpace> const &pts, StridedVector<double, MemorySpace> output) {
-    StridedMatrix<double, MemorySpace> mappedPts = map_->Evaluate(pts);
-    density_->LogDensityImpl(mappedPts, output);
-    StridedVector<double, MemorySpace> logJacobian = map_->LogDeterminant(pts);
-    output += logJacobian;
+    const unsigned int numPts = pts.extent(1);
+    const unsigned int tileSize = TileSize(numPts);
+
+    // Scratch space for one tile, reused for every tile
+    Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> mappedTile("Mapped Points", map_->outputDim, tileSize);
+    Kokkos::View<double*, MemorySpace> logJacTile("Log Jacobian", tileSize);
+
+    for(unsigned int start=0; start<numPts; start+=tileSize){
+        auto cols = std::make_pair(start, std::min(start+tileSize, numPts));
+        auto tileCols = std::make_pair(0u, cols.second-cols.first);
+
+        StridedMatrix<const double, MemorySpace> ptsTile = Kokkos::subview(pts, Kokkos::ALL(), cols);
+        StridedMatrix<double, MemorySpace> mappedPts = Kokkos::subview(mappedTile, Kokkos::ALL(), tileCols);
+        StridedVector<double, MemorySpace> outTile = Kokkos::subview(output, cols);
+        StridedVector<double, MemorySpace> logJacobian = Kokkos::subview(logJacTile, tileCols);
+
+        map_->ForwardPassImpl(ptsTile, StridedMatrix<const double, MemorySpace>(), mappedPts, logJacobian, StridedMatrix<double, MemorySpace>());
+        density_->LogDensityImpl(mappedPts, outTile);
+        outTile += logJacobian;
+    }
 }
 
 template<typename MemorySpace>
 void PullbackDensity<MemorySpace>::LogDensityInputGradImpl(StridedMatrix<const double, MemorySpace> const &pts, StridedMatrix<double, MemorySpace> output) {
-    StridedMatrix<const double, MemorySpace> mappedPts = map_->Evaluate(pts);
-    StridedMatrix<double, MemorySpace> sens_map = density_->LogDensityInputGrad(mappedPts);
-    map_->GradientImpl(pts, sens_map, output);
-    StridedMatrix<double, MemorySpace> gradLogJacobian = map_->LogDeterminantInputGrad(pts);
-    output += gradLogJacobian;
+    const unsigned int numPts = pts.extent(1);
+    const unsigned int tileSize = TileSize(numPts);
+
+    Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> mappedTile("Mapped Points", map_->outputDim, tileSize);
+    Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> sensTile("Map Sensitivities", map_->outputDim, tileSize);
+    Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> gradTile("Log Jacobian Gradient", map_->inputDim, tileSize);
+
+    for(unsigned int start=0; start<numPts; start+=tileSize){
+        auto cols = std::make_pair(start, std::min(start+tileSize, numPts));
+        auto tileCols = std::make_pair(0u, cols.second-cols.first);
+
+        StridedMatrix<const double, MemorySpace> ptsTile = Kokkos::subview(pts, Kokkos::ALL(), cols);
+        StridedMatrix<double, MemorySpace> mappedPts = Kokkos::subview(mappedTile, Kokkos::ALL(), tileCols);
+        StridedMatrix<double, MemorySpace> sens_map = Kokkos::subview(sensTile, Kokkos::ALL(), tileCols);
+        StridedMatrix<double, MemorySpace> gradLogJacobian = Kokkos::subview(gradTile, Kokkos::ALL(), tileCols);
+        StridedMatrix<double, MemorySpace> outTile = Kokkos::subview(output, Kokkos::ALL(), cols);
+
+        map_->EvaluateImpl(ptsTile, mappedPts);
+        density_->LogDensityInputGradImpl(mappedPts, sens_map);
+        map_->GradientImpl(ptsTile, sens_map, outTile);
+        map_->LogDeterminantInputGradImpl(ptsTile, gradLogJacobian);
+        outTile += gradLogJacobian;
+    }
 }
 
 template<typename MemorySpace>
 void PullbackDensity<MemorySpace>::LogDensityCoeffGradImpl(StridedMatrix<const double, MemorySpace> const &pts, StridedMatrix<double, MemorySpace> output) {
-    StridedMatrix<const double, MemorySpace> mappedPts = map_->Evaluate(pts);
-    StridedMatrix<double, MemorySpace> sens_map = density_->LogDensityInputGrad(mappedPts);
-    map_->CoeffGradImpl(pts, sens_map, output);
-    StridedMatrix<double, MemorySpace> gradLogJacobian = map_->LogDeterminantCoeffGrad(pts);
-    output += gradLogJacobian;
+    const unsigned int numPts = pts.extent(1);
+    const unsigned int tileSize = TileSize(numPts);
+
+    Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> mappedTile("Mapped Points", map_->outputDim, tileSize);
+    Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> sensTile("Map Sensitivities", map_->outputDim, tileSize);
+
+    for(unsigned int start=0; start<numPts; start+=tileSize){
+        auto cols = std::make_pair(start, std::min(start+tileSize, numPts));
+        auto tileCols = std::make_pair(0u, cols.second-cols.first);
+
+        StridedMatrix<const double, MemorySpace> ptsTile = Kokkos::subview(pts, Kokkos::ALL(), cols);
+        StridedMatrix<double, MemorySpace> mappedPts = Kokkos::subview(mappedTile, Kokkos::ALL(), tileCols);
+        StridedMatrix<double, MemorySpace> sens_map = Kokkos::subview(sensTile, Kokkos::ALL(), tileCols);
+        StridedMatrix<double, MemorySpace> outTile = Kokkos::subview(output, Kokkos::ALL(), cols);
+
+        // The gradient of the log determinant is computed together with the gradient of the map output
+        map_->EvaluateImpl(ptsTile, mappedPts);
+        density_->LogDensityInputGradImpl(mappedPts, sens_map);
+        map_->ForwardPassImpl(ptsTile, sens_map, StridedMatrix<double, MemorySpace>(), StridedVector<double, MemorySpace>(), outTile);
+    }
+}
+
+template<typename MemorySpace>
+void PullbackDensity<MemorySpace>::LogDensityAndCoeffGradImpl(StridedMatrix<const double, MemorySpace> const &pts, StridedVector<double, MemorySpace> logDensity, StridedMatrix<double, MemorySpace> coeffGrad) {
+    const unsigned int numPts = pts.extent(1);
+    const unsigned int tileSize = TileSize(numPts);
+
+    Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> mappedTile("Mapped Points", map_->outputDim, tileSize);
+    Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> sensTile("Map Sensitivities", map_->outputDim, tileSize);
+    Kokkos::View<double*, MemorySpace> logJacTile("Log Jacobian", tileSize);
+
+    for(unsigned int start=0; start<numPts; start+=tileSize){
+        auto cols = std::make_pair(start, std::min(start+tileSize, numPts));
+        auto tileCols = std::make_pair(0u, cols.second-cols.first);
+
+        StridedMatrix<const double, MemorySpace> ptsTile = Kokkos::subview(pts, Kokkos::ALL(), cols);
+        StridedMatrix<double, MemorySpace> mappedPts = Kokkos::subview(mappedTile, Kokkos::ALL(), tileCols);
+        StridedMatrix<double, MemorySpace> sens_map = Kokkos::subview(sensTile, Kokkos::ALL(), tileCols);
+        StridedVector<double, MemorySpace> logJacobian = Kokkos::subview(logJacTile, tileCols);
+        StridedVector<double, MemorySpace> densTile = Kokkos::subview(logDensity, cols);
+        StridedMatrix<double, MemorySpace> gradTile = Kokkos::subview(coeffGrad, Kokkos::ALL(), cols);
+
+        map_->ForwardPassImpl(ptsTile, StridedMatrix<const double, MemorySpace>(), mappedPts, logJacobian, StridedMatrix<double, MemorySpace>());
+        density_->LogDensityImpl(mappedPts, densTile);
+        densTile += logJacobian;
+
+        density_->LogDensityInputGradImpl(mappedPts, sens_map);
+        map_->ForwardPassImpl(ptsTile, sens_map, StridedMatrix<double, MemorySpace>(), StridedVector<double, MemorySpace>(), gradTile);
+    }
 }
 
 template<typename MemorySpace>
@@ -0,0 +1,126 @@
+#include "MParT/Distributions/SobolSampleGenerator.h"
+#include "MParT/Utilities/CounterRNG.h"
+#include "MParT/Utilities/MathFunctions.h"
+
+#include <sstream>
+
+using namespace mpart;
+
+namespace{
+
+    /** Primitive polynomials and initial direction numbers of the Joe-Kuo "new-joe-kuo-6.21201" table for dimensions 2 to 21.
+        The polynomial of degree \f$s\f$ has coefficients given by the bits of \f$a\f$, and \f$m_1,\ldots,m_s\f$ are the initial
+        direction numbers.  The first dimension uses \f$m_k=1\f$ for all \f$k\f$.
+    */
+    struct SobolPolynomial {
+        unsigned int s;
+        unsigned int a;
+        unsigned int m[7];
+    };
+
+    const SobolPolynomial sobolTable[] = {
+        {1,  0, {1}},
+        {2,  1, {1, 3}},
+        {3,  1, {1, 3, 1}},
+        {3,  2, {1, 1, 1}},
+        {4,  1, {1, 1, 3, 3}},
+        {4,  4, {1, 3, 5, 13}},
+        {5,  2, {1, 1, 5, 5, 17}},
+        {5,  4, {1, 1, 5, 5, 5}},
+        {5,  7, {1, 1, 7, 11, 19}},
+        {5, 11, {1, 1, 5, 1, 1}},
+        {5, 13, {1, 1, 1, 3, 11}},
+        {5, 14, {1, 3, 5, 5, 31}},
+        {6,  1, {1, 3, 3, 9, 7, 49}},
+        {6, 13, {1, 1, 1, 15, 21, 21}},
+        {6, 16, {1, 3, 1, 13, 27, 49}},
+        {6, 19, {1, 1, 1, 15, 7, 5}},
+        {6, 22, {1, 3, 1, 15, 13, 25}},
+        {6, 25, {1, 1, 5, 5, 19, 61}},
+        {7,  1, {1, 3, 7, 11, 23, 15, 103}},
+        {7,  4, {1, 3, 7, 13, 13, 15, 69}}
+    };
+}
+
+template<typename MemorySpace>
+SobolSampleGenerator<MemorySpace>::SobolSampleGenerator(unsigned int dim, bool gaussian, bool scramble, unsigned int seed) :
+    SampleGenerator<MemorySpace>(dim, seed), gaussian_(gaussian), scramble_(scramble)
+{
+    if((dim==0) || (dim > MaxDim)){
+        std::stringstream msg;
+        msg << "SobolSampleGenerator: The dimension must be between 1 and " << MaxDim << ", but a dimension of " << dim << " was given.  Consider using a HaltonSampleGenerator in higher dimensions.";
+        throw std::invalid_argument(msg.str());
+    }
+
+    Kokkos::View<uint32_t**, Kokkos::LayoutLeft, Kokkos::HostSpace> hostDirs("Sobol Directions", 32, dim);
+    for(unsigned int k=0; k<32; ++k)
+        hostDirs(k,0) = uint32_t(1) << (31-k);
+
+    for(unsigned int d=1; d<dim; ++d){
+        SobolPolynomial const& poly = sobolTable[d-1];
+        for(unsigned int k=0; k<32; ++k){
+            if(k<poly.s){
+                hostDirs(k,d) = uint32_t(poly.m[k]) << (31-k);
+            }else{
+                uint32_t v = hostDirs(k-poly.s,d) ^ (hostDirs(k-poly.s,d) >> poly.s);
+                for(unsigned int l=1; l<poly.s; ++l){
+                    if((poly.a >> (poly.s-1-l)) & 1)
+                        v ^= hostDirs(k-l,d);
+                }
+                hostDirs(k,d) = v;
+            }
+        }
+    }
+
+    directions_ = Kokkos::create_mirror_view(MemorySpace(), hostDirs);
+    Kokkos::deep_copy(directions_, hostDirs);
+}
+
+template<typename MemorySpace>
+void SobolSampleGenerator<MemorySpace>::SetSeed(unsigned int seed) {
+    SampleGenerator<MemorySpace>::SetSeed(seed);
+    sampleCounter_ = 0;
+}
+
+template<typename MemorySpace>
+void SobolSampleGenerator<MemorySpace>::SampleImpl(StridedMatrix<double, MemorySpace> output) {
+    int M = output.extent(0);
+    int N = output.extent(1);
+    if(M != dim_) {
+        throw std::runtime_error("SobolSampleGenerator::SampleImpl: The number of rows in output must match the dimension of the distribution.");
+    }
+    if(sampleCounter_ + N > (uint64_t(1) << 32)) {
+        throw std::runtime_error("SobolSampleGenerator::SampleImpl: The Sobol sequence is limited to 2^32 points.");
+    }
+
+    const uint32_t firstSample = uint32_t(sampleCounter_);
+    const uint32_t seed = seed_;
+    const bool gaussian = gaussian_;
+    const bool scramble = scramble_;
+    auto dirs = directions_;
+
+    Kokkos::MDRangePolicy<Kokkos::Rank<2>, typename MemoryToExecution<MemorySpace>::Space> policy({{0, 0}}, {{N, M}});
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int j, const int i) {
+        const uint32_t index = firstSample + uint32_t(j);
+        const uint32_t gray = index ^ (index >> 1);
+
+        uint32_t bits = 0;
+        for(unsigned int k=0; k<32; ++k){
+            if((gray >> k) & 1)
+                bits ^= dirs(k,i);
+        }
+
+        if(scramble)
+            bits = OwenScramble(bits, HashUInt32(seed ^ HashUInt32(uint32_t(i)+1)));
+
+        const double u = (double(bits) + 0.5) * (1.0 / 4294967296.0); // 2^{-32}
+        output(i,j) = gaussian ? InverseNormalCDF(u) : u;
+    });
+
+    sampleCounter_ += N;
+}
+
+template class mpart::SobolSampleGenerator<Kokkos::HostSpace>;
+#ifdef MPART_ENABLE_GPU
+template class mpart::SobolSampleGenerator<mpart::DeviceSpace>;
+#endif
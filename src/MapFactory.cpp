@@ -10,12 +10,15 @@
 #include "MParT/OrthogonalPolynomial.h"
 #include "MParT/HermiteFunction.h"
 #include "MParT/MultivariateExpansionWorker.h"
+#include "MParT/FixedDimExpansionWorker.h"
 #include "MParT/RectifiedMultivariateExpansion.h"
 #include "MParT/PositiveBijectors.h"
 #include "MParT/LinearizedBasis.h"
 #include "MParT/Sigmoid.h"
 #include "MParT/UnivariateExpansion.h"
 
+#include <algorithm>
+
 using namespace mpart;
 
 
@@ -23,6 +26,40 @@ template<typename MemorySpace>
 std::shared_ptr<ConditionalMapBase<MemorySpace>> mpart::MapFactory::CreateComponent(FixedMultiIndexSet<MemorySpace> const& mset,
                                                            MapOptions                                   opts)
 {
+    std::shared_ptr<ConditionalMapBase<MemorySpace>> output = CreateComponentWithoutCoeffs<MemorySpace>(mset, opts);
+    output->SetCoeffs(Kokkos::View<double*,MemorySpace>("Component Coefficients", output->numCoeffs));
+    return output;
+}
+
+
+template<typename MemorySpace>
+std::shared_ptr<ConditionalMapBase<MemorySpace>> mpart::MapFactory::CreateComponentWithoutCoeffs(FixedMultiIndexSet<MemorySpace> const& mset,
+                                                                       MapOptions                                   opts)
+{
+    if(opts.posFuncType==PosFuncTypes::Square){
+        bool isLinearized = (!isinf(opts.basisLB)) ||(!isinf(opts.basisUB));
+        if((opts.basisType==BasisTypes::HermiteFunctions) || isLinearized){
+            std::stringstream msg;
+            msg << "MapFactory::CreateComponent: PosFuncTypes::Square is only supported with non-linearized orthogonal polynomial bases, but basisType = "
+                << MapOptions::btypes[static_cast<unsigned int>(opts.basisType)] << " and linearized = " << (isLinearized ? "true" : "false") << ".";
+            throw std::invalid_argument(msg.str());
+        }
+    }
+
+    if(opts.fixedDimWorker && (mset.Length()<=FixedDimMaxInputDim)){
+
+        // All of the registered fixed dimension workers support degrees up to FixedDimMaxOrder
+        FixedMultiIndexSet<MemorySpace> msetCopy = mset;
+        FixedMultiIndexSet<Kokkos::HostSpace> hostSet = msetCopy.template ToDevice<Kokkos::HostSpace>();
+        auto maxDegrees = hostSet.MaxDegrees();
+
+        if(*std::max_element(maxDegrees.data(), maxDegrees.data()+maxDegrees.extent(0))<=FixedDimMaxOrder){
+            auto factory = CompFactoryImpl<MemorySpace>::GetFixedDimFactoryFunction(opts, mset.Length(), FixedDimMaxOrder);
+            if(factory)
+                return factory(mset,opts);
+        }
+    }
+
     return CompFactoryImpl<MemorySpace>::GetFactoryFunction(opts)(mset,opts);
 }
 
@@ -361,6 +398,7 @@ std::shared_ptr<ConditionalMapBase<MemorySpace>> MapFactory::CreateSigmoidTriang
 }
 
 template std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> mpart::MapFactory::CreateComponent<Kokkos::HostSpace>(FixedMultiIndexSet<Kokkos::HostSpace> const&, MapOptions);
+template std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> mpart::MapFactory::CreateComponentWithoutCoeffs<Kokkos::HostSpace>(FixedMultiIndexSet<Kokkos::HostSpace> const&, MapOptions);
 template std::shared_ptr<ParameterizedFunctionBase<Kokkos::HostSpace>> mpart::MapFactory::CreateExpansion<Kokkos::HostSpace>(unsigned int, FixedMultiIndexSet<Kokkos::HostSpace> const&, MapOptions);
 template std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> mpart::MapFactory::CreateTriangular<Kokkos::HostSpace>(unsigned int, unsigned int, unsigned int, MapOptions);
 template std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> mpart::MapFactory::CreateSingleEntryMap(unsigned int, unsigned int, std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> const&);
@@ -369,6 +407,7 @@ template std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> mpart::MapFactor
 template std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> mpart::MapFactory::CreateSigmoidTriangular<Kokkos::HostSpace>(unsigned int, unsigned int, unsigned int, std::vector<StridedVector<const double, Kokkos::HostSpace>> const&, MapOptions);
 #if defined(MPART_ENABLE_GPU)
     template std::shared_ptr<ConditionalMapBase<DeviceSpace>> mpart::MapFactory::CreateComponent<DeviceSpace>(FixedMultiIndexSet<DeviceSpace> const&, MapOptions);
+    template std::shared_ptr<ConditionalMapBase<DeviceSpace>> mpart::MapFactory::CreateComponentWithoutCoeffs<DeviceSpace>(FixedMultiIndexSet<DeviceSpace> const&, MapOptions);
     template std::shared_ptr<ParameterizedFunctionBase<DeviceSpace>> mpart::MapFactory::CreateExpansion<DeviceSpace>(unsigned int, FixedMultiIndexSet<DeviceSpace> const&, MapOptions);
     template std::shared_ptr<ConditionalMapBase<DeviceSpace>> mpart::MapFactory::CreateTriangular<DeviceSpace>(unsigned int, unsigned int, unsigned int, MapOptions);
     template std::shared_ptr<ConditionalMapBase<DeviceSpace>> mpart::MapFactory::CreateSingleEntryMap(unsigned int, unsigned int, std::shared_ptr<ConditionalMapBase<DeviceSpace>> const&);
@@ -0,0 +1,73 @@
+#include "MParT/MapFactory.h"
+
+#include "MParT/MonotoneComponent.h"
+#include "MParT/TriangularMap.h"
+#include "MParT/Quadrature.h"
+
+#include "MParT/OrthogonalPolynomial.h"
+#include "MParT/FixedDimExpansionWorker.h"
+#include "MParT/PositiveBijectors.h"
+
+#include <utility>
+
+using namespace mpart;
+
+template<typename MemorySpace, typename PosFuncType, unsigned int Dim>
+std::shared_ptr<ConditionalMapBase<MemorySpace>> CreateFixedComponentImpl_Prob_AS(FixedMultiIndexSet<MemorySpace> const& mset, MapOptions opts)
+{
+    BasisEvaluator<BasisHomogeneity::Homogeneous,ProbabilistHermite> basis1d(opts.basisNorm);
+    AdaptiveSimpson<MemorySpace> quad(opts.quadMaxSub, 1, nullptr, opts.quadAbsTol, opts.quadRelTol, QuadError::First, opts.quadMinSub);
+
+    FixedDimExpansionWorker<Dim, FixedDimMaxOrder, decltype(basis1d), MemorySpace> expansion(mset, basis1d);
+    std::shared_ptr<ConditionalMapBase<MemorySpace>> output;
+
+    output = std::make_shared<MonotoneComponent<decltype(expansion), PosFuncType, decltype(quad), MemorySpace>>(expansion, quad, opts.contDeriv, opts.nugget);
+
+    return output;
+}
+
+/** Registers the fixed dimension components for every dimension in 1,...,FixedDimMaxInputDim. */
+template<typename MemorySpace, typename PosFuncType, PosFuncTypes PosFuncKey, unsigned int... DimInds>
+bool RegisterFixedComponents_Prob_AS(std::integer_sequence<unsigned int, DimInds...>)
+{
+    auto factoryMap = mpart::MapFactory::CompFactoryImpl<MemorySpace>::GetFixedDimFactoryMap();
+    (factoryMap->insert(std::make_pair(std::make_tuple(BasisTypes::ProbabilistHermite, false, PosFuncKey, QuadTypes::AdaptiveSimpson, DimInds+1, FixedDimMaxOrder),
+                                       CreateFixedComponentImpl_Prob_AS<MemorySpace, PosFuncType, DimInds+1>)), ...);
+    return true;
+}
+
+static auto reg_host_fixed_prob_as_exp = RegisterFixedComponents_Prob_AS<Kokkos::HostSpace, Exp, PosFuncTypes::Exp>(std::make_integer_sequence<unsigned int, FixedDimMaxInputDim>());
+static auto reg_host_fixed_prob_as_splus = RegisterFixedComponents_Prob_AS<Kokkos::HostSpace, SoftPlus, PosFuncTypes::SoftPlus>(std::make_integer_sequence<unsigned int, FixedDimMaxInputDim>());
+#if defined(MPART_ENABLE_GPU)
+    static auto reg_device_fixed_prob_as_exp = RegisterFixedComponents_Prob_AS<mpart::DeviceSpace, Exp, PosFuncTypes::Exp>(std::make_integer_sequence<unsigned int, FixedDimMaxInputDim>());
+    static auto reg_device_fixed_prob_as_splus = RegisterFixedComponents_Prob_AS<mpart::DeviceSpace, SoftPlus, PosFuncTypes::SoftPlus>(std::make_integer_sequence<unsigned int, FixedDimMaxInputDim>());
+#endif
+
+
+#if defined(MPART_HAS_CEREAL)
+#define REGISTER_FIXED_DIM_PROB_AS(DIM, MEMORY_SPACE) \
+    REGISTER_FIXED_DIM_MONO_COMP(DIM, mpart::FixedDimMaxOrder, BasisHomogeneity::Homogeneous, ProbabilistHermite, Exp, AdaptiveSimpson, MEMORY_SPACE) \
+    REGISTER_FIXED_DIM_MONO_COMP(DIM, mpart::FixedDimMaxOrder, BasisHomogeneity::Homogeneous, ProbabilistHermite, SoftPlus, AdaptiveSimpson, MEMORY_SPACE)
+
+static_assert(FixedDimMaxInputDim==8, "Update the cereal registrations below to match FixedDimMaxInputDim.");
+
+REGISTER_FIXED_DIM_PROB_AS(1, Kokkos::HostSpace)
+REGISTER_FIXED_DIM_PROB_AS(2, Kokkos::HostSpace)
+REGISTER_FIXED_DIM_PROB_AS(3, Kokkos::HostSpace)
+REGISTER_FIXED_DIM_PROB_AS(4, Kokkos::HostSpace)
+REGISTER_FIXED_DIM_PROB_AS(5, Kokkos::HostSpace)
+REGISTER_FIXED_DIM_PROB_AS(6, Kokkos::HostSpace)
+REGISTER_FIXED_DIM_PROB_AS(7, Kokkos::HostSpace)
+REGISTER_FIXED_DIM_PROB_AS(8, Kokkos::HostSpace)
+#if defined(MPART_ENABLE_GPU)
+REGISTER_FIXED_DIM_PROB_AS(1, mpart::DeviceSpace)
+REGISTER_FIXED_DIM_PROB_AS(2, mpart::DeviceSpace)
+REGISTER_FIXED_DIM_PROB_AS(3, mpart::DeviceSpace)
+REGISTER_FIXED_DIM_PROB_AS(4, mpart::DeviceSpace)
+REGISTER_FIXED_DIM_PROB_AS(5, mpart::DeviceSpace)
+REGISTER_FIXED_DIM_PROB_AS(6, mpart::DeviceSpace)
+REGISTER_FIXED_DIM_PROB_AS(7, mpart::DeviceSpace)
+REGISTER_FIXED_DIM_PROB_AS(8, mpart::DeviceSpace)
+#endif
+CEREAL_REGISTER_DYNAMIC_INIT(mpartInitMapFactory19)
+#endif
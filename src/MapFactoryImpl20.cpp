@@ -0,0 +1,66 @@
+#include "MParT/MapFactory.h"
+
+#include "MParT/MonotoneComponent.h"
+#include "MParT/TriangularMap.h"
+#include "MParT/Quadrature.h"
+
+#include "MParT/OrthogonalPolynomial.h"
+#include "MParT/MultivariateExpansionWorker.h"
+#include "MParT/PositiveBijectors.h"
+
+#include "MParT/LinearizedBasis.h"
+
+using namespace mpart;
+
+template<typename MemorySpace, typename PosFuncType>
+std::shared_ptr<ConditionalMapBase<MemorySpace>> CreateComponentImpl_Phys_GL(FixedMultiIndexSet<MemorySpace> const& mset, MapOptions opts)
+{
+    BasisEvaluator<BasisHomogeneity::Homogeneous,PhysicistHermite> basis1d(opts.basisNorm);
+    GaussLegendreQuadrature<MemorySpace> quad(opts.quadPts, 1);
+
+    MultivariateExpansionWorker<decltype(basis1d),MemorySpace> expansion(mset, basis1d);
+    std::shared_ptr<ConditionalMapBase<MemorySpace>> output;
+
+    output = std::make_shared<MonotoneComponent<decltype(expansion), PosFuncType, decltype(quad), MemorySpace>>(expansion, quad, opts.contDeriv, opts.nugget);
+
+    return output;
+}
+
+template<typename MemorySpace, typename PosFuncType>
+std::shared_ptr<ConditionalMapBase<MemorySpace>> CreateComponentImpl_LinPhys_GL(FixedMultiIndexSet<MemorySpace> const& mset, MapOptions opts)
+{
+    BasisEvaluator<BasisHomogeneity::Homogeneous,LinearizedBasis<PhysicistHermite>> basis1d(PhysicistHermite(opts.basisNorm), opts.basisLB, opts.basisUB);
+    GaussLegendreQuadrature<MemorySpace> quad(opts.quadPts, 1);
+
+    MultivariateExpansionWorker<decltype(basis1d),MemorySpace> expansion(mset, basis1d);
+    std::shared_ptr<ConditionalMapBase<MemorySpace>> output;
+
+    output = std::make_shared<MonotoneComponent<decltype(expansion), PosFuncType, decltype(quad), MemorySpace>>(expansion, quad, opts.contDeriv, opts.nugget);
+
+    return output;
+}
+
+static auto reg_host_phys_gl_exp = mpart::MapFactory::CompFactoryImpl<Kokkos::HostSpace>::GetFactoryMap()->insert(std::make_pair(std::make_tuple(BasisTypes::PhysicistHermite, false, PosFuncTypes::Exp, QuadTypes::GaussLegendre), CreateComponentImpl_Phys_GL<Kokkos::HostSpace, Exp>));
+static auto reg_host_phys_gl_splus = mpart::MapFactory::CompFactoryImpl<Kokkos::HostSpace>::GetFactoryMap()->insert(std::make_pair(std::make_tuple(BasisTypes::PhysicistHermite, false, PosFuncTypes::SoftPlus, QuadTypes::GaussLegendre), CreateComponentImpl_Phys_GL<Kokkos::HostSpace, SoftPlus>));
+static auto reg_host_linphys_gl_exp = mpart::MapFactory::CompFactoryImpl<Kokkos::HostSpace>::GetFactoryMap()->insert(std::make_pair(std::make_tuple(BasisTypes::PhysicistHermite, true, PosFuncTypes::Exp, QuadTypes::GaussLegendre), CreateComponentImpl_LinPhys_GL<Kokkos::HostSpace, Exp>));
+static auto reg_host_linphys_gl_splus = mpart::MapFactory::CompFactoryImpl<Kokkos::HostSpace>::GetFactoryMap()->insert(std::make_pair(std::make_tuple(BasisTypes::PhysicistHermite, true, PosFuncTypes::SoftPlus, QuadTypes::GaussLegendre), CreateComponentImpl_LinPhys_GL<Kokkos::HostSpace, SoftPlus>));
+#if defined(MPART_ENABLE_GPU)
+    static auto reg_device_phys_gl_exp = mpart::MapFactory::CompFactoryImpl<mpart::DeviceSpace>::GetFactoryMap()->insert(std::make_pair(std::make_tuple(BasisTypes::PhysicistHermite, false, PosFuncTypes::Exp, QuadTypes::GaussLegendre), CreateComponentImpl_Phys_GL<mpart::DeviceSpace, Exp>));
+    static auto reg_device_phys_gl_splus = mpart::MapFactory::CompFactoryImpl<mpart::DeviceSpace>::GetFactoryMap()->insert(std::make_pair(std::make_tuple(BasisTypes::PhysicistHermite, false, PosFuncTypes::SoftPlus, QuadTypes::GaussLegendre), CreateComponentImpl_Phys_GL<mpart::DeviceSpace, SoftPlus>));
+    static auto reg_device_linphys_gl_exp = mpart::MapFactory::CompFactoryImpl<mpart::DeviceSpace>::GetFactoryMap()->insert(std::make_pair(std::make_tuple(BasisTypes::PhysicistHermite, true, PosFuncTypes::Exp, QuadTypes::GaussLegendre), CreateComponentImpl_LinPhys_GL<mpart::DeviceSpace, Exp>));
+    static auto reg_device_linphys_gl_splus = mpart::MapFactory::CompFactoryImpl<mpart::DeviceSpace>::GetFactoryMap()->insert(std::make_pair(std::make_tuple(BasisTypes::PhysicistHermite, true, PosFuncTypes::SoftPlus, QuadTypes::GaussLegendre), CreateComponentImpl_LinPhys_GL<mpart::DeviceSpace, SoftPlus>));
+#endif
+
+#if defined(MPART_HAS_CEREAL)
+REGISTER_MONO_COMP(BasisHomogeneity::Homogeneous, PhysicistHermite, Exp, GaussLegendreQuadrature, Kokkos::HostSpace)
+REGISTER_MONO_COMP(BasisHomogeneity::Homogeneous, PhysicistHermite, SoftPlus, GaussLegendreQuadrature, Kokkos::HostSpace)
+REGISTER_MONO_COMP(BasisHomogeneity::Homogeneous, LinearizedBasis<mpart::PhysicistHermite>, Exp, GaussLegendreQuadrature, Kokkos::HostSpace)
+REGISTER_MONO_COMP(BasisHomogeneity::Homogeneous, LinearizedBasis<mpart::PhysicistHermite>, SoftPlus, GaussLegendreQuadrature, Kokkos::HostSpace)
+#if defined(MPART_ENABLE_GPU)
+REGISTER_MONO_COMP(BasisHomogeneity::Homogeneous, PhysicistHermite, Exp, GaussLegendreQuadrature, mpart::DeviceSpace)
+REGISTER_MONO_COMP(BasisHomogeneity::Homogeneous, PhysicistHermite, SoftPlus, GaussLegendreQuadrature, mpart::DeviceSpace)
+REGISTER_MONO_COMP(BasisHomogeneity::Homogeneous, LinearizedBasis<mpart::PhysicistHermite>, Exp, GaussLegendreQuadrature, mpart::DeviceSpace)
+REGISTER_MONO_COMP(BasisHomogeneity::Homogeneous, LinearizedBasis<mpart::PhysicistHermite>, SoftPlus, GaussLegendreQuadrature, mpart::DeviceSpace)
+#endif 
+CEREAL_REGISTER_DYNAMIC_INIT(mpartInitMapFactory20)
+#endif
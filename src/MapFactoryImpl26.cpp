@@ -0,0 +1,60 @@
+#include "MParT/MapFactory.h"
+
+#include "MParT/MonotoneComponent.h"
+#include "MParT/TriangularMap.h"
+#include "MParT/Quadrature.h"
+
+#include "MParT/OrthogonalPolynomial.h"
+#include "MParT/MultivariateExpansionWorker.h"
+#include "MParT/PositiveBijectors.h"
+#include "MParT/MultiIndices/FixedMultiIndexSet.h"
+
+
+using namespace mpart;
+
+/* Components with g(x)=x^2 evaluate the integral in closed form, so the quadrature options are ignored.  A Gauss-Legendre
+   rule with as many points as the maximum degree in x_d integrates the squared derivative exactly and is used by the
+   remaining quadrature-based operations (e.g., the input gradient and the inverse).
+*/
+template<typename MemorySpace, typename BasisType>
+std::shared_ptr<ConditionalMapBase<MemorySpace>> CreateComponentImpl_Square(FixedMultiIndexSet<MemorySpace> const& mset, MapOptions opts)
+{
+    BasisEvaluator<BasisHomogeneity::Homogeneous,BasisType> basis1d(opts.basisNorm);
+
+    FixedMultiIndexSet<MemorySpace> msetCopy = mset;
+    auto maxDegrees = msetCopy.template ToDevice<Kokkos::HostSpace>().MaxDegrees();
+    GaussLegendreQuadrature<MemorySpace> quad(std::max<unsigned int>(maxDegrees(mset.Length()-1), 1), 1);
+
+    MultivariateExpansionWorker<decltype(basis1d),MemorySpace> expansion(mset, basis1d);
+    std::shared_ptr<ConditionalMapBase<MemorySpace>> output;
+
+    output = std::make_shared<MonotoneComponent<decltype(expansion), Square, decltype(quad), MemorySpace>>(expansion, quad, opts.contDeriv, opts.nugget);
+
+    return output;
+}
+
+template<typename MemorySpace, typename BasisType>
+bool RegisterSquareComponents(BasisTypes basisType)
+{
+    auto factoryMap = mpart::MapFactory::CompFactoryImpl<MemorySpace>::GetFactoryMap();
+    for(QuadTypes quadType : {QuadTypes::ClenshawCurtis, QuadTypes::AdaptiveSimpson, QuadTypes::AdaptiveClenshawCurtis, QuadTypes::GaussLegendre, QuadTypes::AdaptiveGaussKronrod})
+        factoryMap->insert(std::make_pair(std::make_tuple(basisType, false, PosFuncTypes::Square, quadType), CreateComponentImpl_Square<MemorySpace, BasisType>));
+    return true;
+}
+
+static auto reg_host_prob_square = RegisterSquareComponents<Kokkos::HostSpace, ProbabilistHermite>(BasisTypes::ProbabilistHermite);
+static auto reg_host_phys_square = RegisterSquareComponents<Kokkos::HostSpace, PhysicistHermite>(BasisTypes::PhysicistHermite);
+#if defined(MPART_ENABLE_GPU)
+    static auto reg_device_prob_square = RegisterSquareComponents<mpart::DeviceSpace, ProbabilistHermite>(BasisTypes::ProbabilistHermite);
+    static auto reg_device_phys_square = RegisterSquareComponents<mpart::DeviceSpace, PhysicistHermite>(BasisTypes::PhysicistHermite);
+#endif
+
+#if defined(MPART_HAS_CEREAL)
+REGISTER_MONO_COMP(BasisHomogeneity::Homogeneous, ProbabilistHermite, Square, GaussLegendreQuadrature, Kokkos::HostSpace)
+REGISTER_MONO_COMP(BasisHomogeneity::Homogeneous, PhysicistHermite, Square, GaussLegendreQuadrature, Kokkos::HostSpace)
+#if defined(MPART_ENABLE_GPU)
+REGISTER_MONO_COMP(BasisHomogeneity::Homogeneous, ProbabilistHermite, Square, GaussLegendreQuadrature, mpart::DeviceSpace)
+REGISTER_MONO_COMP(BasisHomogeneity::Homogeneous, PhysicistHermite, Square, GaussLegendreQuadrature, mpart::DeviceSpace)
+#endif
+CEREAL_REGISTER_DYNAMIC_INIT(mpartInitMapFactory26)
+#endif
@@ -21,7 +21,6 @@ std::shared_ptr<ConditionalMapBase<MemorySpace>> CreateComponentImpl_HF_CC(Fixed
 
     output = std::make_shared<MonotoneComponent<decltype(expansion), PosFuncType, decltype(quad), MemorySpace>>(expansion, quad, opts.contDeriv, opts.nugget);
 
-    output->SetCoeffs(Kokkos::View<double*,MemorySpace>("Component Coefficients", mset.Size()));
     return output;
 }
 
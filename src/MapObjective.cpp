@@ -1,17 +1,119 @@
 #include "MParT/MapObjective.h"
+
+#include <algorithm>
+#include <sstream>
+#include <type_traits>
+
 using namespace mpart;
 
+template<typename MemorySpace>
+MapObjective<MemorySpace>::MapObjective(std::shared_ptr<MappedDataset> train, std::shared_ptr<MappedDataset> test): trainFile_(train), testFile_(test) {
+    if(train == nullptr) {
+        throw std::invalid_argument("MapObjective: Training dataset file must not be null.");
+    }
+    if((test != nullptr) && (test->Dim() != train->Dim())) {
+        std::stringstream ss;
+        ss << "MapObjective: Training dataset has dimension " << train->Dim() << ", but testing dataset has dimension " << test->Dim() << ".";
+        throw std::invalid_argument(ss.str());
+    }
+    fileRows_ = train->Dim();
+
+    // Host views alias the mapping directly, so code that needs the whole dataset still works without reading it up front
+    if constexpr(std::is_same_v<MemorySpace, Kokkos::HostSpace>) {
+        train_ = train->All();
+        if(test != nullptr)
+            test_ = test->All();
+    }
+}
+
+template<typename MemorySpace>
+void MapObjective<MemorySpace>::RestrictRows(unsigned int rows) {
+    fileRows_ = rows;
+    if(train_.extent(0) > 0)
+        train_ = Kokkos::subview(train_, std::make_pair(0u, rows), Kokkos::ALL());
+    if(test_.extent(0) > 0)
+        test_ = Kokkos::subview(test_, std::make_pair(0u, rows), Kokkos::ALL());
+}
+
+template<typename MemorySpace>
+double MapObjective<MemorySpace>::StreamObjective(std::shared_ptr<MappedDataset> const& file, StridedVector<double, MemorySpace> grad, std::shared_ptr<ConditionalMapBase<MemorySpace>> map, bool computeObjective) const {
+    unsigned int numPts = file->NumSamples();
+    unsigned int fileDim = file->Dim();
+    bool computeGrad = (grad.data() != nullptr);
+
+    std::size_t blockSize = streamBlockBytes_ / (std::max<std::size_t>(fileDim, 1)*sizeof(double));
+    blockSize = std::min<std::size_t>(std::max<std::size_t>(blockSize, 1), std::max(numPts, 1u));
+
+    Kokkos::View<double*, MemorySpace> blockGrad;
+    if(computeGrad) {
+        blockGrad = Kokkos::View<double*, MemorySpace>("Streamed block gradient", grad.extent(0));
+        Kokkos::deep_copy(grad, 0.0);
+    }
+
+    // Staging buffers for copying blocks off the host.  The file block is strided, so it is first packed into a
+    // LayoutLeft host mirror of the device buffer.  Both are unused when the map lives in host memory.
+    Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> stage;
+    Kokkos::View<double**, Kokkos::LayoutLeft, Kokkos::HostSpace> hostStage;
+
+    double objective = 0.;
+    for(unsigned int blockStart = 0; blockStart < numPts; blockStart += blockSize) {
+        unsigned int blockEnd = std::min<std::size_t>(blockStart + blockSize, numPts);
+        unsigned int blockPts = blockEnd - blockStart;
+        double weight = double(blockPts) / double(numPts);
+
+        StridedMatrix<const double, MemorySpace> block;
+        if constexpr(std::is_same_v<MemorySpace, Kokkos::HostSpace>) {
+            block = file->Block(blockStart, blockEnd);
+        } else {
+            if(stage.extent(1) == 0) {
+                stage = Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace>("Streamed block", fileDim, blockSize);
+                hostStage = Kokkos::create_mirror_view(Kokkos::HostSpace(), stage);
+            }
+            auto hostBlock = Kokkos::subview(hostStage, Kokkos::ALL(), std::make_pair(0u, blockPts));
+            auto stageBlock = Kokkos::subview(stage, Kokkos::ALL(), std::make_pair(0u, blockPts));
+            Kokkos::deep_copy(hostBlock, file->Block(blockStart, blockEnd));
+            Kokkos::deep_copy(stageBlock, hostBlock);
+            block = stageBlock;
+        }
+        block = Kokkos::subview(block, std::make_pair(0u, fileRows_), Kokkos::ALL());
+
+        if(computeObjective && computeGrad) {
+            objective += weight*ObjectivePlusCoeffGradImpl(block, blockGrad, map);
+        } else if(computeObjective) {
+            objective += weight*ObjectiveImpl(block, map);
+        } else if(computeGrad) {
+            CoeffGradImpl(block, blockGrad, map);
+        }
+
+        if(computeGrad) {
+            Kokkos::parallel_for("Accumulate streamed gradient", Kokkos::RangePolicy<typename MemoryToExecution<MemorySpace>::Space>(0, grad.extent(0)), KOKKOS_LAMBDA(const unsigned int i) {
+                grad(i) += weight*blockGrad(i);
+            });
+            Kokkos::fence();
+        }
+
+        // Every sample in this block has been consumed, so its pages can be dropped from memory
+        file->Release(blockStart, blockEnd);
+    }
+    return objective;
+}
+
 template<typename MemorySpace>
 double MapObjective<MemorySpace>::operator()(unsigned int n, const double* coeffs, double* grad, std::shared_ptr<ConditionalMapBase<MemorySpace>> map) {
 
     StridedVector<const double, MemorySpace> coeffView = ToConstKokkos<double,MemorySpace>(coeffs, n);
     StridedVector<double, MemorySpace> gradView = ToKokkos<double,MemorySpace>(grad, n);
     map->SetCoeffs(coeffView);
+    if(trainFile_ != nullptr)
+        return StreamObjective(trainFile_, gradView, map, true);
     return ObjectivePlusCoeffGradImpl(train_, gradView, map);
 }
 
 template<typename MemorySpace>
 double MapObjective<MemorySpace>::TestError(std::shared_ptr<ConditionalMapBase<MemorySpace>> map) const {
+    if(testFile_ != nullptr) {
+        return StreamObjective(testFile_, StridedVector<double, MemorySpace>(), map, true);
+    }
     if(test_.extent(0) == 0) {
         throw std::runtime_error("No test dataset given!");
     }
@@ -20,11 +122,17 @@ double MapObjective<MemorySpace>::TestError(std::shared_ptr<ConditionalMapBase<M
 
 template<typename MemorySpace>
 double MapObjective<MemorySpace>::TrainError(std::shared_ptr<ConditionalMapBase<MemorySpace>> map) const {
+    if(trainFile_ != nullptr)
+        return StreamObjective(trainFile_, StridedVector<double, MemorySpace>(), map, true);
     return ObjectiveImpl(train_, map);
 }
 
 template<typename MemorySpace>
 void MapObjective<MemorySpace>::TrainCoeffGradImpl(std::shared_ptr<ConditionalMapBase<MemorySpace>> map, StridedVector<double, MemorySpace> grad) const {
+    if(trainFile_ != nullptr) {
+        StreamObjective(trainFile_, grad, map, false);
+        return;
+    }
     CoeffGradImpl(train_, grad, map);
 }
 
@@ -50,41 +158,141 @@ std::shared_ptr<MapObjective<MemorySpace>> ObjectiveFactory::CreateGaussianKLObj
 }
 
 template<typename MemorySpace>
-double KLObjective<MemorySpace>::ObjectivePlusCoeffGradImpl(StridedMatrix<const double, MemorySpace> data, StridedVector<double, MemorySpace> grad, std::shared_ptr<ConditionalMapBase<MemorySpace>> map) const {
+std::shared_ptr<MapObjective<MemorySpace>> ObjectiveFactory::CreateGaussianKLObjective(std::shared_ptr<MappedDataset> train, std::shared_ptr<MappedDataset> test, unsigned int dim) {
+    if(dim == 0) dim = train->Dim();
+    std::shared_ptr<GaussianSamplerDensity<MemorySpace>> density = std::make_shared<GaussianSamplerDensity<MemorySpace>>(dim);
+    return std::make_shared<KLObjective<MemorySpace>>(train, test, density);
+}
+
+template<typename MemorySpace>
+bool KLObjective<MemorySpace>::IsSeparable() const {
+    auto gaussian = std::dynamic_pointer_cast<GaussianSamplerDensity<MemorySpace>>(density_);
+    return (gaussian != nullptr) && gaussian->HasIdentityCovariance();
+}
+
+template<typename MemorySpace>
+std::shared_ptr<KLObjective<MemorySpace>> KLObjective<MemorySpace>::MarginalObjective(unsigned int inputDim, unsigned int outputStart, unsigned int outputDim) const {
+    if(!IsSeparable()) {
+        throw std::runtime_error("KLObjective::MarginalObjective: Reference density does not factor over the map outputs.");
+    }
+    StridedMatrix<const double, MemorySpace> train = this->GetTrain();
+    StridedMatrix<const double, MemorySpace> test = this->GetTest();
+    if((inputDim > this->InputDim()) || (outputStart + outputDim > density_->Dim())) {
+        std::stringstream ss;
+        ss << "KLObjective::MarginalObjective: Block with input dimension " << inputDim << " and outputs [" << outputStart << "," << outputStart+outputDim << ") ";
+        ss << "does not fit objective with input dimension " << this->InputDim() << " and output dimension " << density_->Dim() << ".";
+        throw std::invalid_argument(ss.str());
+    }
+
+    StridedVector<double, MemorySpace> mean = std::dynamic_pointer_cast<GaussianSamplerDensity<MemorySpace>>(density_)->Mean();
+    std::shared_ptr<GaussianSamplerDensity<MemorySpace>> density;
+    if(mean.extent(0) == 0) {
+        density = std::make_shared<GaussianSamplerDensity<MemorySpace>>(outputDim);
+    } else {
+        StridedVector<double, MemorySpace> blockMean = Kokkos::subview(mean, std::make_pair(outputStart, outputStart + outputDim));
+        density = std::make_shared<GaussianSamplerDensity<MemorySpace>>(blockMean);
+    }
+
+    // Streamed objectives share the dataset files and only use their leading rows
+    if(this->IsStreamed()) {
+        auto blockObjective = std::make_shared<KLObjective<MemorySpace>>(this->GetTrainFile(), this->GetTestFile(), density);
+        blockObjective->RestrictRows(inputDim);
+        blockObjective->SetStreamBlockBytes(this->GetStreamBlockBytes());
+        blockObjective->SetGradientBlockBytes(gradBlockBytes_);
+        return blockObjective;
+    }
+
+    StridedMatrix<const double, MemorySpace> blockTrain = Kokkos::subview(train, std::make_pair(0u, inputDim), Kokkos::ALL());
+    std::shared_ptr<KLObjective<MemorySpace>> blockObjective;
+    if(test.extent(0) == 0) {
+        blockObjective = std::make_shared<KLObjective<MemorySpace>>(blockTrain, density);
+    } else {
+        StridedMatrix<const double, MemorySpace> blockTest = Kokkos::subview(test, std::make_pair(0u, inputDim), Kokkos::ALL());
+        blockObjective = std::make_shared<KLObjective<MemorySpace>>(blockTrain, blockTest, density);
+    }
+    blockObjective->SetGradientBlockBytes(gradBlockBytes_);
+    return blockObjective;
+}
+
+template<typename MemorySpace>
+unsigned int KLObjective<MemorySpace>::GradBlockSize(unsigned int numPts, unsigned int numCoeffs) const {
+    if(numCoeffs == 0)
+        return numPts;
+    std::size_t blockSize = gradBlockBytes_ / (std::size_t(numCoeffs)*sizeof(double));
+    blockSize = std::max<std::size_t>(blockSize, 1);
+    return static_cast<unsigned int>(std::min<std::size_t>(blockSize, numPts));
+}
+
+template<typename MemorySpace>
+double KLObjective<MemorySpace>::StreamObjectiveAndGrad(StridedMatrix<const double, MemorySpace> data, StridedVector<double, MemorySpace> grad, std::shared_ptr<ConditionalMapBase<MemorySpace>> map, bool computeObjective) const {
     unsigned int N_samps = data.extent(1);
     unsigned int grad_dim = grad.extent(0);
+    bool computeGrad = (grad.data() != nullptr);
     PullbackDensity<MemorySpace> pullback {map, density_};
-    StridedVector<double, MemorySpace> densityX = pullback.LogDensity(data);
-    StridedMatrix<double, MemorySpace> densityGradX = pullback.LogDensityCoeffGrad(data);
+
+    if(computeGrad)
+        Kokkos::deep_copy(grad, 0.0);
+
     double sumDensity = 0.;
-    
-    Kokkos::parallel_reduce ("Sum Negative Log Likelihood", N_samps, KOKKOS_LAMBDA (const int i, double &sum) {
-        sum -= densityX(i);
-    }, sumDensity);
+    double scale = -1.0/((double) N_samps);
+    unsigned int blockSize = GradBlockSize(N_samps, grad_dim);
+
+    // Accumulate the objective and gradient over blocks of samples so that only a numCoeffs x blockSize
+    // slice of the per-sample coefficient gradient is ever held in memory.
+    for(unsigned int blockStart = 0; blockStart < N_samps; blockStart += blockSize) {
+        unsigned int blockEnd = std::min(blockStart + blockSize, N_samps);
+        unsigned int blockPts = blockEnd - blockStart;
+        StridedMatrix<const double, MemorySpace> blockData = Kokkos::subview(data, Kokkos::ALL(), std::make_pair(blockStart, blockEnd));
 
+        // When both are needed, the map output and log determinant are shared between the objective and the gradient
+        StridedMatrix<double, MemorySpace> densityGradX;
+        if(computeObjective) {
+            Kokkos::View<double*, MemorySpace> densityX("Log Density", blockPts);
+            if(computeGrad) {
+                densityGradX = Kokkos::View<double**, MemorySpace>("LogDensityCoeffGrad", grad_dim, blockPts);
+                pullback.LogDensityAndCoeffGradImpl(blockData, densityX, densityGradX);
+            } else {
+                pullback.LogDensityImpl(blockData, densityX);
+            }
 
-    if (grad.data()!=nullptr){
-        double scale = -1.0/((double) N_samps);
+            double blockSum = 0.;
+            Kokkos::parallel_reduce ("Sum Negative Log Likelihood", blockPts, KOKKOS_LAMBDA (const int i, double &sum) {
+                sum -= densityX(i);
+            }, blockSum);
+            sumDensity += blockSum;
+        } else if(computeGrad) {
+            densityGradX = pullback.LogDensityCoeffGrad(blockData);
+        }
 
-        Kokkos::TeamPolicy<MemoryToExecution<MemorySpace>> policy(grad_dim, Kokkos::AUTO());
+        if(computeGrad) {
 
-        Kokkos::parallel_for(policy,
-            KOKKOS_LAMBDA(auto& tag, auto&& teamMember){
-                int row = teamMember.league_rank();
-                double thisRowSum = 0.0;
-                Kokkos::parallel_reduce(Kokkos::TeamThreadRange(teamMember, N_samps), 
-                    KOKKOS_LAMBDA(int col, double& innerUpdate){
-                        innerUpdate += scale*densityGradX(row,col);
-                    }, 
-                thisRowSum);
+            Kokkos::TeamPolicy<MemoryToExecution<MemorySpace>> policy(grad_dim, Kokkos::AUTO());
+            Kokkos::parallel_for(policy,
+                KOKKOS_LAMBDA(auto& tag, auto&& teamMember){
+                    int row = teamMember.league_rank();
+                    double thisRowSum = 0.0;
+                    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(teamMember, blockPts),
+                        KOKKOS_LAMBDA(int col, double& innerUpdate){
+                            innerUpdate += scale*densityGradX(row,col);
+                        },
+                    thisRowSum);
 
-                grad(row) = thisRowSum;
-            }
-        );
+                    Kokkos::single(Kokkos::PerTeam(teamMember), [&](){
+                        grad(row) += thisRowSum;
+                    });
+                }
+            );
+            Kokkos::fence();
+        }
     }
     return sumDensity/N_samps;
 }
 
+template<typename MemorySpace>
+double KLObjective<MemorySpace>::ObjectivePlusCoeffGradImpl(StridedMatrix<const double, MemorySpace> data, StridedVector<double, MemorySpace> grad, std::shared_ptr<ConditionalMapBase<MemorySpace>> map) const {
+    return StreamObjectiveAndGrad(data, grad, map, true);
+}
+
 template<typename MemorySpace>
 double KLObjective<MemorySpace>::ObjectiveImpl(StridedMatrix<const double, MemorySpace> data, std::shared_ptr<ConditionalMapBase<MemorySpace>> map) const {
     unsigned int N_samps = data.extent(1);
@@ -99,22 +307,7 @@ double KLObjective<MemorySpace>::ObjectiveImpl(StridedMatrix<const double, Memor
 
 template<typename MemorySpace>
 void KLObjective<MemorySpace>::CoeffGradImpl(StridedMatrix<const double, MemorySpace> data, StridedVector<double, MemorySpace> grad, std::shared_ptr<ConditionalMapBase<MemorySpace>> map) const {
-    unsigned int N_samps = data.extent(1);
-    unsigned int grad_dim = grad.extent(0);
-    PullbackDensity<MemorySpace> pullback {map, density_};
-    StridedMatrix<double, MemorySpace> densityGradX = pullback.LogDensityCoeffGrad(data);
-
-    double scale = -1.0/((double) N_samps);
-    Kokkos::parallel_for("grad", Kokkos::TeamPolicy<MemoryToExecution<MemorySpace>>(grad_dim, Kokkos::AUTO()),
-        KOKKOS_LAMBDA(auto t, typename Kokkos::TeamPolicy<MemoryToExecution<MemorySpace>>::member_type teamMember){
-            int row = teamMember.league_rank();
-            double thisRowSum = 0.0;
-            Kokkos::parallel_reduce(Kokkos::TeamThreadRange(teamMember, N_samps), KOKKOS_LAMBDA(int col, double& innerUpdate){
-              innerUpdate += scale*densityGradX(row,col);
-            }, thisRowSum);
-            grad(row) = thisRowSum;
-        }
-    );
+    StreamObjectiveAndGrad(data, grad, map, false);
 }
 
 // Explicit template instantiation
@@ -122,9 +315,11 @@ template class mpart::MapObjective<Kokkos::HostSpace>;
 template class mpart::KLObjective<Kokkos::HostSpace>;
 template std::shared_ptr<MapObjective<Kokkos::HostSpace>> mpart::ObjectiveFactory::CreateGaussianKLObjective<Kokkos::HostSpace>(StridedMatrix<const double, Kokkos::HostSpace>, unsigned int);
 template std::shared_ptr<MapObjective<Kokkos::HostSpace>> mpart::ObjectiveFactory::CreateGaussianKLObjective<Kokkos::HostSpace>(StridedMatrix<const double, Kokkos::HostSpace>, StridedMatrix<const double, Kokkos::HostSpace>, unsigned int);
+template std::shared_ptr<MapObjective<Kokkos::HostSpace>> mpart::ObjectiveFactory::CreateGaussianKLObjective<Kokkos::HostSpace>(std::shared_ptr<MappedDataset>, std::shared_ptr<MappedDataset>, unsigned int);
 #if defined(MPART_ENABLE_GPU)
     template class mpart::MapObjective<DeviceSpace>;
     template class mpart::KLObjective<DeviceSpace>;
     template std::shared_ptr<MapObjective<DeviceSpace>> mpart::ObjectiveFactory::CreateGaussianKLObjective<DeviceSpace>(StridedMatrix<const double, DeviceSpace>, unsigned int);
     template std::shared_ptr<MapObjective<DeviceSpace>> mpart::ObjectiveFactory::CreateGaussianKLObjective<DeviceSpace>(StridedMatrix<const double, DeviceSpace>, StridedMatrix<const double, DeviceSpace>, unsigned int);
+    template std::shared_ptr<MapObjective<DeviceSpace>> mpart::ObjectiveFactory::CreateGaussianKLObjective<DeviceSpace>(std::shared_ptr<MappedDataset>, std::shared_ptr<MappedDataset>, unsigned int);
 #endif
\ No newline at end of file
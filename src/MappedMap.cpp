@@ -0,0 +1,417 @@
+#include "MParT/MappedMap.h"
+
+#include "MParT/MapFactory.h"
+#include "MParT/TriangularMap.h"
+#include "MParT/Utilities/MappedFile.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <typeinfo>
+#include <vector>
+
+using namespace mpart;
+
+namespace {
+
+    const char mapMagic[8] = {'M','P','A','R','T','M','A','P'};
+    const uint32_t mapVersion = 1;
+
+    // Every section starts on a cache line so the views into the mapping are aligned
+    const std::size_t sectionAlign = 64;
+
+    // Number of points and relative tolerance used to check that the options rebuild each saved component
+    const unsigned int numCheckPts = 3;
+    const double optionCheckTol = 1e-12;
+
+    struct MapFileHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t numComps;
+        uint32_t inputDim;
+        uint32_t outputDim;
+        uint32_t isTriangular;
+        uint32_t reserved;
+        uint64_t numCoeffs;
+        uint64_t optionsOffset;
+        uint64_t tableOffset;
+        uint64_t coeffsOffset;
+    };
+    static_assert(sizeof(MapFileHeader) == 64, "Unexpected padding in MapFileHeader");
+
+    struct MapFileOptions {
+        double basisLB;
+        double basisUB;
+        double quadAbsTol;
+        double quadRelTol;
+        double nugget;
+        double edgeShape;
+        uint32_t basisType;
+        uint32_t posFuncType;
+        uint32_t quadType;
+        uint32_t sigmoidType;
+        uint32_t edgeType;
+        uint32_t quadMaxSub;
+        uint32_t quadMinSub;
+        uint32_t quadPts;
+        uint32_t contDeriv;
+        uint32_t basisNorm;
+        uint32_t fixedDimWorker;
+        uint32_t reserved;
+    };
+    static_assert(sizeof(MapFileOptions) == 96, "Unexpected padding in MapFileOptions");
+
+    struct MapFileComponent {
+        uint32_t inputDim;
+        uint32_t outputDim;
+        uint32_t numCoeffs;
+        uint32_t numTerms;
+        uint32_t numNz;
+        uint32_t reserved[3];
+        uint64_t nzStartsOffset;
+        uint64_t nzDimsOffset;
+        uint64_t nzOrdersOffset;
+        uint64_t maxDegreesOffset;
+    };
+    static_assert(sizeof(MapFileComponent) == 64, "Unexpected padding in MapFileComponent");
+
+    std::size_t AlignSection(std::size_t offset) {
+        return ((offset + sectionAlign - 1) / sectionAlign) * sectionAlign;
+    }
+
+    /** Keeps the mapping alive for as long as any component that points into it. */
+    struct MappedMapStorage {
+        MappedMapStorage(std::string const& filename) : file(filename, true) {}
+
+        MappedFile file;
+        std::vector<std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>>> comps;
+    };
+
+    /** Multiindex set of one component in the compressed form stored in the file. */
+    struct CompressedSet {
+        std::vector<uint32_t> nzStarts;
+        std::vector<uint32_t> nzDims;
+        std::vector<uint32_t> nzOrders;
+        std::vector<uint32_t> maxDegrees;
+    };
+}
+
+
+void mpart::SaveMappedMap(std::string const& filename,
+                          std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> const& map,
+                          MapOptions const& options)
+{
+    std::vector<std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>>> comps;
+    auto triMap = std::dynamic_pointer_cast<TriangularMap<Kokkos::HostSpace>>(map);
+    if(triMap){
+        for(unsigned int i=0; i<triMap->NumComponents(); ++i)
+            comps.push_back(triMap->GetComponent(i));
+    }else{
+        comps.push_back(map);
+    }
+
+    MapFileHeader header = {};
+    std::memcpy(header.magic, mapMagic, 8);
+    header.version = mapVersion;
+    header.numComps = comps.size();
+    header.inputDim = map->inputDim;
+    header.outputDim = map->outputDim;
+    header.isTriangular = (triMap != nullptr) ? 1 : 0;
+    header.numCoeffs = map->numCoeffs;
+
+    MapFileOptions opts = {};
+    opts.basisLB = options.basisLB;
+    opts.basisUB = options.basisUB;
+    opts.quadAbsTol = options.quadAbsTol;
+    opts.quadRelTol = options.quadRelTol;
+    opts.nugget = options.nugget;
+    opts.edgeShape = options.edgeShape;
+    opts.basisType = static_cast<uint32_t>(options.basisType);
+    opts.posFuncType = static_cast<uint32_t>(options.posFuncType);
+    opts.quadType = static_cast<uint32_t>(options.quadType);
+    opts.sigmoidType = static_cast<uint32_t>(options.sigmoidType);
+    opts.edgeType = static_cast<uint32_t>(options.edgeType);
+    opts.quadMaxSub = options.quadMaxSub;
+    opts.quadMinSub = options.quadMinSub;
+    opts.quadPts = options.quadPts;
+    opts.contDeriv = options.contDeriv ? 1 : 0;
+    opts.basisNorm = options.basisNorm ? 1 : 0;
+    opts.fixedDimWorker = options.fixedDimWorker ? 1 : 0;
+
+    // Lay out the sections
+    std::size_t offset = AlignSection(sizeof(MapFileHeader));
+    header.optionsOffset = offset;
+    offset = AlignSection(offset + sizeof(MapFileOptions));
+    header.tableOffset = offset;
+    offset = AlignSection(offset + comps.size()*sizeof(MapFileComponent));
+
+    std::vector<CompressedSet> sets(comps.size());
+    std::vector<MapFileComponent> table(comps.size());
+    for(unsigned int k=0; k<comps.size(); ++k){
+        auto const& comp = comps.at(k);
+
+        if(comp->Coeffs().extent(0) != comp->numCoeffs){
+            std::stringstream msg;
+            msg << "SaveMappedMap: The coefficients of component " << k << " have not been set.";
+            throw std::invalid_argument(msg.str());
+        }
+
+        FixedMultiIndexSet<Kokkos::HostSpace> mset(1,0);
+        try{
+            mset = comp->GetMultiIndexSet();
+        }catch(std::runtime_error const&){
+            std::stringstream msg;
+            msg << "SaveMappedMap: Component " << k << " was not created by MapFactory::CreateComponent and cannot be saved in the mapped format.";
+            throw std::invalid_argument(msg.str());
+        }
+
+        if((mset.Size() != comp->numCoeffs) || (mset.Length() != comp->inputDim) || (comp->outputDim != 1)){
+            std::stringstream msg;
+            msg << "SaveMappedMap: Component " << k << " has " << comp->numCoeffs << " coefficients, input dimension " << comp->inputDim;
+            msg << " and output dimension " << comp->outputDim << ", which does not match a monotone component with a multiindex set of size ";
+            msg << mset.Size() << " and dimension " << mset.Length() << ".";
+            throw std::invalid_argument(msg.str());
+        }
+
+        // Only the options are stored, so they must rebuild this exact component when the file is loaded
+        auto reference = MapFactory::CreateComponentWithoutCoeffs<Kokkos::HostSpace>(mset, options);
+        ConditionalMapBase<Kokkos::HostSpace> const& compRef = *comp;
+        ConditionalMapBase<Kokkos::HostSpace> const& referenceRef = *reference;
+        if(typeid(compRef) != typeid(referenceRef)){
+            std::stringstream msg;
+            msg << "SaveMappedMap: The options do not match component " << k << ".  They build a component with a different basis, ";
+            msg << "positive function or quadrature type.";
+            throw std::invalid_argument(msg.str());
+        }
+
+        // Values such as the basis bounds, nugget and quadrature settings are only visible through the evaluations
+        reference->WrapCoeffs(comp->Coeffs());
+        Kokkos::View<double**, Kokkos::HostSpace> checkPts("Option check points", comp->inputDim, numCheckPts);
+        for(unsigned int j=0; j<numCheckPts; ++j){
+            for(unsigned int d=0; d<comp->inputDim; ++d)
+                checkPts(d,j) = 0.9*std::sin(1.3*j + 0.7*d + 0.4);
+        }
+        StridedMatrix<const double, Kokkos::HostSpace> constPts = checkPts;
+        StridedMatrix<double, Kokkos::HostSpace> compEvals = comp->Evaluate(constPts);
+        StridedMatrix<double, Kokkos::HostSpace> referenceEvals = reference->Evaluate(constPts);
+        for(unsigned int j=0; j<numCheckPts; ++j){
+            if(std::abs(compEvals(0,j) - referenceEvals(0,j)) > optionCheckTol*(1.0 + std::abs(compEvals(0,j)))){
+                std::stringstream msg;
+                msg << "SaveMappedMap: The options do not match component " << k << ".  A component built with the options evaluates to ";
+                msg << referenceEvals(0,j) << " instead of " << compEvals(0,j) << " at a test point.";
+                throw std::invalid_argument(msg.str());
+            }
+        }
+
+        // Store the set in compressed form, regardless of how it is stored in memory
+        CompressedSet& set = sets.at(k);
+        set.nzStarts.push_back(0);
+        for(unsigned int term=0; term<mset.Size(); ++term){
+            std::vector<unsigned int> multi = mset.IndexToMulti(term);
+            for(unsigned int d=0; d<multi.size(); ++d){
+                if(multi.at(d) > 0){
+                    set.nzDims.push_back(d);
+                    set.nzOrders.push_back(multi.at(d));
+                }
+            }
+            set.nzStarts.push_back(set.nzDims.size());
+        }
+        auto maxDegrees = mset.MaxDegrees();
+        set.maxDegrees.assign(maxDegrees.data(), maxDegrees.data() + maxDegrees.extent(0));
+
+        MapFileComponent& entry = table.at(k);
+        entry.inputDim = comp->inputDim;
+        entry.outputDim = comp->outputDim;
+        entry.numCoeffs = comp->numCoeffs;
+        entry.numTerms = mset.Size();
+        entry.numNz = set.nzDims.size();
+
+        entry.nzStartsOffset = offset;
+        offset = AlignSection(offset + set.nzStarts.size()*sizeof(uint32_t));
+        entry.nzDimsOffset = offset;
+        offset = AlignSection(offset + set.nzDims.size()*sizeof(uint32_t));
+        entry.nzOrdersOffset = offset;
+        offset = AlignSection(offset + set.nzOrders.size()*sizeof(uint32_t));
+        entry.maxDegreesOffset = offset;
+        offset = AlignSection(offset + set.maxDegrees.size()*sizeof(uint32_t));
+    }
+    header.coeffsOffset = offset;
+
+    // Write the sections, padding with zeros up to the start of each one
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if(!out){
+        std::stringstream msg;
+        msg << "SaveMappedMap: Could not open file \"" << filename << "\" for writing.";
+        throw std::runtime_error(msg.str());
+    }
+
+    std::size_t written = 0;
+    const char zeros[sectionAlign] = {};
+    auto writeSection = [&](std::size_t start, const void* data, std::size_t bytes){
+        out.write(zeros, start - written);
+        out.write(static_cast<const char*>(data), bytes);
+        written = start + bytes;
+    };
+
+    writeSection(0, &header, sizeof(MapFileHeader));
+    writeSection(header.optionsOffset, &opts, sizeof(MapFileOptions));
+    writeSection(header.tableOffset, table.data(), table.size()*sizeof(MapFileComponent));
+    for(unsigned int k=0; k<comps.size(); ++k){
+        writeSection(table.at(k).nzStartsOffset, sets.at(k).nzStarts.data(), sets.at(k).nzStarts.size()*sizeof(uint32_t));
+        writeSection(table.at(k).nzDimsOffset, sets.at(k).nzDims.data(), sets.at(k).nzDims.size()*sizeof(uint32_t));
+        writeSection(table.at(k).nzOrdersOffset, sets.at(k).nzOrders.data(), sets.at(k).nzOrders.size()*sizeof(uint32_t));
+        writeSection(table.at(k).maxDegreesOffset, sets.at(k).maxDegrees.data(), sets.at(k).maxDegrees.size()*sizeof(uint32_t));
+    }
+    std::size_t coeffOffset = header.coeffsOffset;
+    for(auto const& comp : comps){
+        Kokkos::View<const double*, Kokkos::HostSpace> coeffs = comp->Coeffs();
+        writeSection(coeffOffset, coeffs.data(), coeffs.extent(0)*sizeof(double));
+        coeffOffset += coeffs.extent(0)*sizeof(double);
+    }
+
+    if(!out){
+        std::stringstream msg;
+        msg << "SaveMappedMap: Failed while writing to \"" << filename << "\".";
+        throw std::runtime_error(msg.str());
+    }
+}
+
+
+std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> mpart::LoadMappedMap(std::string const& filename)
+{
+    auto storage = std::make_shared<MappedMapStorage>(filename);
+    MappedFile const& file = storage->file;
+
+    auto fail = [&](std::string const& problem){
+        std::stringstream msg;
+        msg << "LoadMappedMap: File \"" << filename << "\" " << problem;
+        throw std::runtime_error(msg.str());
+    };
+
+    // Checks that a section lies inside the file and is aligned
+    auto checkSection = [&](uint64_t start, uint64_t bytes, std::string const& name){
+        if((start % sectionAlign != 0) || (start > file.Size()) || (bytes > file.Size() - start))
+            fail("has an invalid " + name + " section.");
+    };
+
+    if(file.Size() < sizeof(MapFileHeader))
+        fail("is too small to contain a map header.");
+
+    MapFileHeader header;
+    std::memcpy(&header, file.Data(), sizeof(MapFileHeader));
+    if((std::memcmp(header.magic, mapMagic, 8) != 0) || (header.version != mapVersion)){
+        std::stringstream msg;
+        msg << "is not a version " << mapVersion << " MParT map file.";
+        fail(msg.str());
+    }
+    if((header.numComps == 0) || ((header.isTriangular == 0) && (header.numComps != 1)))
+        fail("has an invalid number of components.");
+
+    checkSection(header.optionsOffset, sizeof(MapFileOptions), "options");
+    checkSection(header.tableOffset, uint64_t(header.numComps)*sizeof(MapFileComponent), "component table");
+    checkSection(header.coeffsOffset, header.numCoeffs*sizeof(double), "coefficient");
+
+    MapFileOptions opts;
+    std::memcpy(&opts, file.Data() + header.optionsOffset, sizeof(MapFileOptions));
+    if((opts.basisType > static_cast<uint32_t>(BasisTypes::HermiteFunctions)) ||
+       (opts.posFuncType > static_cast<uint32_t>(PosFuncTypes::Square)) ||
+       (opts.quadType > static_cast<uint32_t>(QuadTypes::AdaptiveGaussKronrod)) ||
+       (opts.sigmoidType > static_cast<uint32_t>(SigmoidTypes::Logistic)) ||
+       (opts.edgeType > static_cast<uint32_t>(EdgeTypes::SoftPlus)))
+        fail("has invalid map options.");
+
+    MapOptions options;
+    options.basisLB = opts.basisLB;
+    options.basisUB = opts.basisUB;
+    options.quadAbsTol = opts.quadAbsTol;
+    options.quadRelTol = opts.quadRelTol;
+    options.nugget = opts.nugget;
+    options.edgeShape = opts.edgeShape;
+    options.basisType = static_cast<BasisTypes>(opts.basisType);
+    options.posFuncType = static_cast<PosFuncTypes>(opts.posFuncType);
+    options.quadType = static_cast<QuadTypes>(opts.quadType);
+    options.sigmoidType = static_cast<SigmoidTypes>(opts.sigmoidType);
+    options.edgeType = static_cast<EdgeTypes>(opts.edgeType);
+    options.quadMaxSub = opts.quadMaxSub;
+    options.quadMinSub = opts.quadMinSub;
+    options.quadPts = opts.quadPts;
+    options.contDeriv = (opts.contDeriv != 0);
+    options.basisNorm = (opts.basisNorm != 0);
+    options.fixedDimWorker = (opts.fixedDimWorker != 0);
+
+    double* coeffs = reinterpret_cast<double*>(file.Data() + header.coeffsOffset);
+    uint64_t coeffStart = 0;
+
+    for(unsigned int k=0; k<header.numComps; ++k){
+        MapFileComponent entry;
+        std::memcpy(&entry, file.Data() + header.tableOffset + k*sizeof(MapFileComponent), sizeof(MapFileComponent));
+
+        std::string name = "component " + std::to_string(k);
+        checkSection(entry.nzStartsOffset, (uint64_t(entry.numTerms)+1)*sizeof(uint32_t), name + " nzStarts");
+        checkSection(entry.nzDimsOffset, uint64_t(entry.numNz)*sizeof(uint32_t), name + " nzDims");
+        checkSection(entry.nzOrdersOffset, uint64_t(entry.numNz)*sizeof(uint32_t), name + " nzOrders");
+        checkSection(entry.maxDegreesOffset, uint64_t(entry.inputDim)*sizeof(uint32_t), name + " maxDegrees");
+
+        if((entry.inputDim == 0) || (entry.outputDim != 1))
+            fail("has invalid dimensions for " + name + ".");
+
+        unsigned int* nzStartsPtr = reinterpret_cast<unsigned int*>(file.Data() + entry.nzStartsOffset);
+        unsigned int* nzDimsPtr = reinterpret_cast<unsigned int*>(file.Data() + entry.nzDimsOffset);
+        unsigned int* nzOrdersPtr = reinterpret_cast<unsigned int*>(file.Data() + entry.nzOrdersOffset);
+        unsigned int* maxDegreesPtr = reinterpret_cast<unsigned int*>(file.Data() + entry.maxDegreesOffset);
+
+        // The basis caches are sized and indexed with these arrays, so check them before building the set
+        if((nzStartsPtr[0] != 0) || (nzStartsPtr[entry.numTerms] != entry.numNz))
+            fail("has an inconsistent multiindex set for " + name + ".");
+        for(unsigned int term=0; term<entry.numTerms; ++term){
+            if(nzStartsPtr[term+1] < nzStartsPtr[term])
+                fail("has decreasing multiindex offsets for " + name + ".");
+        }
+
+        std::vector<unsigned int> observedDegrees(entry.inputDim, 0);
+        for(unsigned int i=0; i<entry.numNz; ++i){
+            if(nzDimsPtr[i] >= entry.inputDim)
+                fail("has a multiindex dimension out of range for " + name + ".");
+            observedDegrees[nzDimsPtr[i]] = std::max(observedDegrees[nzDimsPtr[i]], nzOrdersPtr[i]);
+        }
+        for(unsigned int d=0; d<entry.inputDim; ++d){
+            if(maxDegreesPtr[d] != observedDegrees[d])
+                fail("has maximum degrees that do not match the multiindex set for " + name + ".");
+        }
+
+        // These views point into the mapping and do not own their memory
+        Kokkos::View<unsigned int*, Kokkos::HostSpace> nzStarts(nzStartsPtr, entry.numTerms+1);
+        Kokkos::View<unsigned int*, Kokkos::HostSpace> nzDims(nzDimsPtr, entry.numNz);
+        Kokkos::View<unsigned int*, Kokkos::HostSpace> nzOrders(nzOrdersPtr, entry.numNz);
+        Kokkos::View<unsigned int*, Kokkos::HostSpace> maxDegrees(maxDegreesPtr, entry.inputDim);
+        FixedMultiIndexSet<Kokkos::HostSpace> mset(entry.inputDim, nzStarts, nzDims, nzOrders, maxDegrees);
+
+        // The component wraps the mapped coefficients below, so it does not need its own
+        auto comp = MapFactory::CreateComponentWithoutCoeffs<Kokkos::HostSpace>(mset, options);
+        if((comp->numCoeffs != entry.numCoeffs) || (coeffStart + entry.numCoeffs > header.numCoeffs))
+            fail("has an inconsistent number of coefficients for " + name + ".");
+
+        comp->WrapCoeffs(Kokkos::View<double*, Kokkos::HostSpace>(coeffs + coeffStart, entry.numCoeffs));
+        coeffStart += entry.numCoeffs;
+        storage->comps.push_back(comp);
+    }
+
+    if(coeffStart != header.numCoeffs)
+        fail("has an inconsistent number of coefficients.");
+
+    // Each returned pointer shares ownership of the storage, so the mapping outlives every view into it
+    if(header.isTriangular == 0)
+        return std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>>(storage, storage->comps.at(0).get());
+
+    std::vector<std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>>> comps;
+    for(auto const& comp : storage->comps)
+        comps.push_back(std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>>(storage, comp.get()));
+
+    auto output = std::make_shared<TriangularMap<Kokkos::HostSpace>>(comps, false);
+    output->WrapCoeffs(Kokkos::View<double*, Kokkos::HostSpace>(coeffs, header.numCoeffs));
+    return output;
+}
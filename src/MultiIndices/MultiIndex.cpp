@@ -248,6 +248,25 @@ bool MultiIndex::HasNonzeroEnd() const{
   return (nzInds.size() > 0) && (nzInds.back() == length - 1);
 }
 
+uint64_t MultiIndex::Hash() const{
+
+  // Mixes each (index,value) pair with the finalizer of the splitmix64 generator
+  auto mix = [](uint64_t x){
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+  };
+
+  uint64_t hash = mix(0x9e3779b97f4a7c15ull + length);
+  for(unsigned int i=0; i<nzInds.size(); ++i)
+    hash = mix(hash ^ ((uint64_t(nzInds[i]) << 32) | uint64_t(nzVals[i])));
+
+  return hash;
+}
+
 std::string MultiIndex::String() const {
   std::string out;
   for(unsigned int i=0; i<Length(); ++i){
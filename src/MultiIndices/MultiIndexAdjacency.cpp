@@ -0,0 +1,47 @@
+#include "MParT/MultiIndices/MultiIndexAdjacency.h"
+
+#include <algorithm>
+
+using namespace mpart;
+
+bool MultiIndexAdjacency::Insert(unsigned int node, int neighbor)
+{
+  Slab& slab = slabs.at(node);
+
+  int* first = data.data() + slab.start;
+  int* pos = std::lower_bound(first, first+slab.size, neighbor);
+  if((pos!=first+slab.size) && (*pos==neighbor))
+    return false;
+
+  unsigned int offset = pos - first;
+
+  // Move a full slab to the end of the array with twice the capacity
+  if(slab.size==slab.capacity){
+    unsigned int newCapacity = std::max<unsigned int>(4, 2*slab.capacity);
+    unsigned int newStart = data.size();
+    data.resize(newStart + newCapacity);
+    std::copy(data.begin()+slab.start, data.begin()+slab.start+slab.size, data.begin()+newStart);
+    slab.start = newStart;
+    slab.capacity = newCapacity;
+  }
+
+  first = data.data() + slab.start;
+  std::copy_backward(first+offset, first+slab.size, first+slab.size+1);
+  first[offset] = neighbor;
+  slab.size++;
+  return true;
+}
+
+bool MultiIndexAdjacency::Erase(unsigned int node, int neighbor)
+{
+  Slab& slab = slabs.at(node);
+
+  int* first = data.data() + slab.start;
+  int* pos = std::lower_bound(first, first+slab.size, neighbor);
+  if((pos==first+slab.size) || (*pos!=neighbor))
+    return false;
+
+  std::copy(pos+1, first+slab.size, pos);
+  slab.size--;
+  return true;
+}
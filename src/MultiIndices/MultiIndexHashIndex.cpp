@@ -0,0 +1,54 @@
+#include "MParT/MultiIndices/MultiIndexHashIndex.h"
+
+using namespace mpart;
+
+int MultiIndexHashIndex::Find(MultiIndex const& multi, std::vector<MultiIndex> const& keys) const
+{
+  if(numEntries==0)
+    return -1;
+
+  const uint64_t hash = multi.Hash();
+  const std::size_t mask = slots.size()-1;
+
+  for(std::size_t pos = hash & mask; ; pos = (pos+1) & mask){
+    Slot const& slot = slots[pos];
+    if(slot.index<0)
+      return -1;
+    if((slot.hash==hash) && (keys[slot.index]==multi))
+      return slot.index;
+  }
+}
+
+void MultiIndexHashIndex::Insert(MultiIndex const& multi, unsigned int index)
+{
+  // Keep the load factor below 1/2 so probe sequences stay short
+  if(2*(numEntries+1) > slots.size())
+    Rehash(slots.empty() ? 16 : 2*slots.size());
+
+  const uint64_t hash = multi.Hash();
+  const std::size_t mask = slots.size()-1;
+
+  std::size_t pos = hash & mask;
+  while(slots[pos].index>=0)
+    pos = (pos+1) & mask;
+
+  slots[pos].hash = hash;
+  slots[pos].index = index;
+  numEntries++;
+}
+
+void MultiIndexHashIndex::Rehash(std::size_t newCapacity)
+{
+  std::vector<Slot> oldSlots(newCapacity, Slot{0,-1});
+  std::swap(slots, oldSlots);
+
+  const std::size_t mask = slots.size()-1;
+  for(Slot const& slot : oldSlots){
+    if(slot.index>=0){
+      std::size_t pos = slot.hash & mask;
+      while(slots[pos].index>=0)
+        pos = (pos+1) & mask;
+      slots[pos] = slot;
+    }
+  }
+}
@@ -200,8 +200,8 @@ void MultiIndexSet::SetLimiter(LimiterType const& newLimiter){
 
       if(!newLimiter(allMultis.at(globalInd))){
         for(int inNode : inEdges[globalInd])
-          outEdges[inNode].erase(globalInd);
-        inEdges[globalInd].clear();
+          outEdges.Erase(inNode, globalInd);
+        inEdges.Clear(globalInd);
       }
     }
   }
@@ -211,10 +211,10 @@ void MultiIndexSet::SetLimiter(LimiterType const& newLimiter){
 
 int MultiIndexSet::MultiToIndex(MultiIndex const& input) const{
 
-  auto localIter = multi2global.find(input);
+  int globalInd = multi2global.Find(input, allMultis);
 
-  if(localIter!=multi2global.end()){
-    return global2active[localIter->second];
+  if(globalInd>=0){
+    return global2active[globalInd];
   }else{
     return -1;
   }
@@ -226,12 +226,12 @@ int MultiIndexSet::AddMulti(MultiIndex const& newMulti)
   allMultis.push_back(newMulti);
 
   int globalInd = allMultis.size() - 1;
-  multi2global[allMultis.back()] = globalInd;
+  multi2global.Insert(allMultis.back(), globalInd);
 
   global2active.push_back(-1);
 
-  inEdges.push_back(std::set<int>());
-  outEdges.push_back(std::set<int>());
+  inEdges.AddNode();
+  outEdges.AddNode();
 
   assert(allMultis.size() == global2active.size());
 
@@ -259,10 +259,10 @@ int MultiIndexSet::AddActive(MultiIndex const& newNode)
 
 int MultiIndexSet::AddInactive(MultiIndex const& newNode)
 {
-  auto iter = multi2global.find(newNode);
+  int globalInd = multi2global.Find(newNode, allMultis);
 
-  if(iter!=multi2global.end()){
-    return iter->second;
+  if(globalInd>=0){
+    return globalInd;
 
   }else if(limiter(newNode)){
     return AddMulti(newNode);
@@ -274,10 +274,10 @@ int MultiIndexSet::AddInactive(MultiIndex const& newNode)
 
 bool MultiIndexSet::IsActive(MultiIndex const& multiIndex) const
 {
-  auto iter = multi2global.find(multiIndex);
+  int globalInd = multi2global.Find(multiIndex, allMultis);
 
-  if(iter!=multi2global.end()){
-    return IsActive(iter->second);
+  if(globalInd>=0){
+    return IsActive(globalInd);
   }else{
     return false;
   }
@@ -314,12 +314,12 @@ bool MultiIndexSet::IsAdmissible(unsigned int globalIndex) const
 
 bool MultiIndexSet::IsAdmissible(MultiIndex const& multiIndex) const
 {
-  auto iter = multi2global.find(multiIndex);
+  int globalInd = multi2global.Find(multiIndex, allMultis);
 
-  if(iter==multi2global.end()){
+  if(globalInd<0){
     return false;
   }else{
-    return IsAdmissible(iter->second);
+    return IsAdmissible(globalInd);
   }
 }
 
@@ -362,12 +362,12 @@ void MultiIndexSet::Activate(int globalIndex)
 
 void MultiIndexSet::Activate(MultiIndex const& multiIndex)
 {
-  auto iter = multi2global.find(multiIndex);
+  int globalInd = multi2global.Find(multiIndex, allMultis);
 
-  assert(iter!=multi2global.end());
-  assert(IsAdmissible(iter->second));
+  assert(globalInd>=0);
+  assert(IsAdmissible(globalInd));
 
-  Activate(iter->second);
+  Activate(globalInd);
 }
 
 void MultiIndexSet::AddForwardNeighbors(unsigned int globalIndex, bool addInactive)
@@ -381,10 +381,10 @@ void MultiIndexSet::AddForwardNeighbors(unsigned int globalIndex, bool addInacti
     if(limiter(multi)){
 
       // Check to see if we already have this multiindex...
-      auto iter = multi2global.find(multi);
-      if(iter!=multi2global.end()){
-        inEdges.at(iter->second).insert(globalIndex);
-        outEdges.at(globalIndex).insert(iter->second);
+      int neighborInd = multi2global.Find(multi, allMultis);
+      if(neighborInd>=0){
+        inEdges.Insert(neighborInd, globalIndex);
+        outEdges.Insert(globalIndex, neighborInd);
 
       // If not, add it
       }else if(addInactive){
@@ -621,11 +621,10 @@ std::vector<unsigned int> MultiIndexSet::BackwardNeighbors(unsigned int activeIn
 
 std::vector<unsigned int> MultiIndexSet::BackwardNeighbors(MultiIndex const& multiIndex) const
 {
-  auto iter = multi2global.find(multiIndex);
+  int globalInd = multi2global.Find(multiIndex, allMultis);
 
-  assert(iter!=multi2global.end());
+  assert(globalInd>=0);
 
-  unsigned int globalInd = iter->second;
   std::vector<unsigned int> output;
   for(auto neighbor : inEdges[globalInd])
     output.push_back(global2active.at(neighbor));
@@ -650,7 +649,7 @@ unsigned int MultiIndexSet::NumActiveForward(unsigned int activeInd) const
 unsigned int MultiIndexSet::NumForward(unsigned int activeInd) const
 {
   unsigned int globalInd = active2global.at(activeInd);
-  return outEdges[globalInd].size();
+  return outEdges.at(globalInd).size();
 }
 
 void MultiIndexSet::AddBackwardNeighbors(unsigned int globalIndex, bool addInactive)
@@ -662,10 +661,10 @@ void MultiIndexSet::AddBackwardNeighbors(unsigned int globalIndex, bool addInact
     if(limiter(multi)){
 
       // Check to see if we already have this multiindex in the set
-      auto iter = multi2global.find(multi);
-      if(iter!=multi2global.end()){
-        outEdges.at(iter->second).insert(globalIndex);
-        inEdges.at(globalIndex).insert(iter->second);
+      int neighborInd = multi2global.Find(multi, allMultis);
+      if(neighborInd>=0){
+        outEdges.Insert(neighborInd, globalIndex);
+        inEdges.Insert(globalIndex, neighborInd);
 
       // If not, add it
       }else if(addInactive){
@@ -688,7 +687,7 @@ std::vector<unsigned int> MultiIndexSet::Expand(unsigned int activeIndex)
   unsigned int globalIndex = active2global.at(activeIndex);
 
   // loop through the forward neighbors of this index
-  std::set<int> tempSet = outEdges.at(globalIndex);
+  std::vector<int> tempSet = outEdges.Copy(globalIndex);
   for(int neighbor : tempSet)
   { 
     if(IsAdmissible(neighbor)&&(!IsActive(neighbor))){
@@ -712,7 +711,7 @@ std::vector<unsigned int> MultiIndexSet::Expand()
         unsigned int globalIndex = active2global.at(ind);
 
         // loop through the forward neighbors of this index
-        std::set<int> tempSet = outEdges.at(globalIndex);
+        std::vector<int> tempSet = outEdges.Copy(globalIndex);
         for(int neighbor : tempSet)
         { 
             if(IsAdmissible(neighbor)&&(!IsActive(neighbor))){
@@ -739,7 +738,7 @@ std::vector<unsigned int> MultiIndexSet::ForciblyExpand(unsigned int const activ
   unsigned int globalIndex = active2global.at(activeIndex);
 
   // loop through the forward neighbors of this index
-  std::set<int>& tempSet = outEdges.at(globalIndex);
+  std::vector<int> tempSet = outEdges.Copy(globalIndex);
   for(int neighbor : tempSet)
     ForciblyActivate(neighbor,newIndices);
 
@@ -758,7 +757,7 @@ void MultiIndexSet::ForciblyActivate(int globalIndex, std::vector<unsigned int>
     newIndices.push_back(global2active.at(globalIndex));
 
     // now, fill in all of the previous neighbors
-    std::set<int>& tempSet = inEdges.at(globalIndex);
+    std::vector<int> tempSet = inEdges.Copy(globalIndex);
     for(int ind : tempSet)
       ForciblyActivate(ind,newIndices);
 
@@ -769,12 +768,12 @@ std::vector<unsigned int> MultiIndexSet::ForciblyActivate(MultiIndex const& mult
 
   assert(limiter(multiIndex));
 
-  auto iter = multi2global.find(multiIndex);
+  int globalInd = multi2global.Find(multiIndex, allMultis);
   std::vector<unsigned int> newIndices;
 
   // if we found the multiindex and it is active, there is nothing to do
-  if(iter!=multi2global.end()){
-    ForciblyActivate(iter->second,newIndices);
+  if(globalInd>=0){
+    ForciblyActivate(globalInd,newIndices);
   }else{
     // Add the new index as an active node
     int newGlobalInd = AddInactive(multiIndex);
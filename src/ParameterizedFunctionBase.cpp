@@ -28,7 +28,7 @@ StridedMatrix<double, Kokkos::HostSpace> ParameterizedFunctionBase<Kokkos::HostS
     CheckCoefficients("Evaluate");
 
     Kokkos::View<double**, Kokkos::HostSpace> output("Map Evaluations", outputDim, pts.extent(1));
-    EvaluateImpl(pts, output);
+    EvaluateChunked(pts, output);
     return output;
 }
 
@@ -40,7 +40,7 @@ Eigen::RowMatrixXd ParameterizedFunctionBase<Kokkos::HostSpace>::Evaluate(Eigen:
     Eigen::RowMatrixXd output(outputDim, pts.cols());
     StridedMatrix<const double, Kokkos::HostSpace> ptsView = ConstRowMatToKokkos<double,Kokkos::HostSpace>(pts);
     StridedMatrix<double, Kokkos::HostSpace> outView = MatToKokkos<double,Kokkos::HostSpace>(output);
-    EvaluateImpl(ptsView, outView);
+    EvaluateChunked(ptsView, outView);
     return output;
 }
 
@@ -53,7 +53,7 @@ StridedMatrix<double, mpart::DeviceSpace> ParameterizedFunctionBase<mpart::Devic
     CheckCoefficients("Evaluate");
 
     Kokkos::View<double**, mpart::DeviceSpace> output("Map Evaluations", outputDim, pts.extent(1));
-    EvaluateImpl(pts, output);
+    EvaluateChunked(pts, output);
     return output;
 }
 
@@ -107,7 +107,7 @@ StridedMatrix<double, Kokkos::HostSpace> ParameterizedFunctionBase<Kokkos::HostS
     CheckCoefficients("Gradient");
 
     Kokkos::View<double**, Kokkos::HostSpace> output("Gradients", inputDim, pts.extent(1));
-    GradientImpl(pts, sens, output);
+    GradientChunked(pts, sens, output);
     return output;
 }
 
@@ -120,7 +120,7 @@ Eigen::RowMatrixXd ParameterizedFunctionBase<Kokkos::HostSpace>::Gradient(Eigen:
     StridedMatrix<const double, Kokkos::HostSpace> ptsView = ConstRowMatToKokkos<double,Kokkos::HostSpace>(pts);
     StridedMatrix<const double, Kokkos::HostSpace> sensView = ConstRowMatToKokkos<double,Kokkos::HostSpace>(sens);
     StridedMatrix<double, Kokkos::HostSpace> outView = MatToKokkos<double,Kokkos::HostSpace>(output);
-    GradientImpl(ptsView, sensView, outView);
+    GradientChunked(ptsView, sensView, outView);
     return output;
 }
 
@@ -133,7 +133,7 @@ StridedMatrix<double, mpart::DeviceSpace> ParameterizedFunctionBase<mpart::Devic
     CheckCoefficients("Gradient");
 
     Kokkos::View<double**, mpart::DeviceSpace> output("Map Evaluations", outputDim, pts.extent(1));
-    GradientImpl(pts, sens, output);
+    GradientChunked(pts, sens, output);
     return output;
 }
 
@@ -271,7 +271,7 @@ StridedMatrix<double, Kokkos::HostSpace> ParameterizedFunctionBase<Kokkos::HostS
 {
     CheckCoefficients("CoeffGrad");
     Kokkos::View<double**, Kokkos::HostSpace> output("Coeff Grad", numCoeffs, pts.extent(1));
-    CoeffGradImpl(pts,sens, output);
+    CoeffGradChunked(pts,sens, output);
     return output;
 }
 
@@ -296,7 +296,7 @@ StridedMatrix<double, mpart::DeviceSpace> ParameterizedFunctionBase<mpart::Devic
 {
     CheckCoefficients("CoeffGrad");
     Kokkos::View<double**, mpart::DeviceSpace> output("Coeff Grad", numCoeffs, pts.extent(1));
-    CoeffGradImpl(pts,sens, output);
+    CoeffGradChunked(pts,sens, output);
     return output;
 }
 
@@ -347,6 +347,35 @@ bool ParameterizedFunctionBase<MemorySpace>::CheckCoefficients() const
 }
 
 
+template<typename MemorySpace>
+void ParameterizedFunctionBase<MemorySpace>::EvaluateChunked(StridedMatrix<const double, MemorySpace> const& pts,
+                                                             StridedMatrix<double, MemorySpace>              output)
+{
+    ForEachChunk(pts.extent(1), [&](std::pair<unsigned int, unsigned int> cols){
+        EvaluateImpl(Kokkos::subview(pts, Kokkos::ALL(), cols), Kokkos::subview(output, Kokkos::ALL(), cols));
+    });
+}
+
+template<typename MemorySpace>
+void ParameterizedFunctionBase<MemorySpace>::GradientChunked(StridedMatrix<const double, MemorySpace> const& pts,
+                                                             StridedMatrix<const double, MemorySpace> const& sens,
+                                                             StridedMatrix<double, MemorySpace>              output)
+{
+    ForEachChunk(pts.extent(1), [&](std::pair<unsigned int, unsigned int> cols){
+        GradientImpl(Kokkos::subview(pts, Kokkos::ALL(), cols), Kokkos::subview(sens, Kokkos::ALL(), cols), Kokkos::subview(output, Kokkos::ALL(), cols));
+    });
+}
+
+template<typename MemorySpace>
+void ParameterizedFunctionBase<MemorySpace>::CoeffGradChunked(StridedMatrix<const double, MemorySpace> const& pts,
+                                                              StridedMatrix<const double, MemorySpace> const& sens,
+                                                              StridedMatrix<double, MemorySpace>              output)
+{
+    ForEachChunk(pts.extent(1), [&](std::pair<unsigned int, unsigned int> cols){
+        CoeffGradImpl(Kokkos::subview(pts, Kokkos::ALL(), cols), Kokkos::subview(sens, Kokkos::ALL(), cols), Kokkos::subview(output, Kokkos::ALL(), cols));
+    });
+}
+
 template<typename MemorySpace>
 void ParameterizedFunctionBase<MemorySpace>::CheckCoefficients(std::string const& functionName) const
 {
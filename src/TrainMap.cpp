@@ -1,5 +1,10 @@
 #include <map>
+#include <chrono>
+#include <random>
+#include <numeric>
+#include <algorithm>
 #include "MParT/TrainMap.h"
+#include "MParT/TriangularMap.h"
 
 using namespace mpart;
 
@@ -56,6 +61,120 @@ nlopt::opt SetupOptimization(unsigned int dim, TrainOptions options) {
     return opt;
 }
 
+bool IsStochasticAlgorithm(std::string const& alg) {
+    return (alg == "SGD") || (alg == "ADAM");
+}
+
+double TrainMapStochastic(std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> map, std::shared_ptr<MapObjective<Kokkos::HostSpace>> objective, TrainOptions options) {
+    StridedMatrix<const double, Kokkos::HostSpace> train = objective->GetTrain();
+    unsigned int dim = train.extent(0);
+    unsigned int numPts = train.extent(1);
+    unsigned int numCoeffs = map->numCoeffs;
+    bool useAdam = (options.opt_alg == "ADAM");
+
+    unsigned int batchSize = options.opt_batch_size;
+    if((batchSize == 0) || (batchSize > numPts))
+        batchSize = numPts;
+
+    if(options.opt_learning_rate <= 0.) {
+        std::stringstream msg;
+        msg << "TrainMap: opt_learning_rate must be positive for stochastic optimization, but given " << options.opt_learning_rate << ".";
+        throw std::invalid_argument(msg.str());
+    }
+
+    if(options.verbose){
+        std::cout << "Optimization Settings:\n";
+        std::cout << "Algorithm: " << options.opt_alg << " (mini-batch)\n";
+        std::cout << "Optimization dimension: " << numCoeffs << "\n";
+        std::cout << "Batch size: " << batchSize << "\n";
+        std::cout << "Epochs: " << options.opt_epochs << "\n";
+        std::cout << "Learning rate: " << options.opt_learning_rate << "\n";
+        std::cout << "Learning rate decay: " << options.opt_lr_decay << "\n";
+        std::cout << "Maximum time: " << options.opt_maxtime << "\n";
+    }
+
+    // The coefficients are updated in place so that components wrapping subviews see the new values
+    Kokkos::View<double*, Kokkos::HostSpace> coeffs = map->Coeffs();
+    Kokkos::View<double*, Kokkos::HostSpace> grad("Mini-batch gradient", numCoeffs);
+    Kokkos::View<double*, Kokkos::HostSpace> moment1("First moment", numCoeffs);
+    Kokkos::View<double*, Kokkos::HostSpace> moment2("Second moment", numCoeffs);
+
+    // Storage for the current mini-batch, which is gathered from a shuffled ordering of the training set
+    Kokkos::View<double**, Kokkos::HostSpace> batch("Mini-batch", dim, batchSize);
+    Kokkos::View<unsigned int*, Kokkos::HostSpace> perm("Sample permutation", numPts);
+    std::iota(perm.data(), perm.data() + numPts, 0u);
+    std::mt19937 rng(options.opt_seed);
+
+    const double beta1 = options.opt_beta1;
+    const double beta2 = options.opt_beta2;
+    const double eps = 1e-8;
+    unsigned int numSteps = 0;
+    double epochError = std::numeric_limits<double>::infinity();
+    auto startTime = std::chrono::steady_clock::now();
+    bool outOfTime = false;
+
+    for(unsigned int epoch = 0; (epoch < options.opt_epochs) && (!outOfTime); ++epoch) {
+        std::shuffle(perm.data(), perm.data() + numPts, rng);
+        const double stepSize = options.opt_learning_rate / (1.0 + options.opt_lr_decay*epoch);
+
+        double errorSum = 0.;
+        unsigned int errorPts = 0;
+        for(unsigned int batchStart = 0; batchStart < numPts; batchStart += batchSize) {
+            unsigned int currSize = std::min(batchSize, numPts - batchStart);
+            StridedMatrix<double, Kokkos::HostSpace> currBatch = Kokkos::subview(batch, Kokkos::ALL(), std::make_pair(0u, currSize));
+
+            Kokkos::parallel_for("Gather mini-batch", currSize, KOKKOS_LAMBDA(const unsigned int j){
+                for(unsigned int i = 0; i < dim; ++i)
+                    currBatch(i,j) = train(i, perm(batchStart + j));
+            });
+
+            double batchError = objective->ObjectivePlusCoeffGradImpl(currBatch, grad, map);
+            errorSum += batchError*currSize;
+            errorPts += currSize;
+            numSteps++;
+
+            if(useAdam) {
+                const double corr1 = 1.0 - std::pow(beta1, numSteps);
+                const double corr2 = 1.0 - std::pow(beta2, numSteps);
+                Kokkos::parallel_for("ADAM update", numCoeffs, KOKKOS_LAMBDA(const unsigned int i){
+                    moment1(i) = beta1*moment1(i) + (1.0-beta1)*grad(i);
+                    moment2(i) = beta2*moment2(i) + (1.0-beta2)*grad(i)*grad(i);
+                    coeffs(i) -= stepSize*(moment1(i)/corr1) / (std::sqrt(moment2(i)/corr2) + eps);
+                });
+            } else {
+                Kokkos::parallel_for("SGD update", numCoeffs, KOKKOS_LAMBDA(const unsigned int i){
+                    coeffs(i) -= stepSize*grad(i);
+                });
+            }
+            Kokkos::fence();
+
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+            if(elapsed.count() > options.opt_maxtime) {
+                outOfTime = true;
+                break;
+            }
+        }
+        epochError = errorSum / errorPts;
+
+        if(options.verbose > 1) {
+            std::cout << "Epoch " << epoch << ": mean mini-batch error = " << epochError << ", step size = " << stepSize << "\n";
+        }
+    }
+
+    if(!std::isfinite(epochError)) {
+        std::cerr << "WARNING: Optimization failed: mini-batch objective is not finite" << std::endl;
+    }
+
+    if(options.verbose){
+        if(outOfTime) {
+            std::cout << "Optimization result: maxtime reached\n";
+        }
+        std::cout << "Optimization error: " << epochError << "\n";
+        std::cout << "Optimization steps: " << numSteps << std::endl;
+    }
+    return epochError;
+}
+
 template<>
 double mpart::TrainMap(std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> map, std::shared_ptr<MapObjective<Kokkos::HostSpace>> objective, TrainOptions options) {
     if(map->Coeffs().extent(0) == 0) {
@@ -68,6 +187,10 @@ double mpart::TrainMap(std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> ma
         });
         map->SetCoeffs(coeffs);
     }
+
+    if(IsStochasticAlgorithm(options.opt_alg))
+        return TrainMapStochastic(map, objective, options);
+
     nlopt::opt opt = SetupOptimization(map->numCoeffs, options);
 
     // Since objective is (rightfully) separate from the map, we use std::bind to create a functor
@@ -101,3 +224,58 @@ double mpart::TrainMap(std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> ma
     }
     return error;
 }
+
+template<>
+double mpart::TrainMapComponentwise(std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> map, std::shared_ptr<MapObjective<Kokkos::HostSpace>> objective, TrainOptions options) {
+
+    auto triMap = std::dynamic_pointer_cast<TriangularMap<Kokkos::HostSpace>>(map);
+    auto klObjective = std::dynamic_pointer_cast<KLObjective<Kokkos::HostSpace>>(objective);
+    if((triMap == nullptr) || (klObjective == nullptr) || (!klObjective->IsSeparable()) || (triMap->NumComponents() < 2)) {
+        if(options.verbose) {
+            std::cout << "TrainMapComponentwise: Objective does not separate over map components, training jointly." << std::endl;
+        }
+        return TrainMap(map, objective, options);
+    }
+
+    if(map->Coeffs().extent(0) == 0) {
+        if(options.verbose) {
+            std::cout << "TrainMapComponentwise: Initializing map coeffs to 1." << std::endl;
+        }
+        Kokkos::View<double*, Kokkos::HostSpace> coeffs ("Default coeffs", map->numCoeffs);
+        Kokkos::deep_copy(coeffs, 1.0);
+        map->SetCoeffs(coeffs);
+    }
+
+    // Set up an independent problem for each block, which sees the first N_k rows of the data and the marginal reference of its outputs
+    unsigned int numComps = triMap->NumComponents();
+    std::vector<std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>>> comps(numComps);
+    std::vector<std::shared_ptr<MapObjective<Kokkos::HostSpace>>> compObjectives(numComps);
+    unsigned int startOutDim = 0;
+    for(unsigned int k = 0; k < numComps; ++k) {
+        comps[k] = triMap->GetComponent(k);
+        compObjectives[k] = klObjective->MarginalObjective(comps[k]->inputDim, startOutDim, comps[k]->outputDim);
+        startOutDim += comps[k]->outputDim;
+    }
+
+    // Train the blocks one after another.  Each block's kernels already run in parallel over the training points, and
+    // Kokkos does not support dispatching kernels to the default host execution space from several threads at once.
+    std::vector<double> compErrors(numComps, 0.0);
+    for(unsigned int k = 0; k < numComps; ++k) {
+        if(options.verbose) {
+            std::cout << "TrainMapComponentwise: Training component " << k << "." << std::endl;
+        }
+        compErrors[k] = TrainMap(comps[k], compObjectives[k], options);
+    }
+
+    double error = 0.0;
+    for(unsigned int k = 0; k < numComps; ++k) {
+        if(options.verbose) {
+            std::cout << "Component " << k << " optimization error: " << compErrors[k] << "\n";
+        }
+        error += compErrors[k];
+    }
+    if(options.verbose) {
+        std::cout << "Optimization error: " << error << std::endl;
+    }
+    return error;
+}
@@ -1,5 +1,6 @@
 #include "MParT/TrainMapAdaptive.h"
 #include <fstream>
+#include <numeric>
 
 using namespace mpart;
 
@@ -129,6 +130,24 @@ std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> mpart::TrainMapAdaptive(s
     TrainMap(map, objective, options);
     double bestError = objective->TestError(map);
 
+    // When the objective splits over the components, each component has its own objective term.  The frontier gradient
+    // and errors of a component then only change when that component is expanded, so they are cached between iterations.
+    auto klObjective = std::dynamic_pointer_cast<KLObjective<Kokkos::HostSpace>>(objective);
+    bool separable = (klObjective != nullptr) && klObjective->IsSeparable();
+    std::vector<std::shared_ptr<MapObjective<Kokkos::HostSpace>>> blockObjectives (outputDim);
+    std::vector<Kokkos::View<double*, Kokkos::HostSpace>> blockGrads (outputDim);
+    std::vector<std::vector<unsigned int>> blockRMs (outputDim);
+    std::vector<bool> blockGradValid (outputDim, false);
+    std::vector<double> blockTrainErrors (outputDim);
+    std::vector<double> blockTestErrors (outputDim);
+    if(separable) {
+        for(unsigned int j = 0; j < outputDim; j++) {
+            blockObjectives[j] = klObjective->MarginalObjective(mapBlocks[j]->inputDim, j, 1);
+            blockTrainErrors[j] = blockObjectives[j]->TrainError(mapBlocks[j]);
+            blockTestErrors[j] = blockObjectives[j]->TestError(mapBlocks[j]);
+        }
+    }
+
     if(options.verbose) {
         std::cout << "Initial map test error: " << bestError << std::endl;
     }
@@ -140,6 +159,12 @@ std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> mpart::TrainMapAdaptive(s
         }
 
         for(int i = 0; i < outputDim; i++) {
+            // Reuse the frontier of components that have not changed since the last iteration
+            if(separable && blockGradValid[i]) {
+                multis_rm[i] = blockRMs[i];
+                continue;
+            }
+
             // Expand the current map
             mset_tmp[i] = mset0[i];
             multis_rm[i] = mset_tmp[i].Expand();
@@ -162,11 +187,34 @@ std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> mpart::TrainMapAdaptive(s
             comp_i->WrapCoeffs(coeffsFrontier);
             // Set the new component
             mapBlocksTmp[i] = comp_i;
+
+            if(separable) {
+                blockGrads[i] = Kokkos::View<double*, Kokkos::HostSpace>("Frontier gradient", comp_i->numCoeffs);
+                blockObjectives[i]->TrainCoeffGradImpl(comp_i, blockGrads[i]);
+                blockRMs[i] = multis_rm[i];
+                blockGradValid[i] = true;
+            }
         }
-        // Create a temporary map
-        std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> mapTmp = std::make_shared<TriangularMap<Kokkos::HostSpace>>(mapBlocksTmp, true);
+
         // Calculate the gradient of the map with expanded margins
-        StridedVector<double, Kokkos::HostSpace> gradCoeff = objective->TrainCoeffGrad(mapTmp);
+        StridedVector<double, Kokkos::HostSpace> gradCoeff;
+        if(separable) {
+            unsigned int frontierSize = 0;
+            for(int i = 0; i < outputDim; i++) {
+                frontierSize += blockGrads[i].extent(0);
+            }
+            Kokkos::View<double*, Kokkos::HostSpace> frontierGrad ("Frontier gradient", frontierSize);
+            unsigned int blockStart = 0;
+            for(int i = 0; i < outputDim; i++) {
+                std::copy(blockGrads[i].data(), blockGrads[i].data() + blockGrads[i].extent(0), frontierGrad.data() + blockStart);
+                blockStart += blockGrads[i].extent(0);
+            }
+            gradCoeff = frontierGrad;
+        } else {
+            // Create a temporary map
+            std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> mapTmp = std::make_shared<TriangularMap<Kokkos::HostSpace>>(mapBlocksTmp, true);
+            gradCoeff = objective->TrainCoeffGrad(mapTmp);
+        }
         int coeffIdx = 0;
         if(options.verbose > 1) {
             for(int output=0; output<outputDim; output++){
@@ -217,10 +265,20 @@ std::shared_ptr<ConditionalMapBase<Kokkos::HostSpace>> mpart::TrainMapAdaptive(s
         mset_sizes[maxIdxBlock]++;
         map = std::make_shared<TriangularMap<Kokkos::HostSpace>>(mapBlocks, true);
 
-        // Train a map with the new MultiIndex
-        double train_error = TrainMap(map, objective, options);
-        // Get the testing error and assess the best map
-        double test_error = objective->TestError(map);
+        double train_error, test_error;
+        if(separable) {
+            // Only the expanded component changes, so train it alone against its own objective term
+            blockTrainErrors[maxIdxBlock] = TrainMap(mapBlocks[maxIdxBlock], blockObjectives[maxIdxBlock], options);
+            blockTestErrors[maxIdxBlock] = blockObjectives[maxIdxBlock]->TestError(mapBlocks[maxIdxBlock]);
+            blockGradValid[maxIdxBlock] = false;
+            train_error = std::accumulate(blockTrainErrors.begin(), blockTrainErrors.end(), 0.);
+            test_error = std::accumulate(blockTestErrors.begin(), blockTestErrors.end(), 0.);
+        } else {
+            // Train a map with the new MultiIndex
+            train_error = TrainMap(map, objective, options);
+            // Get the testing error and assess the best map
+            test_error = objective->TestError(map);
+        }
 
         // Finish this step
         currPatience++;
@@ -2,6 +2,7 @@
 
 #include "MParT/Utilities/KokkosSpaceMappings.h"
 
+#include <algorithm>
 #include <numeric>
 
 using namespace mpart;
@@ -58,6 +59,45 @@ TriangularMap<MemorySpace>::TriangularMap(std::vector<std::shared_ptr<Conditiona
 
         this->WrapCoeffs(coeffs);
     }
+
+    // If all components use the same 1d basis, tabulate it once per point for all of them.  The table holds the
+    // largest degree used by any component in each of the first inputDim-1 inputs.
+    bool canShare = (comps_.size()>1);
+    for(unsigned int i=1; (i<comps_.size()) && canShare; ++i)
+        canShare = comps_.at(i)->CanShareBasis(*comps_.at(0)) && comps_.at(0)->CanShareBasis(*comps_.at(i));
+
+    if(canShare){
+        std::vector<unsigned int> degrees(this->inputDim-1, 0);
+        for(unsigned int i=0; i<comps_.size(); ++i){
+            std::vector<unsigned int> compDegrees = comps_.at(i)->SharedBasisDegrees();
+            for(unsigned int d=0; d<compDegrees.size(); ++d)
+                degrees.at(d) = std::max(degrees.at(d), compDegrees.at(d));
+        }
+
+        Kokkos::View<unsigned int*, Kokkos::HostSpace> rowStarts("Shared Basis Rows", degrees.size()+1);
+        rowStarts(0) = 0;
+        for(unsigned int d=0; d<degrees.size(); ++d)
+            rowStarts(d+1) = rowStarts(d) + degrees.at(d) + 1;
+
+        sharedRows_ = Kokkos::create_mirror_view_and_copy(MemorySpace(), rowStarts);
+    }
+}
+
+template<typename MemorySpace>
+SharedBasisTable<MemorySpace> TriangularMap<MemorySpace>::EvaluateSharedBasis(StridedMatrix<const double, MemorySpace> const& pts) const
+{
+    SharedBasisTable<MemorySpace> table;
+    if((sharedRows_.extent(0)==0) || frozen_ || (pts.extent(1)==0))
+        return table;
+
+    // The last component depends on every input, so it can evaluate the basis in all of the tabulated dimensions
+    auto rowStartsHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), sharedRows_);
+    Kokkos::View<double**, Kokkos::LayoutLeft, MemorySpace> vals("Shared Basis", rowStartsHost(rowStartsHost.extent(0)-1), pts.extent(1));
+    comps_.back()->FillSharedBasis(pts, sharedRows_, vals);
+
+    table.vals = vals;
+    table.rowStarts = sharedRows_;
+    return table;
 }
 
 
@@ -96,13 +136,33 @@ void TriangularMap<MemorySpace>::WrapCoeffs(Kokkos::View<double*, MemorySpace> c
     }
 }
 
+template<typename MemorySpace>
+void TriangularMap<MemorySpace>::FreezeData(StridedMatrix<const double, MemorySpace> const& pts)
+{
+    for(unsigned int i=0; i<comps_.size(); ++i){
+        StridedMatrix<const double, MemorySpace> subPts = Kokkos::subview(pts, std::make_pair(0,int(comps_.at(i)->inputDim)), Kokkos::ALL());
+        comps_.at(i)->FreezeData(subPts);
+    }
+    frozen_ = true;
+}
+
+template<typename MemorySpace>
+void TriangularMap<MemorySpace>::UnfreezeData()
+{
+    for(unsigned int i=0; i<comps_.size(); ++i)
+        comps_.at(i)->UnfreezeData();
+    frozen_ = false;
+}
+
 template<typename MemorySpace>
 void TriangularMap<MemorySpace>::LogDeterminantImpl(StridedMatrix<const double, MemorySpace> const& pts,
                                                     StridedVector<double, MemorySpace>              output)
 {
+    SharedBasisTable<MemorySpace> basis = EvaluateSharedBasis(pts);
+
     // Evaluate the log determinant for the first component
     StridedMatrix<const double, MemorySpace> subPts = Kokkos::subview(pts, std::make_pair(0,int(comps_.at(0)->inputDim)), Kokkos::ALL());
-    comps_.at(0)->LogDeterminantImpl(subPts, output);
+    comps_.at(0)->LogDeterminantSharedImpl(subPts, basis, output);
 
     if(comps_.size()==1)
         return;
@@ -115,7 +175,7 @@ void TriangularMap<MemorySpace>::LogDeterminantImpl(StridedMatrix<const double,
 
     for(unsigned int i=1; i<comps_.size(); ++i){
         subPts = Kokkos::subview(pts, std::make_pair(0,int(comps_.at(i)->inputDim)), Kokkos::ALL());
-        comps_.at(i)->LogDeterminantImpl(subPts, compDet);
+        comps_.at(i)->LogDeterminantSharedImpl(subPts, basis, compDet);
 
         // Add to the output
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int& j){
@@ -128,6 +188,8 @@ template<typename MemorySpace>
 void TriangularMap<MemorySpace>::EvaluateImpl(StridedMatrix<const double, MemorySpace> const& pts,
                                               StridedMatrix<double, MemorySpace>              output)
 {
+    SharedBasisTable<MemorySpace> basis = EvaluateSharedBasis(pts);
+
     // Evaluate the output for each component
     StridedMatrix<const double, MemorySpace> subPts;
     StridedMatrix<double, MemorySpace> subOut;
@@ -137,7 +199,7 @@ void TriangularMap<MemorySpace>::EvaluateImpl(StridedMatrix<const double, Memory
         subPts = Kokkos::subview(pts, std::make_pair(0,int(comps_.at(i)->inputDim)), Kokkos::ALL());
         subOut = Kokkos::subview(output, std::make_pair(startOutDim,int(startOutDim+comps_.at(i)->outputDim)), Kokkos::ALL());
 
-        comps_.at(i)->EvaluateImpl(subPts, subOut);
+        comps_.at(i)->EvaluateSharedImpl(subPts, basis, subOut);
 
         startOutDim += comps_.at(i)->outputDim;
     }
@@ -158,9 +220,35 @@ void TriangularMap<MemorySpace>::InverseImpl(StridedMatrix<const double, MemoryS
     Kokkos::deep_copy(output, Kokkos::subview(fullOut, std::make_pair(ipdim-opdim,ipdim), Kokkos::ALL()));
 }
 
+template<typename MemorySpace>
+void TriangularMap<MemorySpace>::InverseWithGuessImpl(StridedMatrix<const double, MemorySpace> const& x1,
+                                                      StridedMatrix<const double, MemorySpace> const& r,
+                                                      StridedMatrix<const double, MemorySpace> const& x2Guess,
+                                                      StridedMatrix<double, MemorySpace>              bracketWidths,
+                                                      StridedMatrix<double, MemorySpace>              output)
+{
+    unsigned int ipdim = this->inputDim;
+    unsigned int opdim = this->outputDim;
+    Kokkos::View<double**, MemorySpace> fullOut("Full Output", ipdim, x1.extent(1));
+    Kokkos::deep_copy(Kokkos::subview(fullOut, std::make_pair(0u,ipdim-opdim), Kokkos::ALL()), Kokkos::subview(x1, std::make_pair(0u,ipdim-opdim), Kokkos::ALL()));
+    Kokkos::deep_copy(Kokkos::subview(fullOut, std::make_pair(ipdim-opdim,ipdim), Kokkos::ALL()), x2Guess);
+
+    InverseInplace(fullOut, r, bracketWidths);
+
+    Kokkos::deep_copy(output, Kokkos::subview(fullOut, std::make_pair(ipdim-opdim,ipdim), Kokkos::ALL()));
+}
+
 template<typename MemorySpace>
 void TriangularMap<MemorySpace>::InverseInplace(StridedMatrix<double, MemorySpace> x,
                                                 StridedMatrix<const double, MemorySpace> const& r)
+{
+    InverseInplace(x, r, StridedMatrix<double, MemorySpace>());
+}
+
+template<typename MemorySpace>
+void TriangularMap<MemorySpace>::InverseInplace(StridedMatrix<double, MemorySpace> x,
+                                                StridedMatrix<const double, MemorySpace> const& r,
+                                                StridedMatrix<double, MemorySpace> bracketWidths)
 {
     // Evaluate the output for each component
     StridedMatrix<const double, MemorySpace> subR;
@@ -177,7 +265,14 @@ void TriangularMap<MemorySpace>::InverseInplace(StridedMatrix<double, MemorySpac
         subR = Kokkos::subview(r, std::make_pair(startOutDim,int(startOutDim+comps_.at(i)->outputDim)), Kokkos::ALL());
         subOut = Kokkos::subview(x, std::make_pair(int(extraInputs + startOutDim),int(extraInputs+startOutDim+comps_.at(i)->outputDim)), Kokkos::ALL());
 
-        comps_.at(i)->InverseImpl(subX, subR, subOut);
+        if(bracketWidths.size()>0){
+            // The current values of the output rows serve as the initial guess
+            StridedMatrix<const double, MemorySpace> subGuess = subOut;
+            StridedMatrix<double, MemorySpace> subWidths = Kokkos::subview(bracketWidths, std::make_pair(startOutDim,int(startOutDim+comps_.at(i)->outputDim)), Kokkos::ALL());
+            comps_.at(i)->InverseWithGuessImpl(subX, subR, subGuess, subWidths, subOut);
+        }else{
+            comps_.at(i)->InverseImpl(subX, subR, subOut);
+        }
 
         startOutDim += comps_.at(i)->outputDim;
     }
@@ -228,6 +323,8 @@ void TriangularMap<MemorySpace>::CoeffGradImpl(StridedMatrix<const double, Memor
                                                StridedMatrix<const double, MemorySpace> const& sens,
                                                StridedMatrix<double, MemorySpace>              output)
 {
+    SharedBasisTable<MemorySpace> basis = EvaluateSharedBasis(pts);
+
     // Evaluate the output for each component
     StridedMatrix<const double, MemorySpace> subPts;
     StridedMatrix<const double, MemorySpace> subSens;
@@ -243,7 +340,7 @@ void TriangularMap<MemorySpace>::CoeffGradImpl(StridedMatrix<const double, Memor
             subSens = Kokkos::subview(sens, std::make_pair(startOutDim,int(startOutDim+comps_.at(i)->outputDim)), Kokkos::ALL());
 
             subOut = Kokkos::subview(output, std::make_pair(startParamDim,int(startParamDim+comps_.at(i)->numCoeffs)), Kokkos::ALL());
-            comps_.at(i)->CoeffGradImpl(subPts, subSens, subOut);
+            comps_.at(i)->CoeffGradSharedImpl(subPts, subSens, basis, subOut);
 
 
             startParamDim += comps_.at(i)->numCoeffs;
@@ -253,6 +350,63 @@ void TriangularMap<MemorySpace>::CoeffGradImpl(StridedMatrix<const double, Memor
     }
 }
 
+template<typename MemorySpace>
+void TriangularMap<MemorySpace>::ForwardPassImpl(StridedMatrix<const double, MemorySpace> const& pts,
+                                                 StridedMatrix<const double, MemorySpace> const& sens,
+                                                 StridedMatrix<double, MemorySpace>              evals,
+                                                 StridedVector<double, MemorySpace>              logDets,
+                                                 StridedMatrix<double, MemorySpace>              coeffGrad)
+{
+    SharedBasisTable<MemorySpace> basis = EvaluateSharedBasis(pts);
+
+    const bool computeEvals = (evals.size()>0);
+    const bool computeDets = (logDets.size()>0);
+    const bool computeGrad = (coeffGrad.size()>0);
+
+    // Vector to hold log determinant for a single component
+    Kokkos::View<double*, MemorySpace> compDet;
+    if(computeDets && (comps_.size()>1))
+        compDet = Kokkos::View<double*, MemorySpace>("Log Determinant", logDets.extent(0));
+
+    Kokkos::RangePolicy<typename MemoryToExecution<MemorySpace>::Space> policy(0,logDets.size());
+
+    int startOutDim = 0;
+    int startParamDim = 0;
+    for(unsigned int i=0; i<comps_.size(); ++i){
+        auto const& comp = comps_.at(i);
+        std::pair<int,int> outRows(startOutDim, int(startOutDim+comp->outputDim));
+
+        StridedMatrix<const double, MemorySpace> subPts = Kokkos::subview(pts, std::make_pair(0,int(comp->inputDim)), Kokkos::ALL());
+
+        StridedMatrix<const double, MemorySpace> subSens;
+        StridedMatrix<double, MemorySpace> subGrad;
+        if(computeGrad && (comp->numCoeffs!=0)){
+            subSens = Kokkos::subview(sens, outRows, Kokkos::ALL());
+            subGrad = Kokkos::subview(coeffGrad, std::make_pair(startParamDim,int(startParamDim+comp->numCoeffs)), Kokkos::ALL());
+        }
+
+        StridedMatrix<double, MemorySpace> subEvals;
+        if(computeEvals)
+            subEvals = Kokkos::subview(evals, outRows, Kokkos::ALL());
+
+        StridedVector<double, MemorySpace> subDet;
+        if(computeDets)
+            subDet = (i==0) ? logDets : StridedVector<double, MemorySpace>(compDet);
+
+        comp->ForwardPassSharedImpl(subPts, basis, subSens, subEvals, subDet, subGrad);
+
+        // Add to the log determinant of the full map
+        if(computeDets && (i>0)){
+            Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int& j){
+                logDets(j) += compDet(j);
+            });
+        }
+
+        startOutDim += comp->outputDim;
+        startParamDim += comp->numCoeffs;
+    }
+}
+
 template<typename MemorySpace>
 void TriangularMap<MemorySpace>::LogDeterminantCoeffGradImpl(StridedMatrix<const double, MemorySpace> const& pts,
                                                              StridedMatrix<double, MemorySpace>              output)
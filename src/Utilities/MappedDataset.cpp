@@ -0,0 +1,116 @@
+#include "MParT/Utilities/MappedDataset.h"
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace mpart;
+
+namespace {
+    const char datasetMagic[8] = {'M','P','A','R','T','D','A','T'};
+    const uint32_t datasetVersion = 1;
+}
+
+MappedDataset::MappedDataset(std::string const& filename) : file_(filename)
+{
+    if(file_.Size() < HeaderBytes){
+        std::stringstream msg;
+        msg << "MappedDataset: File \"" << filename << "\" is too small to contain a dataset header.";
+        throw std::runtime_error(msg.str());
+    }
+
+    const char* header = file_.Data();
+    uint32_t version;
+    uint64_t dim, numSamples;
+    std::memcpy(&version, header + 8, sizeof(uint32_t));
+    std::memcpy(&dim, header + 16, sizeof(uint64_t));
+    std::memcpy(&numSamples, header + 24, sizeof(uint64_t));
+
+    if((std::memcmp(header, datasetMagic, 8) != 0) || (version != datasetVersion)){
+        std::stringstream msg;
+        msg << "MappedDataset: File \"" << filename << "\" is not a version " << datasetVersion << " MParT dataset.";
+        throw std::runtime_error(msg.str());
+    }
+
+    if((dim > std::numeric_limits<unsigned int>::max()) || (numSamples > std::numeric_limits<unsigned int>::max())){
+        std::stringstream msg;
+        msg << "MappedDataset: Dataset in \"" << filename << "\" has size " << dim << "x" << numSamples;
+        msg << ", but at most " << std::numeric_limits<unsigned int>::max() << " rows and columns are supported.";
+        throw std::runtime_error(msg.str());
+    }
+
+    std::size_t dataBytes = static_cast<std::size_t>(dim)*static_cast<std::size_t>(numSamples)*sizeof(double);
+    if(file_.Size() < HeaderBytes + dataBytes){
+        std::stringstream msg;
+        msg << "MappedDataset: File \"" << filename << "\" should contain " << HeaderBytes + dataBytes << " bytes for a ";
+        msg << dim << "x" << numSamples << " dataset, but only has " << file_.Size() << " bytes.";
+        throw std::runtime_error(msg.str());
+    }
+
+    dim_ = static_cast<unsigned int>(dim);
+    numSamples_ = static_cast<unsigned int>(numSamples);
+
+    // Samples are usually streamed front to back, so let the kernel read ahead aggressively
+    file_.AdviseSequential();
+    data_ = reinterpret_cast<const double*>(file_.Data() + HeaderBytes);
+}
+
+StridedMatrix<const double, Kokkos::HostSpace> MappedDataset::Block(unsigned int start, unsigned int end) const
+{
+    if((start > end) || (end > numSamples_)){
+        std::stringstream msg;
+        msg << "MappedDataset::Block: Invalid sample range [" << start << "," << end << ") for a dataset with " << numSamples_ << " samples.";
+        throw std::invalid_argument(msg.str());
+    }
+    return ToConstKokkos<double>(data_ + static_cast<std::size_t>(start)*dim_, dim_, end - start);
+}
+
+void MappedDataset::Release(unsigned int start, unsigned int end) const
+{
+    if((start >= end) || (end > numSamples_))
+        return;
+
+    std::size_t firstByte = HeaderBytes + static_cast<std::size_t>(start)*dim_*sizeof(double);
+    std::size_t numBytes = static_cast<std::size_t>(end - start)*dim_*sizeof(double);
+    file_.Release(firstByte, numBytes);
+}
+
+void MappedDataset::Write(std::string const& filename, StridedMatrix<const double, Kokkos::HostSpace> data)
+{
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if(!out){
+        std::stringstream msg;
+        msg << "MappedDataset::Write: Could not open file \"" << filename << "\" for writing.";
+        throw std::runtime_error(msg.str());
+    }
+
+    char header[HeaderBytes] = {};
+    uint64_t dim = data.extent(0);
+    uint64_t numSamples = data.extent(1);
+    std::memcpy(header, datasetMagic, 8);
+    std::memcpy(header + 8, &datasetVersion, sizeof(uint32_t));
+    std::memcpy(header + 16, &dim, sizeof(uint64_t));
+    std::memcpy(header + 24, &numSamples, sizeof(uint64_t));
+    out.write(header, HeaderBytes);
+
+    // Write one sample at a time, gathering it into a contiguous buffer when the view is not column major
+    std::vector<double> column(dim);
+    for(unsigned int j=0; (dim > 0) && (j<numSamples); ++j){
+        if(data.stride(0) == 1){
+            out.write(reinterpret_cast<const char*>(&data(0,j)), dim*sizeof(double));
+        }else{
+            for(unsigned int i=0; i<dim; ++i)
+                column[i] = data(i,j);
+            out.write(reinterpret_cast<const char*>(column.data()), dim*sizeof(double));
+        }
+    }
+
+    if(!out){
+        std::stringstream msg;
+        msg << "MappedDataset::Write: Failed while writing to \"" << filename << "\".";
+        throw std::runtime_error(msg.str());
+    }
+}
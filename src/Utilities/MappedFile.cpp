@@ -0,0 +1,75 @@
+#include "MParT/Utilities/MappedFile.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace mpart;
+
+MappedFile::MappedFile(std::string const& filename, bool copyOnWrite) : filename_(filename)
+{
+    int fd = open(filename.c_str(), O_RDONLY);
+    if(fd < 0){
+        std::stringstream msg;
+        msg << "MappedFile: Could not open file \"" << filename << "\": " << std::strerror(errno);
+        throw std::runtime_error(msg.str());
+    }
+
+    struct stat info;
+    if(fstat(fd, &info) != 0){
+        int err = errno;
+        close(fd);
+        std::stringstream msg;
+        msg << "MappedFile: Could not determine the size of \"" << filename << "\": " << std::strerror(err);
+        throw std::runtime_error(msg.str());
+    }
+    size_ = static_cast<std::size_t>(info.st_size);
+
+    // mmap does not accept empty ranges, so empty files are represented without a mapping
+    if(size_ > 0){
+        int prot = copyOnWrite ? (PROT_READ | PROT_WRITE) : PROT_READ;
+        mapping_ = mmap(nullptr, size_, prot, MAP_PRIVATE, fd, 0);
+        if(mapping_ == MAP_FAILED){
+            int err = errno;
+            mapping_ = nullptr;
+            close(fd);
+            std::stringstream msg;
+            msg << "MappedFile: Could not map file \"" << filename << "\": " << std::strerror(err);
+            throw std::runtime_error(msg.str());
+        }
+    }
+    close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if(mapping_ != nullptr)
+        munmap(mapping_, size_);
+}
+
+void MappedFile::AdviseSequential() const
+{
+    if(mapping_ != nullptr)
+        madvise(mapping_, size_, MADV_SEQUENTIAL);
+}
+
+void MappedFile::Release(std::size_t offset, std::size_t bytes) const
+{
+    if((mapping_ == nullptr) || (offset >= size_))
+        return;
+
+    // madvise works on whole pages, so shrink the byte range to the pages it fully covers
+    std::size_t pageBytes = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    std::size_t firstByte = ((offset + pageBytes - 1) / pageBytes) * pageBytes;
+    std::size_t lastByte = (std::min(offset + bytes, size_) / pageBytes) * pageBytes;
+
+    if(firstByte < lastByte)
+        madvise(Data() + firstByte, lastByte - firstByte, MADV_DONTNEED);
+}
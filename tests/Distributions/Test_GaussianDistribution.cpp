@@ -115,4 +115,62 @@ TEST_CASE( "Testing Gaussian Distribution", "[GaussianDist]") {
         TestStandardNormalSamples(samples);
         TestGaussianLogPDF(samples, samples_pdf, samples_gradpdf, dim*std::log(covar_diag_val), std::sqrt(covar_diag_val), abs_margin);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE( "Testing counter based Gaussian sampling", "[GaussianDistCounterRNG]") {
+    unsigned int dim = 3;
+    unsigned int N_samp = 5000;
+    unsigned int seed = 162849;
+
+    auto sampler = std::make_shared<GaussianSamplerDensity<Kokkos::HostSpace>>(dim);
+    CHECK(sampler->GetRNGType() == GaussianSamplerDensity<Kokkos::HostSpace>::RNGTypes::Pool);
+    sampler->SetRNGType(GaussianSamplerDensity<Kokkos::HostSpace>::RNGTypes::Counter);
+    CHECK(sampler->GetRNGType() == GaussianSamplerDensity<Kokkos::HostSpace>::RNGTypes::Counter);
+
+    sampler->SetSeed(seed);
+    Kokkos::View<double**, Kokkos::LayoutLeft, Kokkos::HostSpace> samples ("sample matrix", dim, N_samp);
+    sampler->SampleImpl(samples);
+    TestStandardNormalSamples(samples);
+
+    SECTION( "Reproducible with the same seed" ) {
+        sampler->SetSeed(seed);
+        auto samples2 = sampler->Sample(N_samp);
+        for(unsigned int j=0; j<N_samp; ++j){
+            for(unsigned int i=0; i<dim; ++i)
+                CHECK(samples2(i,j) == samples(i,j));
+        }
+    }
+
+    SECTION( "Independent of how the samples are split across calls" ) {
+        sampler->SetSeed(seed);
+        unsigned int N_first = 1234;
+        auto first = sampler->Sample(N_first);
+        auto second = sampler->Sample(N_samp - N_first);
+        for(unsigned int i=0; i<dim; ++i){
+            for(unsigned int j=0; j<N_first; ++j)
+                CHECK(first(i,j) == samples(i,j));
+            for(unsigned int j=N_first; j<N_samp; ++j)
+                CHECK(second(i,j-N_first) == samples(i,j));
+        }
+    }
+
+    SECTION( "Consecutive calls give new samples" ) {
+        auto samples2 = sampler->Sample(N_samp);
+        unsigned int numEqual = 0;
+        for(unsigned int j=0; j<N_samp; ++j){
+            for(unsigned int i=0; i<dim; ++i)
+                numEqual += (samples2(i,j) == samples(i,j)) ? 1 : 0;
+        }
+        CHECK(numEqual == 0);
+    }
+
+    SECTION( "Known answer of the Philox4x32-10 generator" ) {
+        uint32_t ctr[4] = {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u};
+        const uint32_t key[2] = {0xa4093822u, 0x299f31d0u};
+        Philox4x32::Apply(ctr, key);
+        CHECK(ctr[0] == 0xd16cfe09u);
+        CHECK(ctr[1] == 0x94fdccebu);
+        CHECK(ctr[2] == 0x5001e420u);
+        CHECK(ctr[3] == 0x24126ea1u);
+    }
+}
@@ -0,0 +1,73 @@
+#include <catch2/catch_all.hpp>
+#include "MParT/Distributions/HaltonSampleGenerator.h"
+#include "Test_Distributions_Common.h"
+
+using namespace mpart;
+using namespace Catch;
+
+TEST_CASE( "Testing Halton sample generator", "[HaltonSampleGenerator]") {
+    unsigned int dim = 3;
+    unsigned int seed = 162849;
+
+    SECTION( "Unscrambled points" ) {
+        HaltonSampleGenerator<Kokkos::HostSpace> sampler(dim, false, false);
+        sampler.Skip(1);
+        auto samples = sampler.Sample(4);
+
+        double truth[4][3] = {{1.0/2, 1.0/3, 1.0/5}, {1.0/4, 2.0/3, 2.0/5}, {3.0/4, 1.0/9, 3.0/5}, {1.0/8, 4.0/9, 4.0/5}};
+        for(unsigned int j=0; j<4; ++j){
+            for(unsigned int i=0; i<dim; ++i)
+                CHECK(samples(i,j) == Approx(truth[j][i]).margin(1e-9));
+        }
+    }
+
+    SECTION( "Scrambled points are stratified" ) {
+        unsigned int highDim = 20;
+        HaltonSampleGenerator<Kokkos::HostSpace> sampler(highDim, false, true, seed);
+
+        // The first 2^6 points are stratified in base 2 and the first 3^4 points in base 3
+        unsigned int N = 81;
+        auto samples = sampler.Sample(N);
+        std::vector<unsigned int> bins = {64, 81};
+        for(unsigned int i=0; i<2; ++i){
+            std::vector<unsigned int> counts(bins.at(i), 0);
+            for(unsigned int j=0; j<bins.at(i); ++j)
+                counts.at(static_cast<unsigned int>(samples(i,j)*bins.at(i)))++;
+            for(unsigned int k=0; k<bins.at(i); ++k)
+                CHECK(counts.at(k) == 1);
+        }
+
+        for(unsigned int i=0; i<highDim; ++i){
+            for(unsigned int j=0; j<N; ++j){
+                CHECK(samples(i,j) > 0.0);
+                CHECK(samples(i,j) < 1.0);
+            }
+        }
+    }
+
+    SECTION( "Gaussian samples" ) {
+        HaltonSampleGenerator<Kokkos::HostSpace> sampler(dim, true, true, seed);
+        Kokkos::View<double**, Kokkos::LayoutLeft, Kokkos::HostSpace> samples("sample matrix", dim, 5000);
+        sampler.SampleImpl(samples);
+        TestStandardNormalSamples(samples);
+    }
+
+    SECTION( "Skip ahead and reseeding" ) {
+        HaltonSampleGenerator<Kokkos::HostSpace> sampler(dim, true, true, seed);
+        auto first = sampler.Sample(100);
+        auto second = sampler.Sample(50);
+        CHECK(sampler.NextIndex() == 150);
+
+        sampler.SetSeed(seed);
+        sampler.Skip(100);
+        auto skipped = sampler.Sample(50);
+        for(unsigned int j=0; j<50; ++j){
+            for(unsigned int i=0; i<dim; ++i)
+                CHECK(skipped(i,j) == second(i,j));
+        }
+
+        sampler.SetSeed(seed+1);
+        auto reseeded = sampler.Sample(100);
+        CHECK(reseeded(0,0) != first(0,0));
+    }
+}
@@ -0,0 +1,71 @@
+#include <catch2/catch_all.hpp>
+#include "MParT/Distributions/SobolSampleGenerator.h"
+#include "Test_Distributions_Common.h"
+
+using namespace mpart;
+using namespace Catch;
+
+TEST_CASE( "Testing Sobol sample generator", "[SobolSampleGenerator]") {
+    unsigned int dim = 3;
+    unsigned int seed = 162849;
+
+    SECTION( "Unscrambled points" ) {
+        SobolSampleGenerator<Kokkos::HostSpace> sampler(dim, false, false);
+        auto samples = sampler.Sample(8);
+
+        double truth[8][3] = {{0.0, 0.0, 0.0}, {0.5, 0.5, 0.5}, {0.75, 0.25, 0.25}, {0.25, 0.75, 0.75},
+                              {0.375, 0.375, 0.625}, {0.875, 0.875, 0.125}, {0.625, 0.125, 0.875}, {0.125, 0.625, 0.375}};
+        for(unsigned int j=0; j<8; ++j){
+            for(unsigned int i=0; i<dim; ++i)
+                CHECK(samples(i,j) == Approx(truth[j][i]).margin(1e-9));
+        }
+    }
+
+    SECTION( "Scrambled points are stratified" ) {
+        SobolSampleGenerator<Kokkos::HostSpace> sampler(SobolSampleGenerator<Kokkos::HostSpace>::MaxDim, false, true, seed);
+        unsigned int N = 1024;
+        auto samples = sampler.Sample(N);
+        for(unsigned int i=0; i<sampler.Dim(); ++i){
+            std::vector<unsigned int> counts(N, 0);
+            for(unsigned int j=0; j<N; ++j){
+                REQUIRE(samples(i,j) > 0.0);
+                REQUIRE(samples(i,j) < 1.0);
+                counts.at(static_cast<unsigned int>(samples(i,j)*N))++;
+            }
+            for(unsigned int k=0; k<N; ++k)
+                CHECK(counts.at(k) == 1);
+        }
+    }
+
+    SECTION( "Gaussian samples" ) {
+        SobolSampleGenerator<Kokkos::HostSpace> sampler(dim, true, true, seed);
+        Kokkos::View<double**, Kokkos::LayoutLeft, Kokkos::HostSpace> samples("sample matrix", dim, 4096);
+        sampler.SampleImpl(samples);
+        TestStandardNormalSamples(samples);
+    }
+
+    SECTION( "Skip ahead and reseeding" ) {
+        SobolSampleGenerator<Kokkos::HostSpace> sampler(dim, true, true, seed);
+        auto first = sampler.Sample(100);
+        auto second = sampler.Sample(50);
+        CHECK(sampler.NextIndex() == 150);
+
+        sampler.SetSeed(seed);
+        CHECK(sampler.NextIndex() == 0);
+        sampler.Skip(100);
+        auto skipped = sampler.Sample(50);
+        for(unsigned int j=0; j<50; ++j){
+            for(unsigned int i=0; i<dim; ++i)
+                CHECK(skipped(i,j) == second(i,j));
+        }
+
+        sampler.SetSeed(seed+1);
+        auto reseeded = sampler.Sample(100);
+        CHECK(reseeded(0,0) != first(0,0));
+    }
+
+    SECTION( "Dimension limits" ) {
+        CHECK_THROWS_AS(SobolSampleGenerator<Kokkos::HostSpace>(0), std::invalid_argument);
+        CHECK_THROWS_AS(SobolSampleGenerator<Kokkos::HostSpace>(SobolSampleGenerator<Kokkos::HostSpace>::MaxDim+1), std::invalid_argument);
+    }
+}
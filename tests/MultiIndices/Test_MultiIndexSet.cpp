@@ -1,6 +1,8 @@
 #include <catch2/catch_test_macros.hpp>
 #include<Kokkos_Sort.hpp>
 
+#include <algorithm>
+
 #include "MParT/MultiIndices/FixedMultiIndexSet.h"
 #include "MParT/MultiIndices/MultiIndexSet.h"
 
@@ -652,4 +654,74 @@ TEST_CASE("MultiIndexSet Visualization Test", "[MultiIndexSet_Viz]")
 
         REQUIRE(output.str() == truth.str());
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("MultiIndexSet hash lookups and adjacency", "[MultiIndexSet_Storage]")
+{
+    unsigned int dim = 8;
+    MultiIndexSet mset = MultiIndexSet::CreateTotalOrder(dim, 4);
+    REQUIRE(mset.Size() == 495);
+
+    SECTION("Lookups"){
+        for(unsigned int i=0; i<mset.Size(); ++i){
+            MultiIndex multi = mset.at(i);
+            CHECK(mset.MultiToIndex(multi) == int(i));
+            CHECK(MultiIndex(multi.Vector()).Hash() == multi.Hash());
+        }
+
+        // Multiindices in the margin are stored but not active
+        MultiIndex margin(dim);
+        margin.Set(3, 5);
+        CHECK(mset.MultiToIndex(margin) == -1);
+        CHECK(mset.IsAdmissible(margin));
+        CHECK(!mset.IsActive(margin));
+
+        // Multiindices that were never added
+        MultiIndex outside(dim, 3);
+        CHECK(mset.MultiToIndex(outside) == -1);
+        CHECK(!mset.IsAdmissible(outside));
+        CHECK(mset.MultiToIndex(MultiIndex(dim+1)) == -1);
+    }
+
+    SECTION("Adjacency"){
+        unsigned int zeroInd = mset.MultiToIndex(MultiIndex(dim));
+        CHECK(mset.NumForward(zeroInd) == dim);
+        CHECK(mset.NumActiveForward(zeroInd) == dim);
+        CHECK(mset.BackwardNeighbors(zeroInd).size() == 0);
+
+        MultiIndex multi(dim);
+        multi.Set(1, 2);
+        multi.Set(4, 1);
+        std::vector<unsigned int> backInds = mset.BackwardNeighbors(mset.MultiToIndex(multi));
+        REQUIRE(backInds.size() == 2);
+
+        MultiIndex back1(dim), back2(dim);
+        back1.Set(1, 1);
+        back1.Set(4, 1);
+        back2.Set(1, 2);
+        CHECK(std::find(backInds.begin(), backInds.end(), mset.MultiToIndex(back1)) != backInds.end());
+        CHECK(std::find(backInds.begin(), backInds.end(), mset.MultiToIndex(back2)) != backInds.end());
+    }
+
+    SECTION("Copies are independent"){
+        MultiIndexSet copy = mset;
+        copy.Expand();
+        CHECK(copy.Size() > mset.Size());
+        CHECK(mset.Size() == 495);
+        for(unsigned int i=0; i<copy.Size(); ++i)
+            CHECK(copy.MultiToIndex(copy.at(i)) == int(i));
+    }
+
+    SECTION("Forcibly activate a distant multiindex"){
+        MultiIndexSet small(3);
+        small.AddActive(MultiIndex(3));
+
+        std::vector<unsigned int> newInds = small.ForciblyActivate(MultiIndex{2,2,2});
+        CHECK(newInds.size() == 26);
+        REQUIRE(small.Size() == 27);
+        for(unsigned int i=0; i<small.Size(); ++i){
+            CHECK(small.IsAdmissible(small.at(i)));
+            CHECK(small.at(i).Max() <= 2);
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #include <catch2/catch_all.hpp>
 
 #include "MParT/ComposedMap.h"
+#include "MParT/AffineMap.h"
 #include "MParT/MapFactory.h"
 
 #include "MParT/Utilities/LinearAlgebra.h"
@@ -925,4 +926,135 @@ TEST_CASE( "Testing 8 layer composed map with moveCoeffs=true", "[DeepComposedMa
 
     }
 
-}
\ No newline at end of file
+}
+
+TEST_CASE( "Testing composed map checkpointing with a memory budget", "[DeepComposedMapBudget]" ) {
+
+    MapOptions options;
+    options.basisType = BasisTypes::ProbabilistHermite;
+
+    unsigned int dim = 2;
+    unsigned int numMaps = 8;
+    unsigned int order = 1;
+
+    std::vector<std::shared_ptr<ConditionalMapBase<MemorySpace>>> maps(numMaps);
+    for(unsigned int i=0;i<numMaps;++i){
+        maps.at(i) = MapFactory::CreateTriangular<Kokkos::HostSpace>(dim, dim, order, options);
+
+        Kokkos::View<double*,Kokkos::HostSpace> coeffs("Coefficients", maps.at(i)->numCoeffs);
+        for(unsigned int j=0; j<maps.at(i)->numCoeffs; ++j)
+            coeffs(j) = 0.1*(j+1);
+        maps.at(i)->SetCoeffs(coeffs);
+    }
+
+    auto fullMap = std::make_shared<ComposedMap<MemorySpace>>(maps, true);
+    auto budgetMap = std::make_shared<ComposedMap<MemorySpace>>(maps, false);
+    budgetMap->WrapCoeffs(fullMap->Coeffs());
+
+    unsigned int numSamps = 10;
+    const std::size_t stateBytes = dim*numSamps*sizeof(double);
+
+    // Room for 3 checkpoints and the two work arrays
+    budgetMap->SetCheckpointBudget(5*stateBytes);
+    CHECK(budgetMap->CheckpointBudget() == 5*stateBytes);
+    CHECK(budgetMap->NumCheckpoints(numSamps) == 3);
+    CHECK(budgetMap->NumCheckpoints(2*numSamps) == 1);
+    CHECK(budgetMap->NumCheckpoints(1) == numMaps);
+
+    Kokkos::View<double**, Kokkos::HostSpace> in("Map Input", dim, numSamps);
+    for(unsigned int i=0; i<dim; ++i){
+        for(unsigned int j=0; j<numSamps; ++j){
+            in(i,j) = double(i)/(dim) + double(j)/numSamps;
+        }
+    }
+
+    Kokkos::View<double**,Kokkos::HostSpace> sens("Sensitivities", dim, numSamps);
+    for(unsigned int j=0; j<numSamps; ++j){
+        for(unsigned int i=0; i<dim; ++i){
+            sens(i,j) = 1.0 + 0.1*i + j;
+        }
+    }
+
+    auto truthGrad = fullMap->CoeffGrad(in, sens);
+    auto budgetGrad = budgetMap->CoeffGrad(in, sens);
+    for(unsigned int i=0; i<fullMap->numCoeffs; ++i){
+        for(unsigned int j=0; j<numSamps; ++j)
+            CHECK(budgetGrad(i,j) == Approx(truthGrad(i,j)).epsilon(1e-12).margin(1e-12));
+    }
+
+    auto fullReport = fullMap->LastCheckpointReport();
+    CHECK(fullReport.maxCheckpoints == numMaps);
+    CHECK(fullReport.numLayerEvals == numMaps-1);
+    CHECK(fullReport.bytesPerCheckpoint == stateBytes);
+
+    auto budgetReport = budgetMap->LastCheckpointReport();
+    CHECK(budgetReport.maxCheckpoints == 3);
+    CHECK(budgetReport.peakCheckpoints <= 3);
+    CHECK(budgetReport.peakBytes <= 5*stateBytes);
+    CHECK(budgetReport.numLayerEvals > fullReport.numLayerEvals);
+
+    // Without a budget, the maxChecks argument is used again
+    budgetMap->SetCheckpointBudget(0);
+    CHECK(budgetMap->NumCheckpoints(numSamps) == numMaps);
+}
+
+
+TEST_CASE( "Testing fused forward pass of a composed map", "[ComposedMap_ForwardPass]" ) {
+
+    MapOptions options;
+    options.basisType = BasisTypes::ProbabilistHermite;
+
+    unsigned int dim = 2;
+    unsigned int numMaps = 3;
+    unsigned int order = 2;
+
+    std::vector<std::shared_ptr<ConditionalMapBase<MemorySpace>>> maps;
+    for(unsigned int i=0;i<numMaps;++i){
+        auto map = MapFactory::CreateTriangular<MemorySpace>(dim, dim, order, options);
+
+        Kokkos::View<double*,MemorySpace> coeffs("Coefficients", map->numCoeffs);
+        for(unsigned int j=0; j<map->numCoeffs; ++j)
+            coeffs(j) = 0.05*(j+1)*(i+1);
+        map->SetCoeffs(coeffs);
+        maps.push_back(map);
+    }
+
+    // Add an affine layer in the middle of the composition
+    Kokkos::View<double**,MemorySpace> A("A", dim, dim);
+    Kokkos::View<double*,MemorySpace> b("b", dim);
+    A(0,0) = 2.0;  A(0,1) = 0.0;
+    A(1,0) = 0.5;  A(1,1) = 1.5;
+    b(0) = 0.1;    b(1) = -0.2;
+    maps.insert(maps.begin()+1, std::make_shared<AffineMap<MemorySpace>>(A,b));
+
+    auto composedMap = std::make_shared<ComposedMap<MemorySpace>>(maps, true);
+
+    unsigned int numSamps = 10;
+    Kokkos::View<double**,MemorySpace> in("Map Input", dim, numSamps);
+    Kokkos::View<double**,MemorySpace> sens("Sensitivities", dim, numSamps);
+    for(unsigned int j=0; j<numSamps; ++j){
+        for(unsigned int i=0; i<dim; ++i){
+            in(i,j) = double(i)/dim + double(j)/numSamps;
+            sens(i,j) = 1.0 + 0.1*i + j;
+        }
+    }
+
+    auto evals = composedMap->Evaluate(in);
+    auto logDets = composedMap->LogDeterminant(in);
+    auto coeffGrads = composedMap->CoeffGrad(in, sens);
+    auto detCoeffGrads = composedMap->LogDeterminantCoeffGrad(in);
+
+    Kokkos::View<double**,MemorySpace> fusedEvals("Evaluations", dim, numSamps);
+    Kokkos::View<double*,MemorySpace> fusedDets("Log Determinants", numSamps);
+    Kokkos::View<double**,MemorySpace> fusedGrads("Coefficient Gradient", composedMap->numCoeffs, numSamps);
+
+    composedMap->ForwardPassImpl(in, sens, fusedEvals, fusedDets, fusedGrads);
+
+    for(unsigned int j=0; j<numSamps; ++j){
+        CHECK(fusedDets(j) == Approx(logDets(j)).epsilon(1e-10).margin(1e-10));
+        for(unsigned int i=0; i<dim; ++i)
+            CHECK(fusedEvals(i,j) == Approx(evals(i,j)).epsilon(1e-10).margin(1e-10));
+        for(unsigned int i=0; i<composedMap->numCoeffs; ++i)
+            CHECK(fusedGrads(i,j) == Approx(coeffGrads(i,j) + detCoeffGrads(i,j)).epsilon(1e-10).margin(1e-10));
+    }
+}
@@ -5,6 +5,9 @@
 #include "MParT/TriangularMap.h"
 #include "MParT/MultiIndices/MultiIndexSet.h"
 #include "MParT/MultiIndices/FixedMultiIndexSet.h"
+#include "MParT/MonotoneComponent.h"
+#include "MParT/FixedDimExpansionWorker.h"
+#include "MParT/PositiveBijectors.h"
 
 #include <unordered_map>
 #include <string>
@@ -65,6 +68,122 @@ TEST_CASE( "Testing map component factory", "[MapFactoryComponent]" ) {
 
         Kokkos::View<double**, MemorySpace> eval = map->Evaluate(pts);
     }
+
+    SECTION("GaussLegendre"){
+        options.quadType = QuadTypes::GaussLegendre;
+
+        std::shared_ptr<ConditionalMapBase<MemorySpace>> map = MapFactory::CreateComponent<MemorySpace>(mset, options);
+        REQUIRE(map!=nullptr);
+
+        unsigned int numPts = 100;
+        Kokkos::View<double**,MemorySpace> pts("Points", dim, numPts);
+        for(unsigned int i=0; i<numPts; ++i)
+            pts(dim-1,i) = double(i)/double(numPts-1);
+
+        Kokkos::View<double**, MemorySpace> eval = map->Evaluate(pts);
+    }
+
+    SECTION("AdaptiveGaussKronrod"){
+        options.quadType = QuadTypes::AdaptiveGaussKronrod;
+
+        std::shared_ptr<ConditionalMapBase<MemorySpace>> map = MapFactory::CreateComponent<MemorySpace>(mset, options);
+        REQUIRE(map!=nullptr);
+
+        unsigned int numPts = 100;
+        Kokkos::View<double**,MemorySpace> pts("Points", dim, numPts);
+        for(unsigned int i=0; i<numPts; ++i)
+            pts(dim-1,i) = double(i)/double(numPts-1);
+
+        Kokkos::View<double**, MemorySpace> eval = map->Evaluate(pts);
+    }
+
+    SECTION("Square"){
+        options.posFuncType = PosFuncTypes::Square;
+        options.nugget = 1e-3;
+
+        std::shared_ptr<ConditionalMapBase<MemorySpace>> map = MapFactory::CreateComponent<MemorySpace>(mset, options);
+        REQUIRE(map!=nullptr);
+
+        unsigned int numPts = 100;
+        Kokkos::View<double**,MemorySpace> pts("Points", dim, numPts);
+        for(unsigned int i=0; i<numPts; ++i)
+            pts(dim-1,i) = double(i)/double(numPts-1);
+
+        Kokkos::View<double**, MemorySpace> eval = map->Evaluate(pts);
+
+        // Only orthogonal polynomial bases without linearization can be integrated in closed form
+        options.basisType = BasisTypes::HermiteFunctions;
+        CHECK_THROWS_AS(MapFactory::CreateComponent<MemorySpace>(mset, options), std::invalid_argument);
+
+        options.basisType = BasisTypes::ProbabilistHermite;
+        options.basisLB = -3.0;
+        options.basisUB = 3.0;
+        CHECK_THROWS_AS(MapFactory::CreateComponent<MemorySpace>(mset, options), std::invalid_argument);
+    }
+}
+
+
+TEST_CASE( "Testing map component factory with fixed dimension worker", "[MapFactoryFixedDimComponent]" ) {
+
+    MapOptions options;
+    options.basisType = BasisTypes::ProbabilistHermite;
+    options.quadType = QuadTypes::AdaptiveSimpson;
+    options.quadAbsTol = 1e-8;
+    options.quadRelTol = 1e-8;
+
+    unsigned int dim = 3;
+    unsigned int maxDegree = 3;
+    FixedMultiIndexSet<MemorySpace> mset = MultiIndexSet::CreateTotalOrder(dim, maxDegree).Fix();
+
+    std::shared_ptr<ConditionalMapBase<MemorySpace>> genMap = MapFactory::CreateComponent<MemorySpace>(mset, options);
+
+    options.fixedDimWorker = true;
+    std::shared_ptr<ConditionalMapBase<MemorySpace>> fixedMap = MapFactory::CreateComponent<MemorySpace>(mset, options);
+
+    using BasisType = BasisEvaluator<BasisHomogeneity::Homogeneous,ProbabilistHermite>;
+    using FixedCompType = MonotoneComponent<FixedDimExpansionWorker<3,FixedDimMaxOrder,BasisType,MemorySpace>, SoftPlus, AdaptiveSimpson<MemorySpace>, MemorySpace>;
+    REQUIRE(std::dynamic_pointer_cast<FixedCompType>(fixedMap) != nullptr);
+    REQUIRE(fixedMap->numCoeffs == genMap->numCoeffs);
+
+    Eigen::VectorXd coeffs(genMap->numCoeffs);
+    for(unsigned int i=0; i<coeffs.size(); ++i)
+        coeffs(i) = 0.1*std::cos(0.3*double(i)+0.1);
+    genMap->SetCoeffs(coeffs);
+    fixedMap->SetCoeffs(coeffs);
+
+    unsigned int numPts = 20;
+    Eigen::RowMatrixXd pts(dim, numPts);
+    for(unsigned int i=0; i<numPts; ++i){
+        for(unsigned int d=0; d<dim; ++d)
+            pts(d,i) = std::sin(0.7*double(i) + double(d)) - 0.2*double(d);
+    }
+    Eigen::RowMatrixXd sens = Eigen::RowMatrixXd::Ones(1, numPts);
+
+    auto CheckMatch = [](Eigen::RowMatrixXd const& truth, Eigen::RowMatrixXd const& test){
+        REQUIRE(truth.rows() == test.rows());
+        REQUIRE(truth.cols() == test.cols());
+        for(unsigned int i=0; i<truth.rows(); ++i){
+            for(unsigned int j=0; j<truth.cols(); ++j)
+                CHECK(test(i,j) == Approx(truth(i,j)).epsilon(1e-10).margin(1e-12));
+        }
+    };
+
+    CheckMatch(genMap->Evaluate(pts), fixedMap->Evaluate(pts));
+    CheckMatch(genMap->LogDeterminant(pts).transpose(), fixedMap->LogDeterminant(pts).transpose());
+    CheckMatch(genMap->Gradient(pts, sens), fixedMap->Gradient(pts, sens));
+    CheckMatch(genMap->CoeffGrad(pts, sens), fixedMap->CoeffGrad(pts, sens));
+    CheckMatch(genMap->LogDeterminantCoeffGrad(pts), fixedMap->LogDeterminantCoeffGrad(pts));
+    CheckMatch(genMap->LogDeterminantInputGrad(pts), fixedMap->LogDeterminantInputGrad(pts));
+
+    SECTION("Fallback to general worker"){
+        FixedMultiIndexSet<MemorySpace> highSet(dim, FixedDimMaxOrder+1);
+        std::shared_ptr<ConditionalMapBase<MemorySpace>> highMap = MapFactory::CreateComponent<MemorySpace>(highSet, options);
+        REQUIRE(highMap != nullptr);
+        CHECK(std::dynamic_pointer_cast<FixedCompType>(highMap) == nullptr);
+
+        using WorkerType = FixedDimExpansionWorker<3,FixedDimMaxOrder,BasisType,MemorySpace>;
+        CHECK_THROWS_AS(WorkerType(highSet), std::invalid_argument);
+    }
 }
 
 
@@ -3,9 +3,12 @@
 #include <Kokkos_Core.hpp>
 #include "MParT/AffineMap.h"
 #include "MParT/MapFactory.h"
+#include "MParT/TriangularMap.h"
 #include "MParT/MapObjective.h"
 #include "MParT/Distributions/GaussianSamplerDensity.h"
 
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
 
 using namespace mpart;
@@ -74,6 +77,50 @@ TEST_CASE( "Test KLMapObjective", "[KLMapObjective]") {
             CHECK(coeffGradRef(i) == Approx(coeffGrad(i)).margin(1e-12));
         }
     }
+    SECTION("BlockedCoeffGrad") {
+        Kokkos::View<double*, Kokkos::HostSpace> coeffGradRef ("Reference CoeffGrad of KL Obj", map->numCoeffs);
+        Kokkos::View<double*, Kokkos::HostSpace> coeffGrad ("Blocked CoeffGrad of KL Obj", map->numCoeffs);
+        double kl_est_ref = objective.ObjectivePlusCoeffGradImpl(reference_samples, coeffGradRef, map);
+
+        // Force blocks of 7 samples, which does not evenly divide the number of samples
+        objective.SetGradientBlockBytes(7*map->numCoeffs*sizeof(double));
+        double kl_est = objective.ObjectivePlusCoeffGradImpl(reference_samples, coeffGrad, map);
+        CHECK(kl_est_ref == Approx(kl_est).epsilon(1e-10));
+        for(int i = 0; i < map->numCoeffs; i++) {
+            CHECK(coeffGradRef(i) == Approx(coeffGrad(i)).epsilon(1e-10).margin(1e-12));
+        }
+
+        objective.CoeffGradImpl(reference_samples, coeffGrad, map);
+        for(int i = 0; i < map->numCoeffs; i++) {
+            CHECK(coeffGradRef(i) == Approx(coeffGrad(i)).epsilon(1e-10).margin(1e-12));
+        }
+    }
+    SECTION("MarginalObjective") {
+        REQUIRE(objective.IsSeparable());
+        auto triMap = std::dynamic_pointer_cast<TriangularMap<Kokkos::HostSpace>>(map);
+        REQUIRE(triMap != nullptr);
+
+        StridedVector<double,Kokkos::HostSpace> trainCoeffGrad = objective.TrainCoeffGrad(map);
+        double sumTrainError = 0.;
+        double sumTestError = 0.;
+        unsigned int coeffStart = 0;
+        for(unsigned int k = 0; k < triMap->NumComponents(); k++) {
+            auto comp = triMap->GetComponent(k);
+            auto compObjective = objective.MarginalObjective(comp->inputDim, k, comp->outputDim);
+            CHECK(compObjective->InputDim() == comp->inputDim);
+            CHECK(compObjective->MapOutputDim() == comp->outputDim);
+            sumTrainError += compObjective->TrainError(comp);
+            sumTestError += compObjective->TestError(comp);
+
+            StridedVector<double,Kokkos::HostSpace> compGrad = compObjective->TrainCoeffGrad(comp);
+            for(int i = 0; i < comp->numCoeffs; i++) {
+                CHECK(compGrad(i) == Approx(trainCoeffGrad(coeffStart + i)).epsilon(1e-10).margin(1e-12));
+            }
+            coeffStart += comp->numCoeffs;
+        }
+        CHECK(sumTrainError == Approx(objective.TrainError(map)).epsilon(1e-10));
+        CHECK(sumTestError == Approx(objective.TestError(map)).epsilon(1e-10));
+    }
     SECTION("MapObjectiveFunctions") {
         // operator()
         Kokkos::View<double*, Kokkos::HostSpace> coeffGradRef ("Reference CoeffGrad of KL Obj", map->numCoeffs);
@@ -96,3 +143,85 @@ TEST_CASE( "Test KLMapObjective", "[KLMapObjective]") {
     }
 }
 
+TEST_CASE( "Test streamed KLMapObjective", "[KLMapObjective_Streamed]") {
+    unsigned int dim = 2;
+    unsigned int N_train = 1003;
+    unsigned int N_test = 301;
+    std::shared_ptr<GaussianSamplerDensity<Kokkos::HostSpace>> density = std::make_shared<GaussianSamplerDensity<Kokkos::HostSpace>>(dim);
+    density->SetSeed(42);
+    StridedMatrix<double, Kokkos::HostSpace> train_samples = density->Sample(N_train);
+    StridedMatrix<double, Kokkos::HostSpace> test_samples = density->Sample(N_test);
+
+    std::string trainFile = (std::filesystem::temp_directory_path() / "mpart_test_streamed_train.bin").string();
+    std::string testFile = (std::filesystem::temp_directory_path() / "mpart_test_streamed_test.bin").string();
+    MappedDataset::Write(trainFile, train_samples);
+    MappedDataset::Write(testFile, test_samples);
+
+    auto trainData = std::make_shared<MappedDataset>(trainFile);
+    auto testData = std::make_shared<MappedDataset>(testFile);
+
+    SECTION("MappedDataset") {
+        REQUIRE(trainData->Dim() == dim);
+        REQUIRE(trainData->NumSamples() == N_train);
+        StridedMatrix<const double, Kokkos::HostSpace> block = trainData->Block(10, 20);
+        REQUIRE(block.extent(0) == dim);
+        REQUIRE(block.extent(1) == 10);
+        for(unsigned int j = 0; j < 10; j++) {
+            for(unsigned int i = 0; i < dim; i++) {
+                CHECK(block(i,j) == train_samples(i,10+j));
+            }
+        }
+        CHECK_THROWS_AS(trainData->Block(0, N_train+1), std::invalid_argument);
+        CHECK_THROWS_AS(MappedDataset("mpart_missing_dataset.bin"), std::runtime_error);
+    }
+
+    auto map = MapFactory::CreateTriangular<Kokkos::HostSpace>(dim, dim, 2);
+    Kokkos::deep_copy(map->Coeffs(), 0.5);
+
+    KLObjective<Kokkos::HostSpace> memObjective {train_samples, test_samples, density};
+    KLObjective<Kokkos::HostSpace> fileObjective {trainData, testData, density};
+    REQUIRE(fileObjective.IsStreamed());
+    REQUIRE(fileObjective.InputDim() == dim);
+    REQUIRE(fileObjective.NumSamples() == N_train);
+
+    // Force blocks of 17 samples, which does not evenly divide the number of samples
+    fileObjective.SetStreamBlockBytes(17*dim*sizeof(double));
+
+    SECTION("Objective and gradient") {
+        CHECK(fileObjective.TrainError(map) == Approx(memObjective.TrainError(map)).epsilon(1e-10));
+        CHECK(fileObjective.TestError(map) == Approx(memObjective.TestError(map)).epsilon(1e-10));
+
+        StridedVector<double, Kokkos::HostSpace> memGrad = memObjective.TrainCoeffGrad(map);
+        StridedVector<double, Kokkos::HostSpace> fileGrad = fileObjective.TrainCoeffGrad(map);
+        for(int i = 0; i < map->numCoeffs; i++) {
+            CHECK(fileGrad(i) == Approx(memGrad(i)).epsilon(1e-10).margin(1e-12));
+        }
+
+        Kokkos::View<double*, Kokkos::HostSpace> coeffGrad ("CoeffGrad of streamed KL Obj", map->numCoeffs);
+        double kl_est = fileObjective(map->numCoeffs, map->Coeffs().data(), coeffGrad.data(), map);
+        CHECK(kl_est == Approx(memObjective.TrainError(map)).epsilon(1e-10));
+        for(int i = 0; i < map->numCoeffs; i++) {
+            CHECK(coeffGrad(i) == Approx(memGrad(i)).epsilon(1e-10).margin(1e-12));
+        }
+    }
+
+    SECTION("MarginalObjective") {
+        auto triMap = std::dynamic_pointer_cast<TriangularMap<Kokkos::HostSpace>>(map);
+        REQUIRE(triMap != nullptr);
+        for(unsigned int k = 0; k < triMap->NumComponents(); k++) {
+            auto comp = triMap->GetComponent(k);
+            auto memBlock = memObjective.MarginalObjective(comp->inputDim, k, comp->outputDim);
+            auto fileBlock = fileObjective.MarginalObjective(comp->inputDim, k, comp->outputDim);
+            CHECK(fileBlock->IsStreamed());
+            CHECK(fileBlock->InputDim() == comp->inputDim);
+            CHECK(fileBlock->GetStreamBlockBytes() == fileObjective.GetStreamBlockBytes());
+            CHECK(fileBlock->TrainError(comp) == Approx(memBlock->TrainError(comp)).epsilon(1e-10));
+            CHECK(fileBlock->TestError(comp) == Approx(memBlock->TestError(comp)).epsilon(1e-10));
+        }
+    }
+
+    trainData.reset();
+    testData.reset();
+    std::remove(trainFile.c_str());
+    std::remove(testFile.c_str());
+}
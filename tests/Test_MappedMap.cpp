@@ -0,0 +1,178 @@
+#include <catch2/catch_all.hpp>
+
+#include "MParT/MappedMap.h"
+#include "MParT/MapFactory.h"
+#include "MParT/TriangularMap.h"
+#include "MParT/AffineMap.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+using namespace mpart;
+using namespace Catch;
+using MemorySpace = Kokkos::HostSpace;
+
+TEST_CASE( "Testing zero-copy loading of mapped map files", "[MappedMap]" ) {
+
+    MapOptions options;
+    options.basisType = BasisTypes::PhysicistHermite;
+    options.posFuncType = PosFuncTypes::Exp;
+    options.quadType = QuadTypes::AdaptiveClenshawCurtis;
+    options.quadPts = 4;
+    options.nugget = 1e-3;
+
+    unsigned int inputDim = 4;
+    unsigned int outputDim = 3;
+    unsigned int numPts = 20;
+
+    std::string filename = (std::filesystem::temp_directory_path() / "mpart_test_mapped_map.bin").string();
+
+    Kokkos::View<double**, MemorySpace> pts("Points", inputDim, numPts);
+    for(unsigned int i=0; i<inputDim; ++i){
+        for(unsigned int j=0; j<numPts; ++j)
+            pts(i,j) = -1.0 + 2.0*double(j)/double(numPts-1) + 0.1*i;
+    }
+
+    SECTION("TriangularMap"){
+        auto map = MapFactory::CreateTriangular<MemorySpace>(inputDim, outputDim, 3, options);
+        for(unsigned int i=0; i<map->numCoeffs; ++i)
+            map->Coeffs()(i) = 0.05*std::cos(0.3*i);
+
+        SaveMappedMap(filename, map, options);
+        auto loaded = LoadMappedMap(filename);
+
+        REQUIRE(loaded->inputDim == map->inputDim);
+        REQUIRE(loaded->outputDim == map->outputDim);
+        REQUIRE(loaded->numCoeffs == map->numCoeffs);
+        for(unsigned int i=0; i<map->numCoeffs; ++i)
+            CHECK(loaded->Coeffs()(i) == map->Coeffs()(i));
+
+        StridedMatrix<double, MemorySpace> evals = map->Evaluate(pts);
+        StridedMatrix<double, MemorySpace> loadedEvals = loaded->Evaluate(pts);
+        StridedVector<double, MemorySpace> logDet = map->LogDeterminant(pts);
+        StridedVector<double, MemorySpace> loadedLogDet = loaded->LogDeterminant(pts);
+        for(unsigned int j=0; j<numPts; ++j){
+            for(unsigned int i=0; i<outputDim; ++i)
+                CHECK(loadedEvals(i,j) == Approx(evals(i,j)).epsilon(1e-14).margin(1e-14));
+            CHECK(loadedLogDet(j) == Approx(logDet(j)).epsilon(1e-14).margin(1e-14));
+        }
+
+        // Components keep the mapping alive on their own
+        auto triMap = std::dynamic_pointer_cast<TriangularMap<MemorySpace>>(loaded);
+        REQUIRE(triMap != nullptr);
+        auto lastComp = triMap->GetComponent(outputDim-1);
+        loaded.reset();
+        triMap.reset();
+        StridedMatrix<const double, MemorySpace> lastPts = pts;
+        StridedMatrix<double, MemorySpace> compEvals = lastComp->Evaluate(lastPts);
+        for(unsigned int j=0; j<numPts; ++j)
+            CHECK(compEvals(0,j) == Approx(evals(outputDim-1,j)).epsilon(1e-14).margin(1e-14));
+
+        // Changing the coefficients of a loaded map does not change the file
+        auto first = LoadMappedMap(filename);
+        Kokkos::deep_copy(first->Coeffs(), 1.0);
+        auto second = LoadMappedMap(filename);
+        for(unsigned int i=0; i<map->numCoeffs; ++i)
+            CHECK(second->Coeffs()(i) == map->Coeffs()(i));
+    }
+
+    SECTION("MonotoneComponent"){
+        FixedMultiIndexSet<MemorySpace> mset(inputDim, 2);
+        auto comp = MapFactory::CreateComponent<MemorySpace>(mset, options);
+        Kokkos::View<double*, MemorySpace> coeffs("Coefficients", comp->numCoeffs);
+        for(unsigned int i=0; i<comp->numCoeffs; ++i)
+            coeffs(i) = 0.1*(i+1);
+        comp->SetCoeffs(coeffs);
+
+        SaveMappedMap(filename, comp, options);
+        auto loaded = LoadMappedMap(filename);
+        CHECK(std::dynamic_pointer_cast<TriangularMap<MemorySpace>>(loaded) == nullptr);
+
+        StridedMatrix<double, MemorySpace> evals = comp->Evaluate(pts);
+        StridedMatrix<double, MemorySpace> loadedEvals = loaded->Evaluate(pts);
+        for(unsigned int j=0; j<numPts; ++j)
+            CHECK(loadedEvals(0,j) == Approx(evals(0,j)).epsilon(1e-14).margin(1e-14));
+
+    }
+
+    SECTION("Invalid maps and files"){
+        FixedMultiIndexSet<MemorySpace> mset(inputDim, 2);
+        auto comp = MapFactory::CreateComponentWithoutCoeffs<MemorySpace>(mset, options);
+        CHECK_THROWS_AS(SaveMappedMap(filename, comp, options), std::invalid_argument);
+
+        // Options that do not rebuild the component
+        comp = MapFactory::CreateComponent<MemorySpace>(mset, options);
+        for(unsigned int i=0; i<comp->numCoeffs; ++i)
+            comp->Coeffs()(i) = 0.1*(i+1);
+
+        MapOptions otherQuad = options;
+        otherQuad.quadType = QuadTypes::AdaptiveSimpson;
+        CHECK_THROWS_AS(SaveMappedMap(filename, comp, otherQuad), std::invalid_argument);
+
+        MapOptions otherPosFunc = options;
+        otherPosFunc.posFuncType = PosFuncTypes::SoftPlus;
+        CHECK_THROWS_AS(SaveMappedMap(filename, comp, otherPosFunc), std::invalid_argument);
+
+        MapOptions otherNugget = options;
+        otherNugget.nugget = 0.5;
+        CHECK_THROWS_AS(SaveMappedMap(filename, comp, otherNugget), std::invalid_argument);
+
+        auto map = MapFactory::CreateTriangular<MemorySpace>(inputDim, outputDim, 2, options);
+        CHECK_THROWS_AS(SaveMappedMap(filename, map, otherQuad), std::invalid_argument);
+
+        Kokkos::View<double*, MemorySpace> b("Shift", inputDim);
+        std::shared_ptr<ConditionalMapBase<MemorySpace>> affine = std::make_shared<AffineMap<MemorySpace>>(b);
+        CHECK_THROWS_AS(SaveMappedMap(filename, affine, options), std::invalid_argument);
+
+        CHECK_THROWS_AS(LoadMappedMap("mpart_missing_map.bin"), std::runtime_error);
+    }
+
+    SECTION("Corrupted multiindex sets"){
+        FixedMultiIndexSet<MemorySpace> mset(inputDim, 2);
+        auto comp = MapFactory::CreateComponent<MemorySpace>(mset, options);
+        Kokkos::View<double*, MemorySpace> coeffs("Coefficients", comp->numCoeffs);
+        Kokkos::deep_copy(coeffs, 0.1);
+        comp->SetCoeffs(coeffs);
+        SaveMappedMap(filename, comp, options);
+
+        std::vector<char> bytes;
+        {
+            std::ifstream in(filename, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+
+        // Byte offsets of the component table in the header and of the set sections in the first table entry
+        auto readOffset = [&](uint64_t pos){ uint64_t val; std::memcpy(&val, &bytes[pos], sizeof(uint64_t)); return val; };
+        const uint64_t tableOffset = readOffset(48);
+        const uint64_t nzStartsOffset = readOffset(tableOffset + 32);
+        const uint64_t nzDimsOffset = readOffset(tableOffset + 40);
+        const uint64_t nzOrdersOffset = readOffset(tableOffset + 48);
+        const uint64_t maxDegreesOffset = readOffset(tableOffset + 56);
+
+        std::string corruptName = (std::filesystem::temp_directory_path() / "mpart_test_corrupt_map.bin").string();
+        auto loadCorrupted = [&](uint64_t pos, uint32_t val){
+            std::vector<char> corrupt = bytes;
+            std::memcpy(&corrupt[pos], &val, sizeof(uint32_t));
+            std::ofstream out(corruptName, std::ios::binary | std::ios::trunc);
+            out.write(corrupt.data(), corrupt.size());
+            out.close();
+            return LoadMappedMap(corruptName);
+        };
+
+        uint32_t firstDim;
+        std::memcpy(&firstDim, &bytes[nzDimsOffset], sizeof(uint32_t));
+        CHECK_NOTHROW(loadCorrupted(nzDimsOffset, firstDim));
+
+        CHECK_THROWS_AS(loadCorrupted(nzStartsOffset + sizeof(uint32_t), 1000), std::runtime_error);
+        CHECK_THROWS_AS(loadCorrupted(nzDimsOffset, inputDim), std::runtime_error);
+        CHECK_THROWS_AS(loadCorrupted(nzOrdersOffset, 1000), std::runtime_error);
+        CHECK_THROWS_AS(loadCorrupted(maxDegreesOffset, 1000), std::runtime_error);
+
+        std::remove(corruptName.c_str());
+    }
+
+    std::remove(filename.c_str());
+}
@@ -558,6 +558,150 @@ TEST_CASE( "Testing bracket-based inversion of monotone component", "[MonotoneBr
 }
 
 
+TEST_CASE( "Testing Newton-based inversion of monotone component", "[MonotoneNewtonInverse]" ) {
+
+    const double testTol = 1e-6;
+    unsigned int dim = 2;
+    unsigned int numPts = 20;
+
+    // Points where the inverse is known, and the same points with an initial guess of zero for x_2
+    Kokkos::View<double**, HostSpace> evalPts("Evaluate Points", dim, numPts);
+    Kokkos::View<double**, HostSpace> guessPts("Initial Guesses", dim, numPts);
+    for(unsigned int i=0; i<numPts; ++i){
+        evalPts(0,i) = guessPts(0,i) = std::sin(double(i));
+        evalPts(1,i) = 4.0*(i/double(numPts-1)) - 2.0;
+        guessPts(1,i) = 0.0;
+    }
+
+    unsigned int maxDegree = 3;
+    MultiIndexSet mset = MultiIndexSet::CreateTotalOrder(dim, maxDegree);
+    MultivariateExpansionWorker<BasisEvaluator<BasisHomogeneity::Homogeneous,ProbabilistHermite>,HostSpace> expansion(mset);
+
+    Kokkos::View<double*, HostSpace> coeffs("Expansion coefficients", mset.Size());
+    for(unsigned int i=0; i<mset.Size(); ++i)
+        coeffs(i) = 0.2*std::cos(double(i));
+
+    AdaptiveSimpson quad(30, 1, nullptr, 1e-10, 1e-10, QuadError::First);
+    MonotoneComponent<decltype(expansion), SoftPlus, AdaptiveSimpson<HostSpace>, HostSpace> comp(expansion, quad, true, 1e-3);
+
+    Kokkos::View<double*, HostSpace> ys("ys", numPts);
+    comp.EvaluateImpl(evalPts, coeffs, ys);
+
+    std::map<std::string,std::string> options;
+    options["Method"] = "Newton";
+    options["xtol"] = "1e-10";
+    options["ytol"] = "1e-10";
+
+    SECTION("Options map"){
+        Kokkos::View<double*, HostSpace> testInverse("inverse", numPts);
+        comp.InverseImpl(guessPts, ys, coeffs, testInverse, options);
+
+        for(unsigned int i=0; i<numPts; ++i)
+            CHECK(testInverse(i) == Approx(evalPts(1,i)).epsilon(testTol).margin(testTol));
+    }
+
+    SECTION("Stored options"){
+        comp.SetCoeffs(coeffs);
+        comp.SetInverseOptions(options);
+        CHECK(comp.GetInverseOptions()["Method"] == "Newton");
+
+        Kokkos::View<double**, HostSpace> r("r", 1, numPts);
+        for(unsigned int i=0; i<numPts; ++i)
+            r(0,i) = ys(i);
+
+        auto testInverse = comp.Inverse(guessPts, r);
+        for(unsigned int i=0; i<numPts; ++i)
+            CHECK(testInverse(0,i) == Approx(evalPts(1,i)).epsilon(testTol).margin(testTol));
+    }
+
+    SECTION("Invalid method"){
+        options["Method"] = "Secant";
+        CHECK_THROWS_AS(comp.SetInverseOptions(options), std::invalid_argument);
+    }
+}
+
+
+TEST_CASE( "Testing surrogate-based inversion of monotone component", "[MonotoneSurrogateInverse]" ) {
+
+    unsigned int dim = 2;
+    unsigned int numPts = 50;
+
+    // Every target shares the same value of x_1
+    Kokkos::View<double**, HostSpace> evalPts("Evaluate Points", dim, numPts);
+    for(unsigned int i=0; i<numPts; ++i){
+        evalPts(0,i) = 0.3;
+        evalPts(1,i) = 5.0*(i/double(numPts-1)) - 2.5;
+    }
+
+    Kokkos::View<double**, HostSpace> x("Conditioning Point", dim, 1);
+    x(0,0) = 0.3;
+    x(1,0) = 0.0;
+
+    unsigned int maxDegree = 3;
+    MultiIndexSet mset = MultiIndexSet::CreateTotalOrder(dim, maxDegree);
+    MultivariateExpansionWorker<BasisEvaluator<BasisHomogeneity::Homogeneous,ProbabilistHermite>,HostSpace> expansion(mset);
+
+    Kokkos::View<double*, HostSpace> coeffs("Expansion coefficients", mset.Size());
+    for(unsigned int i=0; i<mset.Size(); ++i)
+        coeffs(i) = 0.2*std::cos(double(i));
+
+    AdaptiveSimpson quad(30, 1, nullptr, 1e-10, 1e-10, QuadError::First);
+    MonotoneComponent<decltype(expansion), SoftPlus, AdaptiveSimpson<HostSpace>, HostSpace> comp(expansion, quad, true, 1e-3);
+
+    Kokkos::View<double*, HostSpace> ys("ys", numPts);
+    comp.EvaluateImpl(evalPts, coeffs, ys);
+
+    std::map<std::string,std::string> options;
+    options["xtol"] = "1e-10";
+    options["ytol"] = "1e-10";
+    options["SurrogateNodes"] = "32";
+
+    SECTION("Polished"){
+        Kokkos::View<double*, HostSpace> testInverse("inverse", numPts);
+        comp.InverseImpl(x, ys, coeffs, testInverse, options);
+
+        for(unsigned int i=0; i<numPts; ++i)
+            CHECK(testInverse(i) == Approx(evalPts(1,i)).margin(1e-6));
+    }
+
+    SECTION("Interpolant only"){
+        options["SurrogatePolish"] = "false";
+
+        Kokkos::View<double*, HostSpace> testInverse("inverse", numPts);
+        comp.InverseImpl(x, ys, coeffs, testInverse, options);
+
+        for(unsigned int i=0; i<numPts; ++i)
+            CHECK(testInverse(i) == Approx(evalPts(1,i)).margin(1e-3));
+    }
+
+    SECTION("Stored options"){
+        comp.SetCoeffs(coeffs);
+        comp.SetInverseOptions(options);
+        CHECK(comp.GetInverseOptions()["SurrogateNodes"] == "32");
+        CHECK(comp.GetInverseOptions()["SurrogatePolish"] == "true");
+
+        Kokkos::View<double**, HostSpace> r("r", 1, numPts);
+        for(unsigned int i=0; i<numPts; ++i)
+            r(0,i) = ys(i);
+
+        // The ConditionalMapBase interface passes a single x point straight through to the component
+        Kokkos::View<double**, HostSpace> testInverse("inverse", 1, numPts);
+        comp.InverseImpl(x, r, testInverse);
+        for(unsigned int i=0; i<numPts; ++i)
+            CHECK(testInverse(0,i) == Approx(evalPts(1,i)).margin(1e-6));
+    }
+
+    SECTION("Invalid options"){
+        options["SurrogateNodes"] = "1";
+        CHECK_THROWS_AS(comp.SetInverseOptions(options), std::invalid_argument);
+
+        options["SurrogateNodes"] = "32";
+        options["SurrogatePolish"] = "maybe";
+        CHECK_THROWS_AS(comp.SetInverseOptions(options), std::invalid_argument);
+    }
+}
+
+
 
 TEST_CASE( "Testing monotone component derivative", "[MonotoneComponentDerivative]" ) {
 
@@ -874,6 +1018,209 @@ TEST_CASE("Testing MonotoneComponent CoeffGrad and LogDeterminantCoeffGrad", "[M
         std::vector<unsigned int> indices_ref = expansion.NonzeroDiagonalEntries();
         REQUIRE(indices == indices_ref);
     }
+
+    SECTION("FreezeData") {
+
+        for(unsigned int i=0; i<numPts; ++i){
+            evalPts(0,i) = 0.03*i - 0.2;
+            evalPts(1,i) = -0.05*i + 0.1;
+        }
+
+        Kokkos::View<double**, HostSpace> sens("Sensitivity", 1, numPts);
+        for(unsigned int i=0; i<numPts; ++i)
+            sens(0,i) = 0.25*(i+1);
+
+        Kokkos::View<double**, HostSpace> evals = comp.Evaluate(evalPts);
+        Kokkos::View<double**, HostSpace> grads = comp.CoeffGrad(evalPts, sens);
+        Kokkos::View<double**, HostSpace> detGrads = comp.LogDeterminantCoeffGrad(evalPts);
+
+        comp.FreezeData(evalPts);
+
+        Kokkos::View<double**, HostSpace> frozenEvals = comp.Evaluate(evalPts);
+        Kokkos::View<double**, HostSpace> frozenGrads = comp.CoeffGrad(evalPts, sens);
+        Kokkos::View<double**, HostSpace> frozenDetGrads = comp.LogDeterminantCoeffGrad(evalPts);
+        for(unsigned int j=0; j<numPts; ++j){
+            CHECK(frozenEvals(0,j) == Approx(evals(0,j)).epsilon(1e-14));
+            for(unsigned int i=0; i<comp.numCoeffs; ++i){
+                CHECK(frozenGrads(i,j) == Approx(grads(i,j)).epsilon(1e-14));
+                CHECK(frozenDetGrads(i,j) == Approx(detGrads(i,j)).epsilon(1e-14));
+            }
+        }
+
+        // A range of columns of the frozen points should also use the cache
+        unsigned int start = 5;
+        StridedMatrix<const double, HostSpace> subPts = Kokkos::subview(evalPts, Kokkos::ALL(), std::make_pair(start, numPts));
+        Kokkos::View<double**, HostSpace> subEvals = comp.Evaluate(subPts);
+        for(unsigned int j=start; j<numPts; ++j)
+            CHECK(subEvals(0,j-start) == Approx(evals(0,j)).epsilon(1e-14));
+
+        // The cache is keyed on the memory of the points, so changing x_1 in place should not change the frozen results
+        Kokkos::View<double**, HostSpace> origPts("Original Points", evalPts.extent(0), numPts);
+        Kokkos::deep_copy(origPts, evalPts);
+        for(unsigned int j=0; j<numPts; ++j)
+            evalPts(0,j) += 0.5;
+
+        frozenEvals = comp.Evaluate(evalPts);
+        frozenGrads = comp.CoeffGrad(evalPts, sens);
+        for(unsigned int j=0; j<numPts; ++j){
+            CHECK(frozenEvals(0,j) == Approx(evals(0,j)).epsilon(1e-14));
+            for(unsigned int i=0; i<comp.numCoeffs; ++i)
+                CHECK(frozenGrads(i,j) == Approx(grads(i,j)).epsilon(1e-14));
+        }
+
+        // A copy of the changed points is not frozen, so it sees the new values
+        Kokkos::View<double**, HostSpace> changedPts("Changed Points", evalPts.extent(0), numPts);
+        Kokkos::deep_copy(changedPts, evalPts);
+        Kokkos::View<double**, HostSpace> changedEvals = comp.Evaluate(changedPts);
+        for(unsigned int j=0; j<numPts; ++j)
+            CHECK(changedEvals(0,j) != Approx(evals(0,j)).epsilon(1e-10));
+
+        Kokkos::deep_copy(evalPts, origPts);
+
+        comp.UnfreezeData();
+        Kokkos::View<double**, HostSpace> unfrozenEvals = comp.Evaluate(evalPts);
+        for(unsigned int j=0; j<numPts; ++j)
+            CHECK(unfrozenEvals(0,j) == Approx(evals(0,j)).epsilon(1e-14));
+    }
+}
+
+TEST_CASE("Testing MonotoneComponent FreezeData with fixed quadrature nodes", "[MonotoneComponent_FreezeData]")
+{
+    unsigned int dim = 2;
+    unsigned int numPts = 20;
+
+    Kokkos::View<double**, HostSpace> evalPts("Evaluate Points", dim, numPts);
+    for(unsigned int i=0; i<numPts; ++i){
+        evalPts(0,i) = 0.03*i - 0.2;
+        evalPts(1,i) = -0.05*i + 0.4;
+    }
+
+    unsigned int maxDegree = 3;
+    MultiIndexSet mset = MultiIndexSet::CreateTotalOrder(dim, maxDegree);
+    MultivariateExpansionWorker<BasisEvaluator<BasisHomogeneity::Homogeneous,ProbabilistHermite>,HostSpace> expansion(mset);
+
+    ClenshawCurtisQuadrature<HostSpace> quad(9, 1);
+
+    // Use the discrete derivative so the quadrature is also used in the log determinant and its gradient
+    MonotoneComponent<decltype(expansion), SoftPlus, ClenshawCurtisQuadrature<HostSpace>, HostSpace> comp(expansion, quad, false);
+
+    Kokkos::View<double*, HostSpace> coeffs("Expansion coefficients", mset.Size());
+    for(unsigned int i=0; i<coeffs.extent(0); ++i)
+        coeffs(i) = 0.1*std::cos( 0.01*i );
+    comp.SetCoeffs(coeffs);
+
+    Kokkos::View<double**, HostSpace> sens("Sensitivity", 1, numPts);
+    for(unsigned int i=0; i<numPts; ++i)
+        sens(0,i) = 0.25*(i+1);
+
+    Kokkos::View<double**, HostSpace> evals = comp.Evaluate(evalPts);
+    Kokkos::View<double*, HostSpace> logDets = comp.LogDeterminant(evalPts);
+    Kokkos::View<double**, HostSpace> grads = comp.CoeffGrad(evalPts, sens);
+    Kokkos::View<double**, HostSpace> detGrads = comp.LogDeterminantCoeffGrad(evalPts);
+
+    comp.FreezeData(evalPts);
+
+    Kokkos::View<double**, HostSpace> frozenEvals = comp.Evaluate(evalPts);
+    Kokkos::View<double*, HostSpace> frozenLogDets = comp.LogDeterminant(evalPts);
+    Kokkos::View<double**, HostSpace> frozenGrads = comp.CoeffGrad(evalPts, sens);
+    Kokkos::View<double**, HostSpace> frozenDetGrads = comp.LogDeterminantCoeffGrad(evalPts);
+
+    for(unsigned int j=0; j<numPts; ++j){
+        CHECK(frozenEvals(0,j) == Approx(evals(0,j)).epsilon(1e-13).margin(1e-14));
+        CHECK(frozenLogDets(j) == Approx(logDets(j)).epsilon(1e-13).margin(1e-14));
+        for(unsigned int i=0; i<comp.numCoeffs; ++i){
+            CHECK(frozenGrads(i,j) == Approx(grads(i,j)).epsilon(1e-13).margin(1e-14));
+            CHECK(frozenDetGrads(i,j) == Approx(detGrads(i,j)).epsilon(1e-13).margin(1e-14));
+        }
+    }
+
+    // Changing x_1 in place should not change the frozen results, which shows the cache is used
+    Kokkos::View<double**, HostSpace> origPts("Original Points", dim, numPts);
+    Kokkos::deep_copy(origPts, evalPts);
+    for(unsigned int j=0; j<numPts; ++j)
+        evalPts(0,j) += 0.5;
+
+    frozenEvals = comp.Evaluate(evalPts);
+    frozenGrads = comp.CoeffGrad(evalPts, sens);
+    for(unsigned int j=0; j<numPts; ++j){
+        CHECK(frozenEvals(0,j) == Approx(evals(0,j)).epsilon(1e-13).margin(1e-14));
+        for(unsigned int i=0; i<comp.numCoeffs; ++i)
+            CHECK(frozenGrads(i,j) == Approx(grads(i,j)).epsilon(1e-13).margin(1e-14));
+    }
+
+    Kokkos::deep_copy(evalPts, origPts);
+
+    // Changing the coefficients should not invalidate the frozen values
+    for(unsigned int i=0; i<coeffs.extent(0); ++i)
+        coeffs(i) = 0.2*std::sin( 0.1*i );
+    comp.SetCoeffs(coeffs);
+
+    frozenEvals = comp.Evaluate(evalPts);
+    comp.UnfreezeData();
+    evals = comp.Evaluate(evalPts);
+    for(unsigned int j=0; j<numPts; ++j)
+        CHECK(frozenEvals(0,j) == Approx(evals(0,j)).epsilon(1e-13).margin(1e-14));
+}
+
+// Same function as Square, but a different type so that MonotoneComponent falls back to quadrature
+class QuadratureSquare : public Square {};
+
+TEST_CASE("Testing closed form MonotoneComponent with squared positivity", "[MonotoneComponent_Square]")
+{
+    unsigned int dim = 2;
+    unsigned int numPts = 20;
+    double nugget = 1e-2;
+
+    Kokkos::View<double**, HostSpace> evalPts("Evaluate Points", dim, numPts);
+    for(unsigned int i=0; i<numPts; ++i){
+        evalPts(0,i) = 0.1*i - 1.0;
+        evalPts(1,i) = -0.15*i + 1.4;
+    }
+
+    unsigned int maxDegree = 4;
+    MultiIndexSet mset = MultiIndexSet::CreateTotalOrder(dim, maxDegree);
+    MultivariateExpansionWorker<BasisEvaluator<BasisHomogeneity::Homogeneous,ProbabilistHermite>,HostSpace> expansion(mset);
+
+    // A Gauss-Legendre rule with more points than needed, so the reference integral is exact up to roundoff
+    GaussLegendreQuadrature<HostSpace> quad(2*maxDegree, 1);
+
+    Kokkos::View<double*, HostSpace> coeffs("Expansion coefficients", mset.Size());
+    for(unsigned int i=0; i<coeffs.extent(0); ++i)
+        coeffs(i) = 0.3*std::cos( 0.7*i );
+
+    for(bool contDeriv : {true, false}){
+        MonotoneComponent<decltype(expansion), Square, GaussLegendreQuadrature<HostSpace>, HostSpace> comp(expansion, quad, contDeriv, nugget);
+        MonotoneComponent<decltype(expansion), QuadratureSquare, GaussLegendreQuadrature<HostSpace>, HostSpace> refComp(expansion, quad, contDeriv, nugget);
+        comp.SetCoeffs(coeffs);
+        refComp.SetCoeffs(coeffs);
+
+        Kokkos::View<double**, HostSpace> sens("Sensitivity", 1, numPts);
+        for(unsigned int i=0; i<numPts; ++i)
+            sens(0,i) = 0.25*(i+1);
+
+        Kokkos::View<double**, HostSpace> evals = comp.Evaluate(evalPts);
+        Kokkos::View<double**, HostSpace> refEvals = refComp.Evaluate(evalPts);
+        Kokkos::View<double*, HostSpace> logDets = comp.LogDeterminant(evalPts);
+        Kokkos::View<double*, HostSpace> refLogDets = refComp.LogDeterminant(evalPts);
+        Kokkos::View<double**, HostSpace> grads = comp.CoeffGrad(evalPts, sens);
+        Kokkos::View<double**, HostSpace> refGrads = refComp.CoeffGrad(evalPts, sens);
+        Kokkos::View<double**, HostSpace> detGrads = comp.LogDeterminantCoeffGrad(evalPts);
+        Kokkos::View<double**, HostSpace> refDetGrads = refComp.LogDeterminantCoeffGrad(evalPts);
+
+        for(unsigned int j=0; j<numPts; ++j){
+            CHECK(evals(0,j) == Approx(refEvals(0,j)).epsilon(1e-11).margin(1e-11));
+            CHECK(logDets(j) == Approx(refLogDets(j)).epsilon(1e-11).margin(1e-11));
+            for(unsigned int i=0; i<comp.numCoeffs; ++i){
+                CHECK(grads(i,j) == Approx(refGrads(i,j)).epsilon(1e-11).margin(1e-11));
+                CHECK(detGrads(i,j) == Approx(refDetGrads(i,j)).epsilon(1e-11).margin(1e-11));
+            }
+        }
+
+        // The inverse still uses the quadrature rule, which is exact here
+        auto invPts = comp.Inverse(evalPts, evals);
+        for(unsigned int j=0; j<numPts; ++j)
+            CHECK(invPts(0,j) == Approx(evalPts(dim-1,j)).epsilon(1e-6).margin(1e-6));
+    }
 }
 
 #if defined(KOKKOS_ENABLE_CUDA ) || defined(KOKKOS_ENABLE_SYCL)
@@ -230,6 +230,50 @@ TEST_CASE( "Testing Physicist Hermite polynomials", "[PhysicistHermite]" ) {
 }
 
 
+TEMPLATE_TEST_CASE( "Testing integrals of derivative products", "[OrthogonalPolynomialProductIntegrals]", ProbabilistHermite, PhysicistHermite ) {
+
+    const unsigned int maxOrder = 5;
+    const unsigned int numCoeffs = 2*maxOrder;
+
+    for(bool normalize : {false, true}){
+        TestType poly(normalize);
+
+        auto integrals = poly.DerivativeProductIntegrals(maxOrder);
+        REQUIRE(integrals.extent(0)==maxOrder+1);
+        REQUIRE(integrals.extent(1)==maxOrder+1);
+        REQUIRE(integrals.extent(2)==numCoeffs);
+
+        for(double x : {-1.5, 0.0, 0.3, 2.0}){
+
+            // Composite Simpson rule, which is accurate to roundoff for these low order polynomials
+            const unsigned int numIntervals = 200;
+            const double h = x/numIntervals;
+            std::vector<double> vals(maxOrder+1), derivs(maxOrder+1);
+            Kokkos::View<double**, Kokkos::HostSpace> truth("Truth", maxOrder+1, maxOrder+1);
+            for(unsigned int i=0; i<=numIntervals; ++i){
+                double wt = ((i==0)||(i==numIntervals)) ? 1.0 : ((i%2==1) ? 4.0 : 2.0);
+                poly.EvaluateDerivatives(&vals[0], &derivs[0], maxOrder, i*h);
+                for(unsigned int a=0; a<=maxOrder; ++a){
+                    for(unsigned int b=0; b<=maxOrder; ++b)
+                        truth(a,b) += wt*h/3.0*derivs[a]*derivs[b];
+                }
+            }
+
+            std::vector<double> polyVals(numCoeffs);
+            poly.EvaluateAll(&polyVals[0], numCoeffs-1, x);
+            for(unsigned int a=0; a<=maxOrder; ++a){
+                for(unsigned int b=0; b<=maxOrder; ++b){
+                    double integral = 0.0;
+                    for(unsigned int c=0; c<numCoeffs; ++c)
+                        integral += integrals(a,b,c)*polyVals[c];
+                    CHECK( integral == Approx(truth(a,b)).epsilon(1e-8).margin(1e-8) );
+                }
+            }
+        }
+    }
+}
+
+
 #if defined(KOKKOS_ENABLE_CUDA ) || defined(KOKKOS_ENABLE_SYCL)
 
 TEST_CASE( "Device Hermite polynomial evaluation", "[PhysicistHermiteDevice]" ) {
@@ -319,6 +319,158 @@ TEST_CASE( "Testing Adaptive Simpson Integration", "[AdaptiveSimpson]" ) {
 
 
 
+TEST_CASE( "Testing Gauss-Legendre Quadrature", "[GaussLegendreQuadrature]" ) {
+
+    SECTION("Polynomial Exactness")
+    {
+        // An n point rule should exactly integrate monomials up to degree 2n-1 on [-1,1]
+        for(unsigned int numPts : {1, 2, 3, 6, 11}){
+            auto rule = GaussLegendreQuadrature<Kokkos::HostSpace>::GetRule(numPts);
+            Eigen::VectorXd wts = rule.first;
+            Eigen::VectorXd pts = rule.second;
+
+            for(unsigned int i=1; i<numPts; ++i)
+                CHECK(pts(i)>pts(i-1));
+
+            for(unsigned int power=0; power<2*numPts; ++power){
+                double integral = 0;
+                for(unsigned int i=0; i<numPts; ++i)
+                    integral += wts(i)*std::pow(pts(i), power);
+
+                double truth = (power%2==0) ? 2.0/(power+1.0) : 0.0;
+                CHECK( integral == Approx(truth).margin(1e-13) );
+            }
+        }
+    }
+
+    unsigned int order = 6;
+    double testTol = 1e-10;
+
+    GaussLegendreQuadrature quad(order,2);
+
+    SECTION("Class Integrand")
+    {
+        double lb = 0;
+        double ub = 1.0;
+
+        TestIntegrand integrand;
+        double integral;
+        quad.SetDim(1);
+        quad.Integrate(integrand, lb, ub, &integral);
+
+        CHECK( integral == Approx(exp(ub)-exp(lb)).epsilon(testTol) );
+    }
+
+    SECTION("Vector-Valued with External Workspace")
+    {
+        GaussLegendreQuadrature quad2(order,2,nullptr);
+
+        std::vector<double> workspace(quad2.WorkspaceSize());
+        quad2.SetWorkspace(&workspace[0]);
+
+        double lb = 0.0;
+        double ub = 1.0;
+
+        auto integrand = [](double x, double* f){f[0]=exp(x); f[1]=2.0*exp(x);};
+
+        double integral[2];
+        quad2.Integrate(integrand, lb, ub, integral);
+
+        CHECK( integral[0] == Approx(exp(ub)-exp(lb)).epsilon(testTol) );
+        CHECK( integral[1] == Approx(2.0*(exp(ub)-exp(lb))).epsilon(testTol) );
+    }
+
+    SECTION("Fewer Points than Clenshaw-Curtis")
+    {
+        // Six Gauss-Legendre points should be more accurate than ten Clenshaw-Curtis points for a smooth integrand
+        ClenshawCurtisQuadrature ccQuad(10,1);
+
+        auto integrand = [](double x, double* f){f[0]=exp(3.0*x)*std::cos(2.0*x);};
+        double truth = (exp(3.0)*(3.0*std::cos(2.0) + 2.0*std::sin(2.0)) - 3.0)/13.0;
+
+        double glIntegral, ccIntegral;
+        quad.SetDim(1);
+        quad.Integrate(integrand, 0.0, 1.0, &glIntegral);
+        ccQuad.Integrate(integrand, 0.0, 1.0, &ccIntegral);
+
+        CHECK( std::abs(glIntegral-truth) < std::abs(ccIntegral-truth) );
+    }
+}
+
+
+TEST_CASE( "Testing Adaptive Gauss-Kronrod Quadrature", "[AdaptiveGaussKronrod]" ) {
+
+    unsigned int maxSub = 30;
+    unsigned int maxDim = 2;
+
+    double relTol = 1e-10;
+    double absTol = 1e-10;
+
+    double testTol = 1e-8;
+
+    AdaptiveGaussKronrod quad(maxSub, maxDim, absTol, relTol, QuadError::First);
+    quad.SetDim(1);
+
+    SECTION("Class Integrand")
+    {
+        double lb = 0;
+        double ub = 1.0;
+
+        unsigned int numEvals = 0;
+        auto integrand = [&](double x, double* f){
+            numEvals++;
+            f[0]=exp(x);
+        };
+
+        double integral;
+        quad.Integrate(integrand, lb, ub, &integral);
+
+        CHECK( integral == Approx(exp(ub)-exp(lb)).epsilon(testTol) );
+
+        // A smooth integrand should not need any subdivision
+        CHECK( numEvals == 15 );
+    }
+
+    SECTION("Discontinuous Integrand")
+    {
+        double lb = 0;
+        double ub = 1.0;
+
+        auto integrand = [](double x, double* f){
+            if(x<0.3)
+                f[0]=exp(x);
+            else
+                f[0]=1.0+exp(x);
+        };
+        double integral;
+        quad.Integrate(integrand, lb, ub, &integral);
+
+        double trueVal = (ub-0.3) + exp(ub)-exp(lb);
+        CHECK( integral == Approx(trueVal).epsilon(1e-6) );
+    }
+
+    SECTION("Vector-Valued with External Workspace")
+    {
+        AdaptiveGaussKronrod quad2(maxSub, maxDim, nullptr, absTol, relTol, QuadError::NormInf);
+
+        std::vector<double> workspace(quad2.WorkspaceSize());
+        quad2.SetWorkspace(&workspace[0]);
+
+        double lb = 0.0;
+        double ub = 1.0;
+
+        auto integrand = [](double x, double* f){f[0]=exp(x); f[1]=std::sin(10.0*x);};
+
+        double integral[2];
+        quad2.Integrate(integrand, lb, ub, integral);
+
+        CHECK( integral[0] == Approx(exp(ub)-exp(lb)).epsilon(testTol) );
+        CHECK( integral[1] == Approx((1.0-std::cos(10.0))/10.0).epsilon(testTol) );
+    }
+}
+
+
+
 
 #if defined(KOKKOS_ENABLE_CUDA ) || defined(KOKKOS_ENABLE_SYCL)
 
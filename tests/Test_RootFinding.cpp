@@ -111,4 +111,85 @@ TEST_CASE( "RootFindingUtils", "[RootFindingUtils]") {
         CHECK(info==0);
     }
 
-}
\ No newline at end of file
+}
+
+
+// Sum of sigmoids with analytic derivatives for testing the Newton solver
+struct SigmoidComboFunctor {
+    int* numEvals = nullptr;
+
+    static void Sigmoid(double x, double a, double b, double scale, double& f, double& df, double& d2f){
+        double s = 1./(std::exp(-a*(x-b))+1);
+        f += scale*s;
+        df += scale*a*s*(1-s);
+        d2f += scale*a*a*s*(1-s)*(1-2*s);
+    }
+
+    double operator()(double x){
+        double f, df, d2f;
+        ValueAndDerivatives(x, f, df, d2f);
+        return f;
+    }
+
+    void ValueAndDerivatives(double x, double& f, double& df, double& d2f){
+        if(numEvals)
+            (*numEvals)++;
+        f = df = d2f = 0.0;
+        Sigmoid(x, 2.0, 1.0, 1.0, f, df, d2f);
+        Sigmoid(x, 0.5, 0.0, 3.0, f, df, d2f);
+        Sigmoid(x, 1.5, -1.0, 0.5, f, df, d2f);
+    }
+};
+
+TEST_CASE( "Newton root finding", "[RootFindingNewton]") {
+
+    const double xtol = 1e-8, ftol = 1e-8;
+    int info;
+
+    SECTION("Near initial guess") {
+        SigmoidComboFunctor f;
+        double xd = 0.5, yd = f(xd);
+
+        double xd_found = InverseSingleNewton<HostSpace>(yd, f, 0.0, xtol, ftol, info);
+        CHECK( xd_found == Approx(xd).epsilon(2*xtol));
+        CHECK(info==0);
+    }
+
+    for(double x0 : {-5.0, 5.0, 20.0}){
+        SECTION("Far initial guess " + std::to_string(x0)) {
+            SigmoidComboFunctor f;
+            double xd = 0.5, yd = f(xd);
+
+            double xd_found = InverseSingleNewton<HostSpace>(yd, f, x0, xtol, ftol, info);
+            CHECK( xd_found == Approx(xd).epsilon(2*xtol));
+            CHECK(info==0);
+        }
+    }
+
+    SECTION("Fewer evaluations than bracketing") {
+        int newtonEvals = 0, bracketEvals = 0;
+        SigmoidComboFunctor newtonFunc, bracketFunc;
+        newtonFunc.numEvals = &newtonEvals;
+        bracketFunc.numEvals = &bracketEvals;
+
+        double xd = 0.5, yd = SigmoidComboFunctor()(xd);
+
+        InverseSingleNewton<HostSpace>(yd, newtonFunc, -2.0, xtol, ftol, info);
+        InverseSingleBracket<HostSpace>(yd, bracketFunc, -2.0, xtol, ftol, info);
+        CHECK(newtonEvals < bracketEvals);
+    }
+}
+
+TEST_CASE( "Cubic Hermite inversion", "[RootFindingHermite]") {
+
+    // The cubic Hermite interpolant of a cubic is exact, so the inverse can be checked directly
+    auto f = [](double x){ return x*x*x + 0.5*x*x + x; };
+    auto df = [](double x){ return 3.0*x*x + x + 1.0; };
+
+    const double x0 = -1.0, x1 = 0.5, h = x1 - x0;
+
+    for(double xd : {-1.0, -0.7, 0.0, 0.3, 0.5}){
+        double t = InverseHermiteCubic(f(xd), f(x0), f(x1), df(x0), df(x1), h);
+        CHECK( x0 + t*h == Approx(xd).margin(1e-12));
+    }
+}
@@ -450,4 +450,51 @@ TEST_CASE("Test serialization of triangular map.", "[Serialization]"){
             }
         }   
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Test serialization of MapOptions", "[Serialization]"){
+
+    MapOptions opts;
+    opts.basisType = BasisTypes::PhysicistHermite;
+    opts.posFuncType = PosFuncTypes::Exp;
+    opts.quadType = QuadTypes::ClenshawCurtis;
+    opts.quadPts = 7;
+    opts.nugget = 1e-3;
+    opts.fixedDimWorker = true;
+
+    std::stringstream ss;
+
+    SECTION("Current version"){
+        {
+            cereal::BinaryOutputArchive oarchive(ss);
+            oarchive(opts);
+        }
+        MapOptions loaded;
+        {
+            cereal::BinaryInputArchive iarchive(ss);
+            iarchive(loaded);
+        }
+        CHECK(loaded == opts);
+        CHECK(loaded.fixedDimWorker);
+    }
+
+    SECTION("Version 0"){
+        // Version 0 archives hold the class version followed by every option except fixedDimWorker
+        {
+            cereal::BinaryOutputArchive oarchive(ss);
+            oarchive(std::uint32_t(0), opts.basisType, opts.basisLB, opts.basisUB, opts.posFuncType, opts.quadType, opts.quadAbsTol,
+                     opts.quadRelTol, opts.quadMaxSub, opts.quadMinSub, opts.quadPts, opts.contDeriv, opts.basisNorm, opts.nugget);
+        }
+        MapOptions loaded;
+        loaded.fixedDimWorker = true;
+        {
+            cereal::BinaryInputArchive iarchive(ss);
+            iarchive(loaded);
+        }
+        CHECK(loaded.basisType == opts.basisType);
+        CHECK(loaded.posFuncType == opts.posFuncType);
+        CHECK(loaded.quadType == opts.quadType);
+        CHECK(loaded.quadPts == opts.quadPts);
+        CHECK(loaded.nugget == opts.nugget);
+        CHECK_FALSE(loaded.fixedDimWorker);
+    }
+}
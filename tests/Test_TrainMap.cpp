@@ -41,6 +41,42 @@ TEST_CASE("Test_TrainMap", "[TrainMap]") {
         auto pullback_samples = map->Evaluate(testSamps);
         TestStandardNormalSamples(pullback_samples);
     }
+    SECTION("SquareMapStochastic") {
+        StridedMatrix<const double, Kokkos::HostSpace> testSamps = Kokkos::subview(targetSamples, Kokkos::make_pair(1u,3u), Kokkos::make_pair(0u, testPts));
+        StridedMatrix<const double, Kokkos::HostSpace> trainSamps = Kokkos::subview(targetSamples, Kokkos::make_pair(1u,3u), Kokkos::make_pair(testPts, numPts));
+        auto obj = ObjectiveFactory::CreateGaussianKLObjective(trainSamps, testSamps);
+
+        MapOptions map_options;
+        auto map = MapFactory::CreateTriangular<Kokkos::HostSpace>(dim, dim, map_order, map_options);
+
+        TrainOptions train_options;
+        train_options.opt_alg = "ADAM";
+        train_options.opt_batch_size = 250;
+        train_options.opt_epochs = 60;
+        train_options.opt_learning_rate = 5e-2;
+        train_options.opt_lr_decay = 0.05;
+        train_options.opt_seed = seed;
+        train_options.verbose = 0;
+        double error = TrainMap(map, obj, train_options);
+        CHECK(std::isfinite(error));
+        auto pullback_samples = map->Evaluate(testSamps);
+        TestStandardNormalSamples(pullback_samples);
+    }
+    SECTION("SquareMapComponentwise") {
+        StridedMatrix<const double, Kokkos::HostSpace> testSamps = Kokkos::subview(targetSamples, Kokkos::make_pair(1u,3u), Kokkos::make_pair(0u, testPts));
+        StridedMatrix<const double, Kokkos::HostSpace> trainSamps = Kokkos::subview(targetSamples, Kokkos::make_pair(1u,3u), Kokkos::make_pair(testPts, numPts));
+        auto obj = ObjectiveFactory::CreateGaussianKLObjective(trainSamps, testSamps);
+
+        MapOptions map_options;
+        auto map = MapFactory::CreateTriangular<Kokkos::HostSpace>(dim, dim, map_order, map_options);
+
+        TrainOptions train_options;
+        train_options.verbose = 0;
+        double error = TrainMapComponentwise(map, obj, train_options);
+        CHECK(error == Approx(obj->TrainError(map)).epsilon(1e-8));
+        auto pullback_samples = map->Evaluate(testSamps);
+        TestStandardNormalSamples(pullback_samples);
+    }
     SECTION("ComponentMap") {
         StridedMatrix<const double, Kokkos::HostSpace> testSamps = Kokkos::subview(targetSamples, Kokkos::make_pair(1u,3u), Kokkos::pair<unsigned int, unsigned int>(0, testPts));
         StridedMatrix<const double, Kokkos::HostSpace> trainSamps = Kokkos::subview(targetSamples, Kokkos::make_pair(1u,3u), Kokkos::pair<unsigned int, unsigned int>(testPts, numPts));
@@ -90,6 +90,49 @@ TEST_CASE( "Testing 3d triangular map from MonotoneComponents with moveCoeffs=fa
         }
     }
 
+    SECTION("Warm-Started Inverse"){
+
+        Kokkos::View<double**, Kokkos::HostSpace> guess("Initial Guess", numBlocks, numSamps);
+        Kokkos::View<double**, Kokkos::HostSpace> widths("Bracket Widths", numBlocks, numSamps);
+        for(unsigned int i=0; i<numBlocks; ++i){
+            for(unsigned int j=0; j<numSamps; ++j){
+                guess(i,j) = in(i+extraInputs,j) + 0.05;
+                widths(i,j) = 0.2;
+            }
+        }
+
+        StridedMatrix<const double, Kokkos::HostSpace> x1 = in;
+        StridedMatrix<const double, Kokkos::HostSpace> r = out;
+        StridedMatrix<const double, Kokkos::HostSpace> x2Guess = guess;
+        auto inv = triMap->Inverse(x1, r, x2Guess, widths);
+
+        for(unsigned int i=0; i<numBlocks; ++i){
+            for(unsigned int j=0; j<numSamps; ++j){
+                CHECK( inv(i,j) == Approx(in(i+extraInputs,j)).margin(1e-6));
+
+                // The widths should now reflect the distance from the guess to the root
+                CHECK( widths(i,j) == Approx(0.1).margin(1e-5));
+            }
+        }
+
+        // Solving again from the root only halves the widths instead of collapsing them to the tolerance
+        auto inv2 = triMap->Inverse(x1, r, StridedMatrix<const double, Kokkos::HostSpace>(inv), widths);
+        for(unsigned int i=0; i<numBlocks; ++i){
+            for(unsigned int j=0; j<numSamps; ++j){
+                CHECK( inv2(i,j) == Approx(in(i+extraInputs,j)).margin(1e-6));
+                CHECK( widths(i,j) == Approx(0.05).margin(1e-5));
+            }
+        }
+
+        // Repeated exact guesses stop shrinking the widths at 0.01
+        for(unsigned int iter=0; iter<5; ++iter)
+            triMap->Inverse(x1, r, StridedMatrix<const double, Kokkos::HostSpace>(inv), widths);
+        for(unsigned int i=0; i<numBlocks; ++i){
+            for(unsigned int j=0; j<numSamps; ++j)
+                CHECK( widths(i,j) == Approx(0.01).margin(1e-5));
+        }
+    }
+
     SECTION("LogDeterminant"){
         auto logDet = triMap->LogDeterminant(in);
 
@@ -767,3 +810,231 @@ TEST_CASE( "Testing TriangularMap made using CreateSingleEntryMap", "[Triangular
     }
 
 }
+
+
+TEST_CASE( "Testing chunked evaluation of a triangular map", "[TriangularMap_Chunked]" ) {
+
+    MapOptions options;
+    options.basisType = BasisTypes::ProbabilistHermite;
+
+    unsigned int dim = 3;
+    unsigned int maxDegree = 2;
+    auto map = MapFactory::CreateTriangular<MemorySpace>(dim, dim, maxDegree, options);
+
+    Kokkos::View<double*, MemorySpace> coeffs("Coefficients", map->numCoeffs);
+    for(unsigned int i=0; i<map->numCoeffs; ++i)
+        coeffs(i) = 0.1*std::cos(0.3*i);
+    map->SetCoeffs(coeffs);
+
+    unsigned int numPts = 23;
+    Kokkos::View<double**, MemorySpace> pts("Points", dim, numPts);
+    Kokkos::View<double**, MemorySpace> sens("Sensitivities", dim, numPts);
+    Kokkos::View<double**, MemorySpace> guess("Initial guess", dim, numPts);
+    Kokkos::View<double**, MemorySpace> widths("Bracket widths", dim, numPts);
+    Kokkos::View<double**, MemorySpace> chunkWidths("Chunked bracket widths", dim, numPts);
+    for(unsigned int j=0; j<numPts; ++j){
+        for(unsigned int i=0; i<dim; ++i){
+            pts(i,j) = std::sin(0.7*j + i);
+            sens(i,j) = 1.0 + 0.1*i - 0.05*j;
+            guess(i,j) = pts(i,j) + 0.1;
+            widths(i,j) = 0.5;
+            chunkWidths(i,j) = 0.5;
+        }
+    }
+
+    CHECK(map->ChunkSize() == 0);
+    auto evals = map->Evaluate(pts);
+    auto logDets = map->LogDeterminant(pts);
+    auto grads = map->Gradient(pts, sens);
+    auto coeffGrads = map->CoeffGrad(pts, sens);
+    auto detCoeffGrads = map->LogDeterminantCoeffGrad(pts);
+    auto detInputGrads = map->LogDeterminantInputGrad(pts);
+    auto inverse = map->Inverse(pts, evals);
+    StridedMatrix<const double, MemorySpace> x1 = pts;
+    StridedMatrix<const double, MemorySpace> r = evals;
+    StridedMatrix<const double, MemorySpace> x2Guess = guess;
+    auto guessInverse = map->Inverse(x1, r, x2Guess, widths);
+
+    // Tiles that do not evenly divide the number of points
+    map->SetChunkSize(5);
+    CHECK(map->ChunkSize() == 5);
+
+    auto chunkEvals = map->Evaluate(pts);
+    auto chunkLogDets = map->LogDeterminant(pts);
+    auto chunkGrads = map->Gradient(pts, sens);
+    auto chunkCoeffGrads = map->CoeffGrad(pts, sens);
+    auto chunkDetCoeffGrads = map->LogDeterminantCoeffGrad(pts);
+    auto chunkDetInputGrads = map->LogDeterminantInputGrad(pts);
+    auto chunkInverse = map->Inverse(pts, evals);
+    auto chunkGuessInverse = map->Inverse(x1, r, x2Guess, chunkWidths);
+
+    for(unsigned int j=0; j<numPts; ++j){
+        CHECK(chunkLogDets(j) == Approx(logDets(j)).epsilon(1e-14).margin(1e-14));
+        for(unsigned int i=0; i<dim; ++i){
+            CHECK(chunkEvals(i,j) == Approx(evals(i,j)).epsilon(1e-14).margin(1e-14));
+            CHECK(chunkGrads(i,j) == Approx(grads(i,j)).epsilon(1e-14).margin(1e-14));
+            CHECK(chunkDetInputGrads(i,j) == Approx(detInputGrads(i,j)).epsilon(1e-14).margin(1e-14));
+            CHECK(chunkInverse(i,j) == Approx(inverse(i,j)).epsilon(1e-14).margin(1e-14));
+            CHECK(chunkGuessInverse(i,j) == Approx(guessInverse(i,j)).epsilon(1e-14).margin(1e-14));
+            CHECK(chunkWidths(i,j) == Approx(widths(i,j)).epsilon(1e-14).margin(1e-14));
+        }
+        for(unsigned int i=0; i<map->numCoeffs; ++i){
+            CHECK(chunkCoeffGrads(i,j) == Approx(coeffGrads(i,j)).epsilon(1e-14).margin(1e-14));
+            CHECK(chunkDetCoeffGrads(i,j) == Approx(detCoeffGrads(i,j)).epsilon(1e-14).margin(1e-14));
+        }
+    }
+
+    // Chunk size computed from a byte budget
+    map->SetChunkBytes(7*2*dim*sizeof(double));
+    CHECK(map->ChunkSize() == 7);
+    map->SetChunkBytes(1);
+    CHECK(map->ChunkSize() == 1);
+}
+
+
+TEST_CASE( "Testing shared basis evaluations in a triangular map", "[TriangularMap_SharedBasis]" ) {
+
+    MapOptions options;
+    options.basisType = BasisTypes::HermiteFunctions;
+
+    // Components with different degrees, so the shared table must hold the largest degree in each input
+    unsigned int dim = 4;
+    std::vector<std::shared_ptr<ConditionalMapBase<MemorySpace>>> comps(dim);
+    for(unsigned int i=0; i<dim; ++i){
+        FixedMultiIndexSet<MemorySpace> mset(i+1, 4-i);
+        comps.at(i) = MapFactory::CreateComponent<MemorySpace>(mset, options);
+    }
+    for(unsigned int i=1; i<dim; ++i){
+        CHECK(comps.at(i)->CanShareBasis(*comps.at(0)));
+        CHECK(comps.at(i)->SharedBasisDegrees().size() == i);
+        CHECK(comps.at(i)->SharedBasisDegrees().at(0) == 4-i);
+    }
+
+    auto map = std::make_shared<TriangularMap<MemorySpace>>(comps);
+
+    Kokkos::View<double*, MemorySpace> coeffs("Coefficients", map->numCoeffs);
+    for(unsigned int i=0; i<map->numCoeffs; ++i)
+        coeffs(i) = 0.1*std::cos(0.3*i);
+    map->SetCoeffs(coeffs);
+
+    unsigned int numPts = 17;
+    Kokkos::View<double**, MemorySpace> pts("Points", dim, numPts);
+    Kokkos::View<double**, MemorySpace> sens("Sensitivities", dim, numPts);
+    for(unsigned int j=0; j<numPts; ++j){
+        for(unsigned int i=0; i<dim; ++i){
+            pts(i,j) = std::sin(0.7*j + i);
+            sens(i,j) = 1.0 + 0.1*i - 0.05*j;
+        }
+    }
+
+    auto evals = map->Evaluate(pts);
+    auto logDets = map->LogDeterminant(pts);
+    auto coeffGrads = map->CoeffGrad(pts, sens);
+
+    // Each component on its own evaluates the basis itself
+    Kokkos::View<double*, MemorySpace> compLogDets("Log Determinants", numPts);
+    unsigned int coeffStart = 0;
+    for(unsigned int i=0; i<dim; ++i){
+        auto subPts = Kokkos::subview(pts, std::make_pair(0,int(i+1)), Kokkos::ALL());
+        auto subSens = Kokkos::subview(sens, std::make_pair(int(i),int(i+1)), Kokkos::ALL());
+
+        auto compEvals = comps.at(i)->Evaluate(subPts);
+        auto compDets = comps.at(i)->LogDeterminant(subPts);
+        auto compCoeffGrads = comps.at(i)->CoeffGrad(subPts, subSens);
+
+        for(unsigned int j=0; j<numPts; ++j){
+            CHECK(evals(i,j) == Approx(compEvals(0,j)).epsilon(1e-14).margin(1e-14));
+            compLogDets(j) += compDets(j);
+            for(unsigned int k=0; k<comps.at(i)->numCoeffs; ++k)
+                CHECK(coeffGrads(coeffStart+k,j) == Approx(compCoeffGrads(k,j)).epsilon(1e-14).margin(1e-14));
+        }
+        coeffStart += comps.at(i)->numCoeffs;
+    }
+
+    for(unsigned int j=0; j<numPts; ++j)
+        CHECK(logDets(j) == Approx(compLogDets(j)).epsilon(1e-14).margin(1e-14));
+
+    // Frozen caches take precedence over the shared table
+    map->FreezeData(pts);
+    auto frozenEvals = map->Evaluate(pts);
+    map->UnfreezeData();
+    for(unsigned int j=0; j<numPts; ++j){
+        for(unsigned int i=0; i<dim; ++i)
+            CHECK(frozenEvals(i,j) == Approx(evals(i,j)).epsilon(1e-14).margin(1e-14));
+    }
+}
+
+
+TEST_CASE( "Testing fused forward pass of a triangular map", "[TriangularMap_ForwardPass]" ) {
+
+    MapOptions options;
+    options.basisType = BasisTypes::ProbabilistHermite;
+    options.nugget = 1e-3;
+
+    SECTION("Continuous derivative"){
+        options.contDeriv = true;
+    }
+    SECTION("Discrete derivative"){
+        options.contDeriv = false;
+    }
+    SECTION("Closed form integral"){
+        options.posFuncType = PosFuncTypes::Square;
+        options.contDeriv = false;
+    }
+
+    unsigned int dim = 3;
+    unsigned int maxDegree = 3;
+    auto map = MapFactory::CreateTriangular<MemorySpace>(dim, dim, maxDegree, options);
+
+    Kokkos::View<double*, MemorySpace> coeffs("Coefficients", map->numCoeffs);
+    for(unsigned int i=0; i<map->numCoeffs; ++i)
+        coeffs(i) = 0.1*std::cos(0.3*i);
+    map->SetCoeffs(coeffs);
+
+    unsigned int numPts = 13;
+    Kokkos::View<double**, MemorySpace> pts("Points", dim, numPts);
+    Kokkos::View<double**, MemorySpace> sens("Sensitivities", dim, numPts);
+    for(unsigned int j=0; j<numPts; ++j){
+        for(unsigned int i=0; i<dim; ++i){
+            pts(i,j) = std::sin(0.7*j + i);
+            sens(i,j) = 1.0 + 0.1*i - 0.05*j;
+        }
+    }
+
+    auto evals = map->Evaluate(pts);
+    auto logDets = map->LogDeterminant(pts);
+    auto coeffGrads = map->CoeffGrad(pts, sens);
+    auto detCoeffGrads = map->LogDeterminantCoeffGrad(pts);
+
+    Kokkos::View<double**, MemorySpace> fusedEvals("Evaluations", dim, numPts);
+    Kokkos::View<double*, MemorySpace> fusedDets("Log Determinants", numPts);
+    Kokkos::View<double**, MemorySpace> fusedGrads("Coefficient Gradient", map->numCoeffs, numPts);
+
+    // Everything at once
+    map->ForwardPassImpl(pts, sens, fusedEvals, fusedDets, fusedGrads);
+    for(unsigned int j=0; j<numPts; ++j){
+        CHECK(fusedDets(j) == Approx(logDets(j)).epsilon(1e-12).margin(1e-12));
+        for(unsigned int i=0; i<dim; ++i)
+            CHECK(fusedEvals(i,j) == Approx(evals(i,j)).epsilon(1e-12).margin(1e-12));
+        for(unsigned int i=0; i<map->numCoeffs; ++i)
+            CHECK(fusedGrads(i,j) == Approx(coeffGrads(i,j) + detCoeffGrads(i,j)).epsilon(1e-12).margin(1e-12));
+    }
+
+    // Only the values
+    Kokkos::deep_copy(fusedEvals, 0.0);
+    Kokkos::deep_copy(fusedDets, 0.0);
+    map->ForwardPassImpl(pts, StridedMatrix<const double, MemorySpace>(), fusedEvals, fusedDets, StridedMatrix<double, MemorySpace>());
+    for(unsigned int j=0; j<numPts; ++j){
+        CHECK(fusedDets(j) == Approx(logDets(j)).epsilon(1e-12).margin(1e-12));
+        for(unsigned int i=0; i<dim; ++i)
+            CHECK(fusedEvals(i,j) == Approx(evals(i,j)).epsilon(1e-12).margin(1e-12));
+    }
+
+    // Only the gradient
+    Kokkos::deep_copy(fusedGrads, 0.0);
+    map->ForwardPassImpl(pts, sens, StridedMatrix<double, MemorySpace>(), StridedVector<double, MemorySpace>(), fusedGrads);
+    for(unsigned int j=0; j<numPts; ++j){
+        for(unsigned int i=0; i<map->numCoeffs; ++i)
+            CHECK(fusedGrads(i,j) == Approx(coeffGrads(i,j) + detCoeffGrads(i,j)).epsilon(1e-12).margin(1e-12));
+    }
+}